@@ -0,0 +1,2 @@
+#define BUILD_AAWESET
+#include "aweset.c"
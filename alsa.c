@@ -129,22 +129,22 @@ int seq_mem_avail(void)
 	return mem_avail;
 }
 
+int seq_misc_mode(int mode, int value)
+{
+	struct sndrv_emux_misc_mode misc;
+	misc.port = -1;
+	misc.mode = mode;
+	misc.value = value;
+	misc.value2 = 0;
+	return snd_hwdep_ioctl(hwdep, SNDRV_EMUX_IOCTL_MISC_MODE, &misc);
+}
+
 int seq_zero_atten(int atten)
 {
-	struct sndrv_emux_misc_mode mode;
-	mode.port = -1;
-	mode.mode = AWE_MD_ZERO_ATTEN;
-	mode.value = atten;
-	mode.value2 = 0;
-	return snd_hwdep_ioctl(hwdep, SNDRV_EMUX_IOCTL_MISC_MODE, &mode);
+	return seq_misc_mode(AWE_MD_ZERO_ATTEN, atten);
 }
 
 void seq_set_gus_bank(int bank)
 {
-	struct sndrv_emux_misc_mode mode;
-	mode.port = -1;
-	mode.mode = AWE_MD_GUS_BANK;
-	mode.value = bank;
-	mode.value2 = 0;
-	snd_hwdep_ioctl(hwdep, SNDRV_EMUX_IOCTL_MISC_MODE, &mode);
+	seq_misc_mode(AWE_MD_GUS_BANK, bank);
 }
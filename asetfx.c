@@ -0,0 +1,2 @@
+#define BUILD_ASETFX
+#include "setfx.c"
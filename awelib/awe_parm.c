@@ -23,6 +23,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include "awe_parm.h"
+#include "freqnote.h"
 #include "sfopts.h"
 
 /* #define LOOKUP_TABLE */
@@ -64,7 +65,7 @@ int awe_abscent_to_mHz(int abscents)
  */
 int awe_mHz_to_abscent(int mHz)
 {
-	return (int)(log((double)mHz / 8176.0) / log(2.0) * 1200.0);
+	return awe_freq_to_cent(mHz);
 }
 
 
@@ -0,0 +1,277 @@
+/*================================================================
+ * checkbank -- load a virtual bank with the preset mapping
+ *
+ * Copyright (C) 1996-2003 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *================================================================*/
+
+/*
+ * A small soundfont with presets 0 and 1 and a bank mapping preset 0
+ * to 10 are written in the current directory.  Preset 10 is requested
+ * as the on-demand loader of asfxload does: the mapping is sent once by
+ * awe_load_bank_map(), the locked preset 1 and the requested presets
+ * are loaded from the cached bank.  Each request must load the samples
+ * of preset 0, and the mapping must not be sent again.  Run by "make check".
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <awe_voice.h>
+#include "util.h"
+#include "awebank.h"
+#include "sfopts.h"
+#include "sflayer.h"
+
+#define FONT_FILE	"checkbank.sf2"
+#define BANK_FILE	"checkbank.bnk"
+
+#define NUM_SAMPLES	200
+
+/*----------------------------------------------------------------
+ * write a soundfont
+ *----------------------------------------------------------------*/
+
+static void put_word(FILE *fp, int val)
+{
+	putc(val & 0xff, fp);
+	putc((val >> 8) & 0xff, fp);
+}
+
+static void put_dword(FILE *fp, int val)
+{
+	put_word(fp, val & 0xffff);
+	put_word(fp, (val >> 16) & 0xffff);
+}
+
+static void put_id(FILE *fp, char *id, int size)
+{
+	fwrite(id, 4, 1, fp);
+	put_dword(fp, size);
+}
+
+static void put_name(FILE *fp, char *name, int len)
+{
+	char buf[20];
+	memset(buf, 0, sizeof(buf));
+	strncpy(buf, name, len);
+	fwrite(buf, len, 1, fp);
+}
+
+/* preset header */
+static void put_phdr(FILE *fp, char *name, int preset, int bag)
+{
+	put_name(fp, name, 20);
+	put_word(fp, preset);
+	put_word(fp, 0);	/* bank */
+	put_word(fp, bag);
+	put_dword(fp, 0);	/* library */
+	put_dword(fp, 0);	/* genre */
+	put_dword(fp, 0);	/* morphology */
+}
+
+static void put_shdr(FILE *fp, char *name, int start, int end, int loop)
+{
+	put_name(fp, name, 20);
+	put_dword(fp, start);
+	put_dword(fp, end);
+	put_dword(fp, loop ? start + 10 : 0);
+	put_dword(fp, loop ? end - 10 : 0);
+	put_dword(fp, loop ? 44100 : 0);
+	putc(loop ? 60 : 0, fp);	/* original pitch */
+	putc(0, fp);			/* pitch correction */
+	put_word(fp, 0);		/* sample link */
+	put_word(fp, loop ? 1 : 0);	/* mono */
+}
+
+/* presets 0 and 1 use the same instrument with one sample */
+static int write_font(char *name)
+{
+	FILE *fp;
+	int i, info_size, sdta_size, pdta_size;
+
+	if ((fp = fopen(name, "wb")) == NULL)
+		return -1;
+	info_size = 4 + 8 + 4 + 8 + 8;
+	sdta_size = 4 + 8 + NUM_SAMPLES * 2;
+	pdta_size = 4 + 9 * 8 + 3 * 38 + 3 * 4 + 10 + 3 * 4 +
+		2 * 22 + 2 * 4 + 10 + 2 * 4 + 2 * 46;
+
+	put_id(fp, "RIFF", 4 + 8 + info_size + 8 + sdta_size + 8 + pdta_size);
+	fwrite("sfbk", 4, 1, fp);
+
+	put_id(fp, "LIST", info_size);
+	fwrite("INFO", 4, 1, fp);
+	put_id(fp, "ifil", 4);
+	put_word(fp, 2);
+	put_word(fp, 1);
+	put_id(fp, "INAM", 8);
+	put_name(fp, "check", 8);
+
+	put_id(fp, "LIST", sdta_size);
+	fwrite("sdta", 4, 1, fp);
+	put_id(fp, "smpl", NUM_SAMPLES * 2);
+	for (i = 0; i < NUM_SAMPLES; i++)
+		put_word(fp, i < 100 ? (i & 15) << 8 : 0);
+
+	put_id(fp, "LIST", pdta_size);
+	fwrite("pdta", 4, 1, fp);
+	put_id(fp, "phdr", 3 * 38);
+	put_phdr(fp, "preset0", 0, 0);
+	put_phdr(fp, "preset1", 1, 1);
+	put_phdr(fp, "EOP", 0, 2);
+	put_id(fp, "pbag", 3 * 4);
+	for (i = 0; i < 3; i++) {
+		put_word(fp, i);	/* generator */
+		put_word(fp, 0);	/* modulator */
+	}
+	put_id(fp, "pmod", 10);
+	put_word(fp, 0); put_word(fp, 0); put_word(fp, 0);
+	put_word(fp, 0); put_word(fp, 0);
+	put_id(fp, "pgen", 3 * 4);
+	put_word(fp, SF_instrument); put_word(fp, 0);
+	put_word(fp, SF_instrument); put_word(fp, 0);
+	put_word(fp, 0); put_word(fp, 0);
+	put_id(fp, "inst", 2 * 22);
+	put_name(fp, "inst0", 20); put_word(fp, 0);
+	put_name(fp, "EOI", 20); put_word(fp, 1);
+	put_id(fp, "ibag", 2 * 4);
+	put_word(fp, 0); put_word(fp, 0);
+	put_word(fp, 1); put_word(fp, 0);
+	put_id(fp, "imod", 10);
+	put_word(fp, 0); put_word(fp, 0); put_word(fp, 0);
+	put_word(fp, 0); put_word(fp, 0);
+	put_id(fp, "igen", 2 * 4);
+	put_word(fp, SF_sampleId); put_word(fp, 0);
+	put_word(fp, 0); put_word(fp, 0);
+	put_id(fp, "shdr", 2 * 46);
+	put_shdr(fp, "sample0", 0, 100, TRUE);
+	put_shdr(fp, "EOS", 0, 0, FALSE);
+
+	fclose(fp);
+	return 0;
+}
+
+static int write_bank(char *name)
+{
+	FILE *fp;
+
+	if ((fp = fopen(name, "w")) == NULL)
+		return -1;
+	fprintf(fp, "0:10\n");
+	fprintf(fp, "default " FONT_FILE "\n");
+	fclose(fp);
+	return 0;
+}
+
+
+/*----------------------------------------------------------------
+ * driver operations; count the patches
+ *----------------------------------------------------------------*/
+
+static int num_maps, num_infos;
+
+static int load_patch(void *buf, int len)
+{
+	awe_patch_info *patch = (awe_patch_info*)buf;
+
+	switch (patch->type) {
+	case AWE_MAP_PRESET:
+		num_maps++;
+		break;
+	case AWE_LOAD_INFO:
+		num_infos++;
+		break;
+	case AWE_OPEN_PATCH:
+		return 1;	/* patch id */
+	}
+	return 0;
+}
+
+static int mem_avail(void)
+{
+	return 1024 * 1024;
+}
+
+static int no_samples(void)
+{
+	return 0;
+}
+
+static int zero_atten(int val)
+{
+	return 0;
+}
+
+static AWEOps ops = {
+	load_patch, mem_avail, no_samples, no_samples, zero_atten
+};
+
+
+int main(void)
+{
+	SFPatchRec pat;
+	LoadList *list;
+	int i, rc, infos, errors = 0;
+
+	if (write_font(FONT_FILE) < 0 || write_bank(BANK_FILE) < 0) {
+		fprintf(stderr, "checkbank: can't write the test files\n");
+		return 1;
+	}
+	awe_init_option();
+	awe_option.search_path = safe_strdup(".");
+
+	awe_set_bank_cache(TRUE);
+	rc = awe_load_bank_map(&ops, BANK_FILE, TRUE);
+	if (rc != AWE_RET_OK || num_maps != 1) {
+		fprintf(stderr, "checkbank: awe_load_bank_map() = %d, %d maps\n",
+			rc, num_maps);
+		errors++;
+	}
+
+	pat.preset = 1;
+	pat.bank = 0;
+	pat.keynote = -1;
+	list = awe_add_loadlist(NULL, &pat, NULL);
+	rc = awe_load_bank(&ops, BANK_FILE, list, TRUE);
+	awe_free_loadlist(list);
+	if (rc != AWE_RET_OK || num_infos == 0) {
+		fprintf(stderr, "checkbank: locked preset 1 = %d, no voice loaded\n", rc);
+		errors++;
+	}
+
+	pat.preset = 10;
+	for (i = 0; i < 3; i++) {
+		infos = num_infos;
+		list = awe_add_loadlist(NULL, &pat, NULL);
+		rc = awe_load_bank(&ops, BANK_FILE, list, FALSE);
+		awe_free_loadlist(list);
+		if (rc != AWE_RET_OK || num_infos == infos) {
+			fprintf(stderr, "checkbank: request %d of preset 10 = %d, no voice loaded\n",
+				i, rc);
+			errors++;
+		}
+	}
+	if (num_maps != 1) {
+		fprintf(stderr, "checkbank: the mapping was sent %d times\n",
+			num_maps);
+		errors++;
+	}
+	awe_set_bank_cache(FALSE);
+
+	remove(FONT_FILE);
+	remove(BANK_FILE);
+	return errors ? 1 : 0;
+}
@@ -0,0 +1,73 @@
+/*================================================================
+ * checkfreq -- compare the frequency/note tables with the formulas
+ *
+ * Copyright (C) 1996-2003 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *================================================================*/
+
+/*
+ * freqtab.h is generated once and kept in the source tree, so the
+ * lookups must still agree with FREQ_TO_CENT and SEMITONE_RATIO
+ * computed by the libm of the target.  Run by "make check".
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include "freqnote.h"
+
+#define MAX_FREQ	20000000	/* mHz */
+#define MAX_ERRORS	10
+
+static int errors;
+
+static void error(const char *what, int val, double got, double expect)
+{
+	if (errors < MAX_ERRORS)
+		fprintf(stderr, "checkfreq: %s(%d) = %g, expected %g\n",
+			what, val, got, expect);
+	errors++;
+}
+
+int main(void)
+{
+	int i;
+
+	for (i = 1; i <= MAX_FREQ; i++) {
+		int cent = (int)FREQ_TO_CENT(i);
+		int round = (int)(FREQ_TO_CENT(i) + 0.5);
+		if (awe_freq_to_cent(i) != cent)
+			error("awe_freq_to_cent", i, awe_freq_to_cent(i), cent);
+		if (awe_freq_to_cent_round(i) != round)
+			error("awe_freq_to_cent_round", i,
+			      awe_freq_to_cent_round(i), round);
+	}
+	for (i = -200; i <= 200; i++) {
+		if (awe_semitone_ratio(i) != SEMITONE_RATIO(i))
+			error("awe_semitone_ratio", i,
+			      awe_semitone_ratio(i), SEMITONE_RATIO(i));
+	}
+	for (i = 0; i < 128; i++) {
+		int freq = (int)(SEMITONE_RATIO(i) * 8176.0);
+		if (awe_note_to_freq(i) != freq)
+			error("awe_note_to_freq", i, awe_note_to_freq(i), freq);
+	}
+
+	if (errors) {
+		fprintf(stderr, "checkfreq: %d mismatches\n", errors);
+		return 1;
+	}
+	return 0;
+}
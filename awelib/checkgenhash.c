@@ -0,0 +1,56 @@
+/*================================================================
+ * checkgenhash -- look up all generator names via the hash table
+ *
+ * Copyright (C) 1996-2003 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *================================================================*/
+
+/*
+ * genhash.h is generated from sf_gen_text and kept in the source tree,
+ * so sf_gen_index() must still find every name at its own id after
+ * the names are changed.  If not, run "make update-genhash".
+ * Run by "make check".
+ */
+
+#include <stdio.h>
+#include "sflayer.h"
+
+int main(void)
+{
+	int i, id, errors = 0;
+
+	for (i = 0; i < SF_EOF; i++) {
+		if (sf_gen_text[i] == NULL)
+			continue;
+		id = sf_gen_index(sf_gen_text[i]);
+		if (id != i) {
+			fprintf(stderr, "checkgenhash: %s = %d, expected %d\n",
+				sf_gen_text[i], id, i);
+			errors++;
+		}
+	}
+	if (sf_gen_index("noSuchGenerator") != SF_EOF) {
+		fprintf(stderr, "checkgenhash: unknown name is found\n");
+		errors++;
+	}
+
+	if (errors) {
+		fprintf(stderr, "checkgenhash: %d mismatches; "
+			"run \"make update-genhash\"\n", errors);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,150 @@
+/*================================================================
+ * checkhash -- compare the hashed lookup of a loading list with
+ *	the linear search
+ *
+ * Copyright (C) 1996-2003 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *================================================================*/
+
+/*
+ * A loading list as large as a generated 10000-line bank file is
+ * indexed by awe_make_loadhash(), and awe_loadhash_find() must return
+ * the same element as the linear search from the list head, also for
+ * the wildcard records and the elements prepended later.  The time of
+ * both lookups is printed.  Run by "make check".
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "util.h"
+#include "awebank.h"
+
+#define LIST_SIZE	10000
+#define NUM_ADDED	100
+#define NUM_BANKS	16
+#define MAX_ERRORS	10
+
+static unsigned int seed = 1;
+
+/* reproducible on every host */
+static int random_val(int n)
+{
+	seed = seed * 1103515245 + 12345;
+	return (int)((seed >> 16) & 0x7fff) % n;
+}
+
+/* 1/20 of the records have a wildcard preset or bank */
+static void random_patch(SFPatchRec *pat)
+{
+	pat->preset = random_val(20) ? random_val(128) : -1;
+	pat->bank = random_val(20) ? random_val(NUM_BANKS) : -1;
+	pat->keynote = random_val(4) ? -1 : random_val(128);
+}
+
+static LoadList *add_random(LoadList *list)
+{
+	SFPatchRec pat, map;
+
+	random_patch(&pat);
+	random_patch(&map);
+	list = awe_add_loadlist(list, &pat, &map);
+	list->loaded = random_val(2);
+	return list;
+}
+
+/* the search before the hashed index */
+static LoadList *linear_find(LoadList *p, SFPatchRec *pat, int loaded_only)
+{
+	for (; p; p = p->next) {
+		if ((!loaded_only || p->loaded) && awe_match_preset(&p->map, pat))
+			return p;
+	}
+	return NULL;
+}
+
+static int errors;
+
+static void compare(LoadList *list, LoadHash *hash, SFPatchRec *pat, int loaded_only)
+{
+	LoadList *p = linear_find(list, pat, loaded_only);
+	LoadList *q = awe_loadhash_find(hash, pat, loaded_only);
+
+	if (p != q) {
+		if (errors < MAX_ERRORS)
+			fprintf(stderr, "checkhash: %d/%d/%d (loaded_only=%d) differs\n",
+				pat->preset, pat->bank, pat->keynote, loaded_only);
+		errors++;
+	}
+}
+
+/* look up every preset of every bank; return the time in msec */
+static double lookup_all(LoadList *list, LoadHash *hash)
+{
+	SFPatchRec pat;
+	clock_t start = clock();
+
+	pat.keynote = 60;
+	for (pat.bank = 0; pat.bank < NUM_BANKS; pat.bank++) {
+		for (pat.preset = 0; pat.preset < 128; pat.preset++) {
+			if (hash)
+				awe_loadhash_find(hash, &pat, TRUE);
+			else
+				linear_find(list, &pat, TRUE);
+		}
+	}
+	return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+int main(void)
+{
+	LoadList *list = NULL;
+	LoadHash *hash;
+	SFPatchRec pat;
+	int i, loaded_only;
+
+	for (i = 0; i < LIST_SIZE; i++)
+		list = add_random(list);
+	hash = awe_make_loadhash(list);
+	/* the elements prepended after indexing */
+	for (i = 0; i < NUM_ADDED; i++) {
+		list = add_random(list);
+		awe_loadhash_add(hash, list);
+	}
+
+	for (loaded_only = 0; loaded_only < 2; loaded_only++) {
+		for (pat.bank = -1; pat.bank < NUM_BANKS + 1; pat.bank++) {
+			for (pat.preset = -1; pat.preset < 128; pat.preset++) {
+				pat.keynote = -1;
+				compare(list, hash, &pat, loaded_only);
+				pat.keynote = 60;
+				compare(list, hash, &pat, loaded_only);
+			}
+		}
+	}
+
+	printf("checkhash: %d lookups in %d elements: linear %.1f ms, hashed %.1f ms\n",
+	       NUM_BANKS * 128, LIST_SIZE + NUM_ADDED,
+	       lookup_all(list, NULL), lookup_all(list, hash));
+
+	awe_free_loadhash(hash);
+	awe_free_loadlist(list);
+
+	if (errors) {
+		fprintf(stderr, "checkhash: %d mismatches\n", errors);
+		return 1;
+	}
+	return 0;
+}
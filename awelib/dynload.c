@@ -139,3 +139,146 @@ void awe_merge_keys(SFPatchRec *p1, SFPatchRec *p2, SFPatchRec *rec)
 }
 
 
+
+
+/*----------------------------------------------------------------
+ * hashed index of a loading list
+ *----------------------------------------------------------------
+ * The elements are hashed by the bank/preset numbers of the map
+ * record.  The elements with a wildcard preset or bank are kept in a
+ * separate chain, and checked together with the hashed chain.
+ * Each chain is sorted in the list order, so that the lookup returns
+ * the same element as a linear search from the list head.
+ *----------------------------------------------------------------*/
+
+#define LOADHASH_SIZE	256
+#define loadhash_key(preset,bank) \
+	((unsigned int)((bank) * 131 + (preset)) % LOADHASH_SIZE)
+
+typedef struct _LoadHashEnt {
+	LoadList *rec;
+	int order;	/* position in the list; smaller is nearer to head */
+	struct _LoadHashEnt *next;
+} LoadHashEnt;
+
+struct _AWELoadHash {
+	LoadList *list;		/* head of the indexed list */
+	int first;		/* order of the head element */
+	/* the last chain holds the elements with wildcard preset/bank */
+	LoadHashEnt *table[LOADHASH_SIZE + 1];
+};
+
+#define WILD_CHAIN	LOADHASH_SIZE
+
+static int loadhash_index(SFPatchRec *map)
+{
+	if (map->preset == -1 || map->bank == -1)
+		return WILD_CHAIN;
+	return loadhash_key(map->preset, map->bank);
+}
+
+/* create an index of the given list */
+LoadHash *awe_make_loadhash(LoadList *list)
+{
+	LoadHash *hash;
+	LoadHashEnt *ent;
+	LoadHashEnt **tail[LOADHASH_SIZE + 1];
+	int i, order;
+
+	hash = (LoadHash*)safe_malloc(sizeof(LoadHash));
+	hash->list = list;
+	hash->first = 0;
+	for (i = 0; i <= LOADHASH_SIZE; i++)
+		tail[i] = &hash->table[i];
+
+	/* append each element at the tail of its chain */
+	for (order = 0; list; list = list->next, order++) {
+		ent = (LoadHashEnt*)safe_malloc(sizeof(LoadHashEnt));
+		ent->rec = list;
+		ent->order = order;
+		i = loadhash_index(&list->map);
+		*tail[i] = ent;
+		tail[i] = &ent->next;
+	}
+	return hash;
+}
+
+/* register the element prepended to the indexed list */
+void awe_loadhash_add(LoadHash *hash, LoadList *rec)
+{
+	LoadHashEnt *ent;
+	int i;
+
+	ent = (LoadHashEnt*)safe_malloc(sizeof(LoadHashEnt));
+	ent->rec = rec;
+	ent->order = --hash->first;
+	i = loadhash_index(&rec->map);
+	ent->next = hash->table[i];
+	hash->table[i] = ent;
+	hash->list = rec;
+}
+
+#define loadhash_match(ent,pat,loaded_only) \
+	((!(loaded_only) || (ent)->rec->loaded) && \
+	 awe_match_preset(&(ent)->rec->map, pat))
+
+/* search the first element matching with the given pattern;
+ * if loaded_only is TRUE, only the loaded elements are checked.
+ */
+LoadList *awe_loadhash_find(LoadHash *hash, SFPatchRec *pat, int loaded_only)
+{
+	LoadHashEnt *ent, *found;
+	LoadList *p;
+
+	if (hash == NULL)
+		return NULL;
+
+	if (pat->preset == -1 || pat->bank == -1) {
+		/* wildcard pattern -- any element may match */
+		for (p = hash->list; p; p = p->next) {
+			if ((!loaded_only || p->loaded) &&
+			    awe_match_preset(&p->map, pat))
+				return p;
+		}
+		return NULL;
+	}
+
+	found = NULL;
+	for (ent = hash->table[loadhash_key(pat->preset, pat->bank)];
+	     ent; ent = ent->next) {
+		if (loadhash_match(ent, pat, loaded_only)) {
+			found = ent;
+			break;
+		}
+	}
+	for (ent = hash->table[WILD_CHAIN]; ent; ent = ent->next) {
+		if (found && ent->order > found->order)
+			break;
+		if (loadhash_match(ent, pat, loaded_only)) {
+			found = ent;
+			break;
+		}
+	}
+	return found ? found->rec : NULL;
+}
+
+static void free_loadhash_chain(LoadHashEnt *ent)
+{
+	LoadHashEnt *next;
+	for (; ent; ent = next) {
+		next = ent->next;
+		safe_free(ent);
+	}
+}
+
+/* free the index; the indexed list itself is not touched */
+void awe_free_loadhash(LoadHash *hash)
+{
+	int i;
+
+	if (hash == NULL)
+		return;
+	for (i = 0; i <= LOADHASH_SIZE; i++)
+		free_loadhash_chain(hash->table[i]);
+	safe_free(hash);
+}
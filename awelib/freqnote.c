@@ -0,0 +1,75 @@
+/*================================================================
+ * conversion between frequency and note
+ *
+ * Copyright (C) 1996-2003 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *================================================================*/
+
+/*
+ * The conversions are looked up in the tables made by mkfreqtab
+ * instead of calling log() and pow().  The values out of the tables
+ * are calculated with the formulas as before.
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include "freqnote.h"
+#include "freqtab.h"	/* generated by mkfreqtab */
+
+/* index of the half cent including the frequency; -1 if out of table */
+static int find_half_cent(int mHz)
+{
+	int h, shift;
+
+	if (mHz < freq_tab[0] || mHz >= freq_tab[FREQ_TAB_SIZE - 1])
+		return -1;
+	/* start from the index of the top bits, and search forward */
+	for (shift = FREQ_INDEX_SHIFT; (mHz >> shift) >= (2 << FREQ_INDEX_BITS); shift++)
+		;
+	h = freq_index[((shift - FREQ_INDEX_SHIFT) << FREQ_INDEX_BITS) +
+		       (mHz >> shift) - (1 << FREQ_INDEX_BITS)];
+	while (freq_tab[h + 1] <= mHz)
+		h++;
+	return h;
+}
+
+int awe_freq_to_cent(int mHz)
+{
+	int h = find_half_cent(mHz);
+	if (h < 0)
+		return (int)FREQ_TO_CENT(mHz);
+	return h / 2;
+}
+
+int awe_freq_to_cent_round(int mHz)
+{
+	int h = find_half_cent(mHz);
+	if (h < 0)
+		return (int)(FREQ_TO_CENT(mHz) + 0.5);
+	return (h + 1) / 2;
+}
+
+double awe_semitone_ratio(int n)
+{
+	if (n < -SEMITONE_MAX || n > SEMITONE_MAX)
+		return SEMITONE_RATIO(n);
+	return semitone_tab[n + SEMITONE_MAX];
+}
+
+int awe_note_to_freq(int key)
+{
+	return (int)(awe_semitone_ratio(key) * 8176.0);
+}
@@ -0,0 +1,4052 @@
+/* generated by mkfreqtab (make update-freqtab); do not edit */
+
+#define FREQ_TAB_SIZE	25601
+#define FREQ_INDEX_BITS	9
+#define FREQ_INDEX_SHIFT	3
+#define SEMITONE_MAX	128
+
+/* lowest mHz of each half cent */
+static const int freq_tab[FREQ_TAB_SIZE] = {
+	8176,8179,8181,8184,8186,8188,8191,8193,
+	8195,8198,8200,8203,8205,8207,8210,8212,
+	8214,8217,8219,8221,8224,8226,8229,8231,
+	8233,8236,8238,8241,8243,8245,8248,8250,
+	8252,8255,8257,8260,8262,8264,8267,8269,
+	8272,8274,8276,8279,8281,8283,8286,8288,
+	8291,8293,8295,8298,8300,8303,8305,8307,
+	8310,8312,8315,8317,8319,8322,8324,8327,
+	8329,8331,8334,8336,8339,8341,8343,8346,
+	8348,8351,8353,8356,8358,8360,8363,8365,
+	8368,8370,8372,8375,8377,8380,8382,8385,
+	8387,8389,8392,8394,8397,8399,8402,8404,
+	8406,8409,8411,8414,8416,8419,8421,8423,
+	8426,8428,8431,8433,8436,8438,8440,8443,
+	8445,8448,8450,8453,8455,8457,8460,8462,
+	8465,8467,8470,8472,8475,8477,8480,8482,
+	8484,8487,8489,8492,8494,8497,8499,8502,
+	8504,8506,8509,8511,8514,8516,8519,8521,
+	8524,8526,8529,8531,8534,8536,8538,8541,
+	8543,8546,8548,8551,8553,8556,8558,8561,
+	8563,8566,8568,8571,8573,8576,8578,8581,
+	8583,8585,8588,8590,8593,8595,8598,8600,
+	8603,8605,8608,8610,8613,8615,8618,8620,
+	8623,8625,8628,8630,8633,8635,8638,8640,
+	8643,8645,8648,8650,8653,8655,8658,8660,
+	8663,8665,8668,8670,8673,8675,8678,8680,
+	8683,8685,8688,8690,8693,8695,8698,8700,
+	8703,8705,8708,8710,8713,8715,8718,8720,
+	8723,8725,8728,8730,8733,8736,8738,8741,
+	8743,8746,8748,8751,8753,8756,8758,8761,
+	8763,8766,8768,8771,8773,8776,8779,8781,
+	8784,8786,8789,8791,8794,8796,8799,8801,
+	8804,8806,8809,8812,8814,8817,8819,8822,
+	8824,8827,8829,8832,8834,8837,8840,8842,
+	8845,8847,8850,8852,8855,8857,8860,8863,
+	8865,8868,8870,8873,8875,8878,8881,8883,
+	8886,8888,8891,8893,8896,8898,8901,8904,
+	8906,8909,8911,8914,8916,8919,8922,8924,
+	8927,8929,8932,8935,8937,8940,8942,8945,
+	8947,8950,8953,8955,8958,8960,8963,8966,
+	8968,8971,8973,8976,8979,8981,8984,8986,
+	8989,8991,8994,8997,8999,9002,9004,9007,
+	9010,9012,9015,9017,9020,9023,9025,9028,
+	9031,9033,9036,9038,9041,9044,9046,9049,
+	9051,9054,9057,9059,9062,9064,9067,9070,
+	9072,9075,9078,9080,9083,9085,9088,9091,
+	9093,9096,9099,9101,9104,9106,9109,9112,
+	9114,9117,9120,9122,9125,9128,9130,9133,
+	9135,9138,9141,9143,9146,9149,9151,9154,
+	9157,9159,9162,9165,9167,9170,9172,9175,
+	9178,9180,9183,9186,9188,9191,9194,9196,
+	9199,9202,9204,9207,9210,9212,9215,9218,
+	9220,9223,9226,9228,9231,9234,9236,9239,
+	9242,9244,9247,9250,9252,9255,9258,9260,
+	9263,9266,9268,9271,9274,9276,9279,9282,
+	9284,9287,9290,9292,9295,9298,9300,9303,
+	9306,9309,9311,9314,9317,9319,9322,9325,
+	9327,9330,9333,9335,9338,9341,9344,9346,
+	9349,9352,9354,9357,9360,9362,9365,9368,
+	9371,9373,9376,9379,9381,9384,9387,9390,
+	9392,9395,9398,9400,9403,9406,9409,9411,
+	9414,9417,9419,9422,9425,9428,9430,9433,
+	9436,9438,9441,9444,9447,9449,9452,9455,
+	9458,9460,9463,9466,9469,9471,9474,9477,
+	9479,9482,9485,9488,9490,9493,9496,9499,
+	9501,9504,9507,9510,9512,9515,9518,9521,
+	9523,9526,9529,9532,9534,9537,9540,9543,
+	9545,9548,9551,9554,9556,9559,9562,9565,
+	9567,9570,9573,9576,9579,9581,9584,9587,
+	9590,9592,9595,9598,9601,9603,9606,9609,
+	9612,9615,9617,9620,9623,9626,9628,9631,
+	9634,9637,9640,9642,9645,9648,9651,9654,
+	9656,9659,9662,9665,9667,9670,9673,9676,
+	9679,9681,9684,9687,9690,9693,9695,9698,
+	9701,9704,9707,9709,9712,9715,9718,9721,
+	9723,9726,9729,9732,9735,9738,9740,9743,
+	9746,9749,9752,9754,9757,9760,9763,9766,
+	9768,9771,9774,9777,9780,9783,9785,9788,
+	9791,9794,9797,9800,9802,9805,9808,9811,
+	9814,9817,9819,9822,9825,9828,9831,9834,
+	9836,9839,9842,9845,9848,9851,9853,9856,
+	9859,9862,9865,9868,9871,9873,9876,9879,
+	9882,9885,9888,9891,9893,9896,9899,9902,
+	9905,9908,9911,9913,9916,9919,9922,9925,
+	9928,9931,9933,9936,9939,9942,9945,9948,
+	9951,9954,9956,9959,9962,9965,9968,9971,
+	9974,9977,9979,9982,9985,9988,9991,9994,
+	9997,10000,10003,10005,10008,10011,10014,10017,
+	10020,10023,10026,10029,10032,10034,10037,10040,
+	10043,10046,10049,10052,10055,10058,10061,10063,
+	10066,10069,10072,10075,10078,10081,10084,10087,
+	10090,10093,10095,10098,10101,10104,10107,10110,
+	10113,10116,10119,10122,10125,10128,10130,10133,
+	10136,10139,10142,10145,10148,10151,10154,10157,
+	10160,10163,10166,10169,10172,10174,10177,10180,
+	10183,10186,10189,10192,10195,10198,10201,10204,
+	10207,10210,10213,10216,10219,10222,10225,10228,
+	10230,10233,10236,10239,10242,10245,10248,10251,
+	10254,10257,10260,10263,10266,10269,10272,10275,
+	10278,10281,10284,10287,10290,10293,10296,10299,
+	10302,10305,10308,10311,10314,10317,10319,10322,
+	10325,10328,10331,10334,10337,10340,10343,10346,
+	10349,10352,10355,10358,10361,10364,10367,10370,
+	10373,10376,10379,10382,10385,10388,10391,10394,
+	10397,10400,10403,10406,10409,10412,10415,10418,
+	10421,10424,10427,10430,10433,10436,10439,10442,
+	10445,10448,10451,10454,10457,10461,10464,10467,
+	10470,10473,10476,10479,10482,10485,10488,10491,
+	10494,10497,10500,10503,10506,10509,10512,10515,
+	10518,10521,10524,10527,10530,10533,10536,10539,
+	10542,10545,10548,10552,10555,10558,10561,10564,
+	10567,10570,10573,10576,10579,10582,10585,10588,
+	10591,10594,10597,10600,10603,10607,10610,10613,
+	10616,10619,10622,10625,10628,10631,10634,10637,
+	10640,10643,10646,10649,10653,10656,10659,10662,
+	10665,10668,10671,10674,10677,10680,10683,10686,
+	10690,10693,10696,10699,10702,10705,10708,10711,
+	10714,10717,10720,10724,10727,10730,10733,10736,
+	10739,10742,10745,10748,10751,10755,10758,10761,
+	10764,10767,10770,10773,10776,10779,10783,10786,
+	10789,10792,10795,10798,10801,10804,10808,10811,
+	10814,10817,10820,10823,10826,10829,10833,10836,
+	10839,10842,10845,10848,10851,10854,10858,10861,
+	10864,10867,10870,10873,10876,10880,10883,10886,
+	10889,10892,10895,10898,10902,10905,10908,10911,
+	10914,10917,10920,10924,10927,10930,10933,10936,
+	10939,10943,10946,10949,10952,10955,10958,10962,
+	10965,10968,10971,10974,10977,10981,10984,10987,
+	10990,10993,10996,11000,11003,11006,11009,11012,
+	11015,11019,11022,11025,11028,11031,11035,11038,
+	11041,11044,11047,11051,11054,11057,11060,11063,
+	11066,11070,11073,11076,11079,11082,11086,11089,
+	11092,11095,11099,11102,11105,11108,11111,11115,
+	11118,11121,11124,11127,11131,11134,11137,11140,
+	11143,11147,11150,11153,11156,11160,11163,11166,
+	11169,11172,11176,11179,11182,11185,11189,11192,
+	11195,11198,11202,11205,11208,11211,11214,11218,
+	11221,11224,11227,11231,11234,11237,11240,11244,
+	11247,11250,11253,11257,11260,11263,11266,11270,
+	11273,11276,11279,11283,11286,11289,11292,11296,
+	11299,11302,11306,11309,11312,11315,11319,11322,
+	11325,11328,11332,11335,11338,11342,11345,11348,
+	11351,11355,11358,11361,11364,11368,11371,11374,
+	11378,11381,11384,11387,11391,11394,11397,11401,
+	11404,11407,11411,11414,11417,11420,11424,11427,
+	11430,11434,11437,11440,11444,11447,11450,11453,
+	11457,11460,11463,11467,11470,11473,11477,11480,
+	11483,11487,11490,11493,11497,11500,11503,11506,
+	11510,11513,11516,11520,11523,11526,11530,11533,
+	11536,11540,11543,11546,11550,11553,11556,11560,
+	11563,11566,11570,11573,11576,11580,11583,11587,
+	11590,11593,11597,11600,11603,11607,11610,11613,
+	11617,11620,11623,11627,11630,11633,11637,11640,
+	11644,11647,11650,11654,11657,11660,11664,11667,
+	11670,11674,11677,11681,11684,11687,11691,11694,
+	11697,11701,11704,11708,11711,11714,11718,11721,
+	11725,11728,11731,11735,11738,11741,11745,11748,
+	11752,11755,11758,11762,11765,11769,11772,11775,
+	11779,11782,11786,11789,11792,11796,11799,11803,
+	11806,11809,11813,11816,11820,11823,11827,11830,
+	11833,11837,11840,11844,11847,11850,11854,11857,
+	11861,11864,11868,11871,11874,11878,11881,11885,
+	11888,11892,11895,11898,11902,11905,11909,11912,
+	11916,11919,11923,11926,11929,11933,11936,11940,
+	11943,11947,11950,11954,11957,11960,11964,11967,
+	11971,11974,11978,11981,11985,11988,11992,11995,
+	11999,12002,12005,12009,12012,12016,12019,12023,
+	12026,12030,12033,12037,12040,12044,12047,12051,
+	12054,12058,12061,12065,12068,12072,12075,12079,
+	12082,12085,12089,12092,12096,12099,12103,12106,
+	12110,12113,12117,12120,12124,12127,12131,12134,
+	12138,12141,12145,12148,12152,12156,12159,12163,
+	12166,12170,12173,12177,12180,12184,12187,12191,
+	12194,12198,12201,12205,12208,12212,12215,12219,
+	12222,12226,12229,12233,12237,12240,12244,12247,
+	12251,12254,12258,12261,12265,12268,12272,12275,
+	12279,12283,12286,12290,12293,12297,12300,12304,
+	12307,12311,12315,12318,12322,12325,12329,12332,
+	12336,12339,12343,12347,12350,12354,12357,12361,
+	12364,12368,12372,12375,12379,12382,12386,12389,
+	12393,12397,12400,12404,12407,12411,12414,12418,
+	12422,12425,12429,12432,12436,12440,12443,12447,
+	12450,12454,12458,12461,12465,12468,12472,12476,
+	12479,12483,12486,12490,12494,12497,12501,12504,
+	12508,12512,12515,12519,12523,12526,12530,12533,
+	12537,12541,12544,12548,12551,12555,12559,12562,
+	12566,12570,12573,12577,12581,12584,12588,12591,
+	12595,12599,12602,12606,12610,12613,12617,12621,
+	12624,12628,12631,12635,12639,12642,12646,12650,
+	12653,12657,12661,12664,12668,12672,12675,12679,
+	12683,12686,12690,12694,12697,12701,12705,12708,
+	12712,12716,12719,12723,12727,12730,12734,12738,
+	12741,12745,12749,12752,12756,12760,12763,12767,
+	12771,12775,12778,12782,12786,12789,12793,12797,
+	12800,12804,12808,12812,12815,12819,12823,12826,
+	12830,12834,12837,12841,12845,12849,12852,12856,
+	12860,12863,12867,12871,12875,12878,12882,12886,
+	12889,12893,12897,12901,12904,12908,12912,12916,
+	12919,12923,12927,12930,12934,12938,12942,12945,
+	12949,12953,12957,12960,12964,12968,12972,12975,
+	12979,12983,12987,12990,12994,12998,13002,13005,
+	13009,13013,13017,13020,13024,13028,13032,13035,
+	13039,13043,13047,13051,13054,13058,13062,13066,
+	13069,13073,13077,13081,13084,13088,13092,13096,
+	13100,13103,13107,13111,13115,13119,13122,13126,
+	13130,13134,13137,13141,13145,13149,13153,13156,
+	13160,13164,13168,13172,13175,13179,13183,13187,
+	13191,13195,13198,13202,13206,13210,13214,13217,
+	13221,13225,13229,13233,13236,13240,13244,13248,
+	13252,13256,13259,13263,13267,13271,13275,13279,
+	13282,13286,13290,13294,13298,13302,13305,13309,
+	13313,13317,13321,13325,13329,13332,13336,13340,
+	13344,13348,13352,13356,13359,13363,13367,13371,
+	13375,13379,13383,13386,13390,13394,13398,13402,
+	13406,13410,13414,13417,13421,13425,13429,13433,
+	13437,13441,13445,13448,13452,13456,13460,13464,
+	13468,13472,13476,13480,13483,13487,13491,13495,
+	13499,13503,13507,13511,13515,13519,13522,13526,
+	13530,13534,13538,13542,13546,13550,13554,13558,
+	13562,13565,13569,13573,13577,13581,13585,13589,
+	13593,13597,13601,13605,13609,13613,13616,13620,
+	13624,13628,13632,13636,13640,13644,13648,13652,
+	13656,13660,13664,13668,13672,13676,13680,13683,
+	13687,13691,13695,13699,13703,13707,13711,13715,
+	13719,13723,13727,13731,13735,13739,13743,13747,
+	13751,13755,13759,13763,13767,13771,13775,13779,
+	13783,13787,13791,13795,13799,13803,13807,13811,
+	13815,13819,13823,13826,13830,13834,13838,13842,
+	13846,13850,13854,13858,13862,13866,13870,13874,
+	13879,13883,13887,13891,13895,13899,13903,13907,
+	13911,13915,13919,13923,13927,13931,13935,13939,
+	13943,13947,13951,13955,13959,13963,13967,13971,
+	13975,13979,13983,13987,13991,13995,13999,14003,
+	14007,14011,14015,14020,14024,14028,14032,14036,
+	14040,14044,14048,14052,14056,14060,14064,14068,
+	14072,14076,14080,14084,14089,14093,14097,14101,
+	14105,14109,14113,14117,14121,14125,14129,14133,
+	14137,14141,14146,14150,14154,14158,14162,14166,
+	14170,14174,14178,14182,14186,14191,14195,14199,
+	14203,14207,14211,14215,14219,14223,14228,14232,
+	14236,14240,14244,14248,14252,14256,14260,14265,
+	14269,14273,14277,14281,14285,14289,14293,14298,
+	14302,14306,14310,14314,14318,14322,14326,14331,
+	14335,14339,14343,14347,14351,14355,14360,14364,
+	14368,14372,14376,14380,14385,14389,14393,14397,
+	14401,14405,14409,14414,14418,14422,14426,14430,
+	14434,14439,14443,14447,14451,14455,14459,14464,
+	14468,14472,14476,14480,14485,14489,14493,14497,
+	14501,14506,14510,14514,14518,14522,14526,14531,
+	14535,14539,14543,14547,14552,14556,14560,14564,
+	14568,14573,14577,14581,14585,14590,14594,14598,
+	14602,14606,14611,14615,14619,14623,14627,14632,
+	14636,14640,14644,14649,14653,14657,14661,14666,
+	14670,14674,14678,14683,14687,14691,14695,14699,
+	14704,14708,14712,14716,14721,14725,14729,14733,
+	14738,14742,14746,14751,14755,14759,14763,14768,
+	14772,14776,14780,14785,14789,14793,14797,14802,
+	14806,14810,14815,14819,14823,14827,14832,14836,
+	14840,14845,14849,14853,14857,14862,14866,14870,
+	14875,14879,14883,14887,14892,14896,14900,14905,
+	14909,14913,14918,14922,14926,14931,14935,14939,
+	14943,14948,14952,14956,14961,14965,14969,14974,
+	14978,14982,14987,14991,14995,15000,15004,15008,
+	15013,15017,15021,15026,15030,15034,15039,15043,
+	15047,15052,15056,15060,15065,15069,15074,15078,
+	15082,15087,15091,15095,15100,15104,15108,15113,
+	15117,15121,15126,15130,15135,15139,15143,15148,
+	15152,15156,15161,15165,15170,15174,15178,15183,
+	15187,15192,15196,15200,15205,15209,15213,15218,
+	15222,15227,15231,15235,15240,15244,15249,15253,
+	15257,15262,15266,15271,15275,15280,15284,15288,
+	15293,15297,15302,15306,15310,15315,15319,15324,
+	15328,15333,15337,15341,15346,15350,15355,15359,
+	15364,15368,15372,15377,15381,15386,15390,15395,
+	15399,15404,15408,15412,15417,15421,15426,15430,
+	15435,15439,15444,15448,15453,15457,15462,15466,
+	15470,15475,15479,15484,15488,15493,15497,15502,
+	15506,15511,15515,15520,15524,15529,15533,15538,
+	15542,15547,15551,15556,15560,15565,15569,15574,
+	15578,15583,15587,15592,15596,15601,15605,15610,
+	15614,15619,15623,15628,15632,15637,15641,15646,
+	15650,15655,15659,15664,15668,15673,15677,15682,
+	15686,15691,15695,15700,15705,15709,15714,15718,
+	15723,15727,15732,15736,15741,15745,15750,15754,
+	15759,15764,15768,15773,15777,15782,15786,15791,
+	15795,15800,15805,15809,15814,15818,15823,15827,
+	15832,15837,15841,15846,15850,15855,15859,15864,
+	15869,15873,15878,15882,15887,15892,15896,15901,
+	15905,15910,15915,15919,15924,15928,15933,15938,
+	15942,15947,15951,15956,15961,15965,15970,15974,
+	15979,15984,15988,15993,15997,16002,16007,16011,
+	16016,16021,16025,16030,16034,16039,16044,16048,
+	16053,16058,16062,16067,16072,16076,16081,16086,
+	16090,16095,16099,16104,16109,16113,16118,16123,
+	16127,16132,16137,16141,16146,16151,16155,16160,
+	16165,16169,16174,16179,16183,16188,16193,16197,
+	16202,16207,16211,16216,16221,16225,16230,16235,
+	16240,16244,16249,16254,16258,16263,16268,16272,
+	16277,16282,16287,16291,16296,16301,16305,16310,
+	16315,16319,16324,16329,16334,16338,16343,16348,
+	16352,16357,16362,16367,16371,16376,16381,16386,
+	16390,16395,16400,16405,16409,16414,16419,16423,
+	16428,16433,16438,16442,16447,16452,16457,16461,
+	16466,16471,16476,16481,16485,16490,16495,16500,
+	16504,16509,16514,16519,16523,16528,16533,16538,
+	16543,16547,16552,16557,16562,16566,16571,16576,
+	16581,16586,16590,16595,16600,16605,16610,16614,
+	16619,16624,16629,16634,16638,16643,16648,16653,
+	16658,16662,16667,16672,16677,16682,16686,16691,
+	16696,16701,16706,16711,16715,16720,16725,16730,
+	16735,16740,16744,16749,16754,16759,16764,16769,
+	16773,16778,16783,16788,16793,16798,16803,16807,
+	16812,16817,16822,16827,16832,16837,16841,16846,
+	16851,16856,16861,16866,16871,16875,16880,16885,
+	16890,16895,16900,16905,16910,16914,16919,16924,
+	16929,16934,16939,16944,16949,16954,16959,16963,
+	16968,16973,16978,16983,16988,16993,16998,17003,
+	17008,17012,17017,17022,17027,17032,17037,17042,
+	17047,17052,17057,17062,17067,17072,17076,17081,
+	17086,17091,17096,17101,17106,17111,17116,17121,
+	17126,17131,17136,17141,17146,17151,17156,17161,
+	17165,17170,17175,17180,17185,17190,17195,17200,
+	17205,17210,17215,17220,17225,17230,17235,17240,
+	17245,17250,17255,17260,17265,17270,17275,17280,
+	17285,17290,17295,17300,17305,17310,17315,17320,
+	17325,17330,17335,17340,17345,17350,17355,17360,
+	17365,17370,17375,17380,17385,17390,17395,17400,
+	17405,17410,17415,17420,17425,17430,17435,17440,
+	17445,17450,17455,17460,17466,17471,17476,17481,
+	17486,17491,17496,17501,17506,17511,17516,17521,
+	17526,17531,17536,17541,17546,17551,17557,17562,
+	17567,17572,17577,17582,17587,17592,17597,17602,
+	17607,17612,17617,17623,17628,17633,17638,17643,
+	17648,17653,17658,17663,17668,17674,17679,17684,
+	17689,17694,17699,17704,17709,17714,17720,17725,
+	17730,17735,17740,17745,17750,17755,17761,17766,
+	17771,17776,17781,17786,17791,17796,17802,17807,
+	17812,17817,17822,17827,17832,17838,17843,17848,
+	17853,17858,17863,17869,17874,17879,17884,17889,
+	17894,17900,17905,17910,17915,17920,17925,17931,
+	17936,17941,17946,17951,17957,17962,17967,17972,
+	17977,17982,17988,17993,17998,18003,18008,18014,
+	18019,18024,18029,18034,18040,18045,18050,18055,
+	18061,18066,18071,18076,18081,18087,18092,18097,
+	18102,18108,18113,18118,18123,18128,18134,18139,
+	18144,18149,18155,18160,18165,18170,18176,18181,
+	18186,18191,18197,18202,18207,18212,18218,18223,
+	18228,18233,18239,18244,18249,18255,18260,18265,
+	18270,18276,18281,18286,18291,18297,18302,18307,
+	18313,18318,18323,18329,18334,18339,18344,18350,
+	18355,18360,18366,18371,18376,18382,18387,18392,
+	18397,18403,18408,18413,18419,18424,18429,18435,
+	18440,18445,18451,18456,18461,18467,18472,18477,
+	18483,18488,18493,18499,18504,18509,18515,18520,
+	18525,18531,18536,18541,18547,18552,18558,18563,
+	18568,18574,18579,18584,18590,18595,18600,18606,
+	18611,18617,18622,18627,18633,18638,18643,18649,
+	18654,18660,18665,18670,18676,18681,18687,18692,
+	18697,18703,18708,18714,18719,18724,18730,18735,
+	18741,18746,18751,18757,18762,18768,18773,18779,
+	18784,18789,18795,18800,18806,18811,18817,18822,
+	18827,18833,18838,18844,18849,18855,18860,18866,
+	18871,18876,18882,18887,18893,18898,18904,18909,
+	18915,18920,18926,18931,18937,18942,18947,18953,
+	18958,18964,18969,18975,18980,18986,18991,18997,
+	19002,19008,19013,19019,19024,19030,19035,19041,
+	19046,19052,19057,19063,19068,19074,19079,19085,
+	19090,19096,19101,19107,19112,19118,19123,19129,
+	19134,19140,19145,19151,19157,19162,19168,19173,
+	19179,19184,19190,19195,19201,19206,19212,19218,
+	19223,19229,19234,19240,19245,19251,19256,19262,
+	19268,19273,19279,19284,19290,19295,19301,19307,
+	19312,19318,19323,19329,19334,19340,19346,19351,
+	19357,19362,19368,19374,19379,19385,19390,19396,
+	19402,19407,19413,19418,19424,19430,19435,19441,
+	19446,19452,19458,19463,19469,19475,19480,19486,
+	19491,19497,19503,19508,19514,19520,19525,19531,
+	19536,19542,19548,19553,19559,19565,19570,19576,
+	19582,19587,19593,19599,19604,19610,19616,19621,
+	19627,19633,19638,19644,19650,19655,19661,19667,
+	19672,19678,19684,19689,19695,19701,19706,19712,
+	19718,19724,19729,19735,19741,19746,19752,19758,
+	19763,19769,19775,19781,19786,19792,19798,19803,
+	19809,19815,19821,19826,19832,19838,19844,19849,
+	19855,19861,19866,19872,19878,19884,19889,19895,
+	19901,19907,19912,19918,19924,19930,19935,19941,
+	19947,19953,19958,19964,19970,19976,19982,19987,
+	19993,19999,20005,20010,20016,20022,20028,20034,
+	20039,20045,20051,20057,20063,20068,20074,20080,
+	20086,20092,20097,20103,20109,20115,20121,20126,
+	20132,20138,20144,20150,20155,20161,20167,20173,
+	20179,20185,20190,20196,20202,20208,20214,20220,
+	20225,20231,20237,20243,20249,20255,20260,20266,
+	20272,20278,20284,20290,20296,20301,20307,20313,
+	20319,20325,20331,20337,20343,20348,20354,20360,
+	20366,20372,20378,20384,20390,20396,20401,20407,
+	20413,20419,20425,20431,20437,20443,20449,20455,
+	20460,20466,20472,20478,20484,20490,20496,20502,
+	20508,20514,20520,20526,20531,20537,20543,20549,
+	20555,20561,20567,20573,20579,20585,20591,20597,
+	20603,20609,20615,20621,20627,20633,20638,20644,
+	20650,20656,20662,20668,20674,20680,20686,20692,
+	20698,20704,20710,20716,20722,20728,20734,20740,
+	20746,20752,20758,20764,20770,20776,20782,20788,
+	20794,20800,20806,20812,20818,20824,20830,20836,
+	20842,20848,20854,20860,20866,20872,20878,20884,
+	20890,20896,20902,20908,20914,20921,20927,20933,
+	20939,20945,20951,20957,20963,20969,20975,20981,
+	20987,20993,20999,21005,21011,21017,21023,21030,
+	21036,21042,21048,21054,21060,21066,21072,21078,
+	21084,21090,21096,21103,21109,21115,21121,21127,
+	21133,21139,21145,21151,21157,21164,21170,21176,
+	21182,21188,21194,21200,21206,21213,21219,21225,
+	21231,21237,21243,21249,21255,21262,21268,21274,
+	21280,21286,21292,21298,21305,21311,21317,21323,
+	21329,21335,21342,21348,21354,21360,21366,21372,
+	21379,21385,21391,21397,21403,21409,21416,21422,
+	21428,21434,21440,21447,21453,21459,21465,21471,
+	21478,21484,21490,21496,21502,21509,21515,21521,
+	21527,21534,21540,21546,21552,21558,21565,21571,
+	21577,21583,21590,21596,21602,21608,21615,21621,
+	21627,21633,21639,21646,21652,21658,21665,21671,
+	21677,21683,21690,21696,21702,21708,21715,21721,
+	21727,21733,21740,21746,21752,21759,21765,21771,
+	21777,21784,21790,21796,21803,21809,21815,21821,
+	21828,21834,21840,21847,21853,21859,21866,21872,
+	21878,21885,21891,21897,21904,21910,21916,21923,
+	21929,21935,21942,21948,21954,21961,21967,21973,
+	21980,21986,21992,21999,22005,22011,22018,22024,
+	22030,22037,22043,22050,22056,22062,22069,22075,
+	22081,22088,22094,22101,22107,22113,22120,22126,
+	22132,22139,22145,22152,22158,22164,22171,22177,
+	22184,22190,22197,22203,22209,22216,22222,22229,
+	22235,22241,22248,22254,22261,22267,22274,22280,
+	22286,22293,22299,22306,22312,22319,22325,22332,
+	22338,22344,22351,22357,22364,22370,22377,22383,
+	22390,22396,22403,22409,22416,22422,22428,22435,
+	22441,22448,22454,22461,22467,22474,22480,22487,
+	22493,22500,22506,22513,22519,22526,22532,22539,
+	22545,22552,22558,22565,22571,22578,22584,22591,
+	22598,22604,22611,22617,22624,22630,22637,22643,
+	22650,22656,22663,22669,22676,22683,22689,22696,
+	22702,22709,22715,22722,22728,22735,22742,22748,
+	22755,22761,22768,22774,22781,22788,22794,22801,
+	22807,22814,22821,22827,22834,22840,22847,22854,
+	22860,22867,22873,22880,22887,22893,22900,22906,
+	22913,22920,22926,22933,22939,22946,22953,22959,
+	22966,22973,22979,22986,22993,22999,23006,23012,
+	23019,23026,23032,23039,23046,23052,23059,23066,
+	23072,23079,23086,23092,23099,23106,23112,23119,
+	23126,23132,23139,23146,23152,23159,23166,23173,
+	23179,23186,23193,23199,23206,23213,23219,23226,
+	23233,23240,23246,23253,23260,23266,23273,23280,
+	23287,23293,23300,23307,23313,23320,23327,23334,
+	23340,23347,23354,23361,23367,23374,23381,23388,
+	23394,23401,23408,23415,23421,23428,23435,23442,
+	23449,23455,23462,23469,23476,23482,23489,23496,
+	23503,23510,23516,23523,23530,23537,23544,23550,
+	23557,23564,23571,23578,23584,23591,23598,23605,
+	23612,23618,23625,23632,23639,23646,23653,23659,
+	23666,23673,23680,23687,23694,23700,23707,23714,
+	23721,23728,23735,23742,23748,23755,23762,23769,
+	23776,23783,23790,23796,23803,23810,23817,23824,
+	23831,23838,23845,23852,23858,23865,23872,23879,
+	23886,23893,23900,23907,23914,23920,23927,23934,
+	23941,23948,23955,23962,23969,23976,23983,23990,
+	23997,24004,24010,24017,24024,24031,24038,24045,
+	24052,24059,24066,24073,24080,24087,24094,24101,
+	24108,24115,24122,24129,24136,24143,24150,24157,
+	24164,24170,24177,24184,24191,24198,24205,24212,
+	24219,24226,24233,24240,24247,24254,24261,24268,
+	24275,24282,24289,24296,24303,24311,24318,24325,
+	24332,24339,24346,24353,24360,24367,24374,24381,
+	24388,24395,24402,24409,24416,24423,24430,24437,
+	24444,24451,24458,24465,24473,24480,24487,24494,
+	24501,24508,24515,24522,24529,24536,24543,24550,
+	24557,24565,24572,24579,24586,24593,24600,24607,
+	24614,24621,24629,24636,24643,24650,24657,24664,
+	24671,24678,24685,24693,24700,24707,24714,24721,
+	24728,24735,24743,24750,24757,24764,24771,24778,
+	24785,24793,24800,24807,24814,24821,24828,24836,
+	24843,24850,24857,24864,24872,24879,24886,24893,
+	24900,24907,24915,24922,24929,24936,24943,24951,
+	24958,24965,24972,24980,24987,24994,25001,25008,
+	25016,25023,25030,25037,25045,25052,25059,25066,
+	25073,25081,25088,25095,25102,25110,25117,25124,
+	25131,25139,25146,25153,25161,25168,25175,25182,
+	25190,25197,25204,25211,25219,25226,25233,25241,
+	25248,25255,25262,25270,25277,25284,25292,25299,
+	25306,25314,25321,25328,25336,25343,25350,25357,
+	25365,25372,25379,25387,25394,25401,25409,25416,
+	25423,25431,25438,25446,25453,25460,25468,25475,
+	25482,25490,25497,25504,25512,25519,25526,25534,
+	25541,25549,25556,25563,25571,25578,25586,25593,
+	25600,25608,25615,25623,25630,25637,25645,25652,
+	25660,25667,25674,25682,25689,25697,25704,25711,
+	25719,25726,25734,25741,25749,25756,25763,25771,
+	25778,25786,25793,25801,25808,25816,25823,25831,
+	25838,25845,25853,25860,25868,25875,25883,25890,
+	25898,25905,25913,25920,25928,25935,25943,25950,
+	25958,25965,25973,25980,25988,25995,26003,26010,
+	26018,26025,26033,26040,26048,26055,26063,26070,
+	26078,26085,26093,26101,26108,26116,26123,26131,
+	26138,26146,26153,26161,26168,26176,26184,26191,
+	26199,26206,26214,26221,26229,26237,26244,26252,
+	26259,26267,26274,26282,26290,26297,26305,26312,
+	26320,26328,26335,26343,26350,26358,26366,26373,
+	26381,26389,26396,26404,26411,26419,26427,26434,
+	26442,26450,26457,26465,26472,26480,26488,26495,
+	26503,26511,26518,26526,26534,26541,26549,26557,
+	26564,26572,26580,26587,26595,26603,26610,26618,
+	26626,26634,26641,26649,26657,26664,26672,26680,
+	26687,26695,26703,26711,26718,26726,26734,26741,
+	26749,26757,26765,26772,26780,26788,26796,26803,
+	26811,26819,26827,26834,26842,26850,26858,26865,
+	26873,26881,26889,26896,26904,26912,26920,26927,
+	26935,26943,26951,26959,26966,26974,26982,26990,
+	26998,27005,27013,27021,27029,27037,27044,27052,
+	27060,27068,27076,27083,27091,27099,27107,27115,
+	27123,27130,27138,27146,27154,27162,27170,27177,
+	27185,27193,27201,27209,27217,27225,27232,27240,
+	27248,27256,27264,27272,27280,27288,27295,27303,
+	27311,27319,27327,27335,27343,27351,27359,27366,
+	27374,27382,27390,27398,27406,27414,27422,27430,
+	27438,27446,27454,27461,27469,27477,27485,27493,
+	27501,27509,27517,27525,27533,27541,27549,27557,
+	27565,27573,27581,27589,27597,27605,27613,27621,
+	27629,27637,27645,27652,27660,27668,27676,27684,
+	27692,27700,27708,27716,27724,27732,27740,27748,
+	27757,27765,27773,27781,27789,27797,27805,27813,
+	27821,27829,27837,27845,27853,27861,27869,27877,
+	27885,27893,27901,27909,27917,27925,27933,27942,
+	27950,27958,27966,27974,27982,27990,27998,28006,
+	28014,28022,28030,28039,28047,28055,28063,28071,
+	28079,28087,28095,28103,28111,28120,28128,28136,
+	28144,28152,28160,28168,28177,28185,28193,28201,
+	28209,28217,28225,28234,28242,28250,28258,28266,
+	28274,28282,28291,28299,28307,28315,28323,28332,
+	28340,28348,28356,28364,28372,28381,28389,28397,
+	28405,28413,28422,28430,28438,28446,28455,28463,
+	28471,28479,28487,28496,28504,28512,28520,28529,
+	28537,28545,28553,28562,28570,28578,28586,28595,
+	28603,28611,28619,28628,28636,28644,28652,28661,
+	28669,28677,28686,28694,28702,28710,28719,28727,
+	28735,28744,28752,28760,28769,28777,28785,28793,
+	28802,28810,28818,28827,28835,28843,28852,28860,
+	28868,28877,28885,28893,28902,28910,28918,28927,
+	28935,28944,28952,28960,28969,28977,28985,28994,
+	29002,29011,29019,29027,29036,29044,29052,29061,
+	29069,29078,29086,29094,29103,29111,29120,29128,
+	29136,29145,29153,29162,29170,29179,29187,29195,
+	29204,29212,29221,29229,29238,29246,29254,29263,
+	29271,29280,29288,29297,29305,29314,29322,29331,
+	29339,29348,29356,29365,29373,29382,29390,29398,
+	29407,29415,29424,29432,29441,29449,29458,29466,
+	29475,29484,29492,29501,29509,29518,29526,29535,
+	29543,29552,29560,29569,29577,29586,29594,29603,
+	29612,29620,29629,29637,29646,29654,29663,29671,
+	29680,29689,29697,29706,29714,29723,29731,29740,
+	29749,29757,29766,29774,29783,29792,29800,29809,
+	29817,29826,29835,29843,29852,29861,29869,29878,
+	29886,29895,29904,29912,29921,29930,29938,29947,
+	29956,29964,29973,29982,29990,29999,30008,30016,
+	30025,30034,30042,30051,30060,30068,30077,30086,
+	30094,30103,30112,30120,30129,30138,30147,30155,
+	30164,30173,30181,30190,30199,30208,30216,30225,
+	30234,30242,30251,30260,30269,30277,30286,30295,
+	30304,30312,30321,30330,30339,30347,30356,30365,
+	30374,30383,30391,30400,30409,30418,30426,30435,
+	30444,30453,30462,30470,30479,30488,30497,30506,
+	30514,30523,30532,30541,30550,30559,30567,30576,
+	30585,30594,30603,30612,30620,30629,30638,30647,
+	30656,30665,30673,30682,30691,30700,30709,30718,
+	30727,30736,30744,30753,30762,30771,30780,30789,
+	30798,30807,30816,30824,30833,30842,30851,30860,
+	30869,30878,30887,30896,30905,30914,30923,30931,
+	30940,30949,30958,30967,30976,30985,30994,31003,
+	31012,31021,31030,31039,31048,31057,31066,31075,
+	31084,31093,31102,31111,31120,31129,31138,31147,
+	31156,31165,31174,31183,31192,31201,31210,31219,
+	31228,31237,31246,31255,31264,31273,31282,31291,
+	31300,31309,31318,31327,31336,31345,31354,31363,
+	31372,31381,31390,31399,31409,31418,31427,31436,
+	31445,31454,31463,31472,31481,31490,31499,31508,
+	31518,31527,31536,31545,31554,31563,31572,31581,
+	31590,31600,31609,31618,31627,31636,31645,31654,
+	31664,31673,31682,31691,31700,31709,31718,31728,
+	31737,31746,31755,31764,31773,31783,31792,31801,
+	31810,31819,31829,31838,31847,31856,31865,31875,
+	31884,31893,31902,31911,31921,31930,31939,31948,
+	31958,31967,31976,31985,31994,32004,32013,32022,
+	32031,32041,32050,32059,32068,32078,32087,32096,
+	32106,32115,32124,32133,32143,32152,32161,32171,
+	32180,32189,32198,32208,32217,32226,32236,32245,
+	32254,32264,32273,32282,32292,32301,32310,32320,
+	32329,32338,32348,32357,32366,32376,32385,32394,
+	32404,32413,32422,32432,32441,32450,32460,32469,
+	32479,32488,32497,32507,32516,32526,32535,32544,
+	32554,32563,32573,32582,32591,32601,32610,32620,
+	32629,32638,32648,32657,32667,32676,32686,32695,
+	32704,32714,32723,32733,32742,32752,32761,32771,
+	32780,32790,32799,32809,32818,32828,32837,32846,
+	32856,32865,32875,32884,32894,32903,32913,32922,
+	32932,32941,32951,32961,32970,32980,32989,32999,
+	33008,33018,33027,33037,33046,33056,33065,33075,
+	33085,33094,33104,33113,33123,33132,33142,33151,
+	33161,33171,33180,33190,33199,33209,33219,33228,
+	33238,33247,33257,33267,33276,33286,33295,33305,
+	33315,33324,33334,33343,33353,33363,33372,33382,
+	33392,33401,33411,33421,33430,33440,33450,33459,
+	33469,33479,33488,33498,33508,33517,33527,33537,
+	33546,33556,33566,33575,33585,33595,33605,33614,
+	33624,33634,33643,33653,33663,33673,33682,33692,
+	33702,33711,33721,33731,33741,33750,33760,33770,
+	33780,33789,33799,33809,33819,33828,33838,33848,
+	33858,33868,33877,33887,33897,33907,33917,33926,
+	33936,33946,33956,33966,33975,33985,33995,34005,
+	34015,34024,34034,34044,34054,34064,34074,34083,
+	34093,34103,34113,34123,34133,34143,34152,34162,
+	34172,34182,34192,34202,34212,34222,34231,34241,
+	34251,34261,34271,34281,34291,34301,34311,34321,
+	34330,34340,34350,34360,34370,34380,34390,34400,
+	34410,34420,34430,34440,34450,34460,34470,34479,
+	34489,34499,34509,34519,34529,34539,34549,34559,
+	34569,34579,34589,34599,34609,34619,34629,34639,
+	34649,34659,34669,34679,34689,34699,34709,34719,
+	34729,34739,34749,34759,34769,34780,34790,34800,
+	34810,34820,34830,34840,34850,34860,34870,34880,
+	34890,34900,34910,34920,34931,34941,34951,34961,
+	34971,34981,34991,35001,35011,35021,35032,35042,
+	35052,35062,35072,35082,35092,35102,35113,35123,
+	35133,35143,35153,35163,35173,35184,35194,35204,
+	35214,35224,35234,35245,35255,35265,35275,35285,
+	35296,35306,35316,35326,35336,35347,35357,35367,
+	35377,35387,35398,35408,35418,35428,35439,35449,
+	35459,35469,35480,35490,35500,35510,35521,35531,
+	35541,35551,35562,35572,35582,35592,35603,35613,
+	35623,35634,35644,35654,35664,35675,35685,35695,
+	35706,35716,35726,35737,35747,35757,35768,35778,
+	35788,35799,35809,35819,35830,35840,35850,35861,
+	35871,35881,35892,35902,35913,35923,35933,35944,
+	35954,35964,35975,35985,35996,36006,36016,36027,
+	36037,36048,36058,36068,36079,36089,36100,36110,
+	36121,36131,36141,36152,36162,36173,36183,36194,
+	36204,36215,36225,36235,36246,36256,36267,36277,
+	36288,36298,36309,36319,36330,36340,36351,36361,
+	36372,36382,36393,36403,36414,36424,36435,36445,
+	36456,36466,36477,36488,36498,36509,36519,36530,
+	36540,36551,36561,36572,36582,36593,36604,36614,
+	36625,36635,36646,36657,36667,36678,36688,36699,
+	36709,36720,36731,36741,36752,36763,36773,36784,
+	36794,36805,36816,36826,36837,36848,36858,36869,
+	36880,36890,36901,36911,36922,36933,36943,36954,
+	36965,36976,36986,36997,37008,37018,37029,37040,
+	37050,37061,37072,37082,37093,37104,37115,37125,
+	37136,37147,37157,37168,37179,37190,37200,37211,
+	37222,37233,37243,37254,37265,37276,37286,37297,
+	37308,37319,37330,37340,37351,37362,37373,37384,
+	37394,37405,37416,37427,37438,37448,37459,37470,
+	37481,37492,37502,37513,37524,37535,37546,37557,
+	37568,37578,37589,37600,37611,37622,37633,37644,
+	37654,37665,37676,37687,37698,37709,37720,37731,
+	37742,37752,37763,37774,37785,37796,37807,37818,
+	37829,37840,37851,37862,37873,37883,37894,37905,
+	37916,37927,37938,37949,37960,37971,37982,37993,
+	38004,38015,38026,38037,38048,38059,38070,38081,
+	38092,38103,38114,38125,38136,38147,38158,38169,
+	38180,38191,38202,38213,38224,38235,38246,38257,
+	38268,38279,38290,38302,38313,38324,38335,38346,
+	38357,38368,38379,38390,38401,38412,38423,38435,
+	38446,38457,38468,38479,38490,38501,38512,38523,
+	38535,38546,38557,38568,38579,38590,38601,38613,
+	38624,38635,38646,38657,38668,38679,38691,38702,
+	38713,38724,38735,38747,38758,38769,38780,38791,
+	38803,38814,38825,38836,38847,38859,38870,38881,
+	38892,38904,38915,38926,38937,38949,38960,38971,
+	38982,38994,39005,39016,39027,39039,39050,39061,
+	39072,39084,39095,39106,39118,39129,39140,39152,
+	39163,39174,39185,39197,39208,39219,39231,39242,
+	39253,39265,39276,39287,39299,39310,39322,39333,
+	39344,39356,39367,39378,39390,39401,39412,39424,
+	39435,39447,39458,39469,39481,39492,39504,39515,
+	39526,39538,39549,39561,39572,39584,39595,39606,
+	39618,39629,39641,39652,39664,39675,39687,39698,
+	39710,39721,39732,39744,39755,39767,39778,39790,
+	39801,39813,39824,39836,39847,39859,39870,39882,
+	39893,39905,39916,39928,39940,39951,39963,39974,
+	39986,39997,40009,40020,40032,40044,40055,40067,
+	40078,40090,40101,40113,40125,40136,40148,40159,
+	40171,40183,40194,40206,40217,40229,40241,40252,
+	40264,40275,40287,40299,40310,40322,40334,40345,
+	40357,40369,40380,40392,40404,40415,40427,40439,
+	40450,40462,40474,40485,40497,40509,40520,40532,
+	40544,40556,40567,40579,40591,40602,40614,40626,
+	40638,40649,40661,40673,40685,40696,40708,40720,
+	40732,40743,40755,40767,40779,40791,40802,40814,
+	40826,40838,40849,40861,40873,40885,40897,40909,
+	40920,40932,40944,40956,40968,40979,40991,41003,
+	41015,41027,41039,41051,41062,41074,41086,41098,
+	41110,41122,41134,41145,41157,41169,41181,41193,
+	41205,41217,41229,41241,41253,41265,41276,41288,
+	41300,41312,41324,41336,41348,41360,41372,41384,
+	41396,41408,41420,41432,41444,41456,41468,41480,
+	41492,41504,41516,41528,41540,41552,41564,41576,
+	41588,41600,41612,41624,41636,41648,41660,41672,
+	41684,41696,41708,41720,41732,41744,41756,41768,
+	41780,41792,41804,41816,41828,41841,41853,41865,
+	41877,41889,41901,41913,41925,41937,41949,41962,
+	41974,41986,41998,42010,42022,42034,42046,42059,
+	42071,42083,42095,42107,42119,42132,42144,42156,
+	42168,42180,42192,42205,42217,42229,42241,42253,
+	42266,42278,42290,42302,42314,42327,42339,42351,
+	42363,42376,42388,42400,42412,42425,42437,42449,
+	42461,42474,42486,42498,42510,42523,42535,42547,
+	42560,42572,42584,42596,42609,42621,42633,42646,
+	42658,42670,42683,42695,42707,42720,42732,42744,
+	42757,42769,42781,42794,42806,42818,42831,42843,
+	42856,42868,42880,42893,42905,42918,42930,42942,
+	42955,42967,42980,42992,43004,43017,43029,43042,
+	43054,43067,43079,43091,43104,43116,43129,43141,
+	43154,43166,43179,43191,43204,43216,43229,43241,
+	43254,43266,43278,43291,43304,43316,43329,43341,
+	43354,43366,43379,43391,43404,43416,43429,43441,
+	43454,43466,43479,43492,43504,43517,43529,43542,
+	43554,43567,43580,43592,43605,43617,43630,43642,
+	43655,43668,43680,43693,43706,43718,43731,43743,
+	43756,43769,43781,43794,43807,43819,43832,43845,
+	43857,43870,43883,43895,43908,43921,43933,43946,
+	43959,43971,43984,43997,44010,44022,44035,44048,
+	44060,44073,44086,44099,44111,44124,44137,44150,
+	44162,44175,44188,44201,44213,44226,44239,44252,
+	44264,44277,44290,44303,44316,44328,44341,44354,
+	44367,44380,44393,44405,44418,44431,44444,44457,
+	44470,44482,44495,44508,44521,44534,44547,44560,
+	44572,44585,44598,44611,44624,44637,44650,44663,
+	44675,44688,44701,44714,44727,44740,44753,44766,
+	44779,44792,44805,44818,44831,44844,44856,44869,
+	44882,44895,44908,44921,44934,44947,44960,44973,
+	44986,44999,45012,45025,45038,45051,45064,45077,
+	45090,45103,45116,45129,45142,45155,45168,45182,
+	45195,45208,45221,45234,45247,45260,45273,45286,
+	45299,45312,45325,45338,45351,45365,45378,45391,
+	45404,45417,45430,45443,45456,45470,45483,45496,
+	45509,45522,45535,45548,45562,45575,45588,45601,
+	45614,45627,45641,45654,45667,45680,45693,45707,
+	45720,45733,45746,45759,45773,45786,45799,45812,
+	45825,45839,45852,45865,45878,45892,45905,45918,
+	45931,45945,45958,45971,45985,45998,46011,46024,
+	46038,46051,46064,46078,46091,46104,46118,46131,
+	46144,46158,46171,46184,46198,46211,46224,46238,
+	46251,46264,46278,46291,46304,46318,46331,46345,
+	46358,46371,46385,46398,46412,46425,46438,46452,
+	46465,46479,46492,46505,46519,46532,46546,46559,
+	46573,46586,46600,46613,46626,46640,46653,46667,
+	46680,46694,46707,46721,46734,46748,46761,46775,
+	46788,46802,46815,46829,46842,46856,46869,46883,
+	46897,46910,46924,46937,46951,46964,46978,46991,
+	47005,47019,47032,47046,47059,47073,47087,47100,
+	47114,47127,47141,47155,47168,47182,47195,47209,
+	47223,47236,47250,47264,47277,47291,47305,47318,
+	47332,47346,47359,47373,47387,47400,47414,47428,
+	47441,47455,47469,47483,47496,47510,47524,47537,
+	47551,47565,47579,47592,47606,47620,47634,47647,
+	47661,47675,47689,47703,47716,47730,47744,47758,
+	47771,47785,47799,47813,47827,47840,47854,47868,
+	47882,47896,47910,47923,47937,47951,47965,47979,
+	47993,48007,48020,48034,48048,48062,48076,48090,
+	48104,48118,48132,48145,48159,48173,48187,48201,
+	48215,48229,48243,48257,48271,48285,48299,48313,
+	48327,48340,48354,48368,48382,48396,48410,48424,
+	48438,48452,48466,48480,48494,48508,48522,48536,
+	48550,48564,48578,48592,48606,48621,48635,48649,
+	48663,48677,48691,48705,48719,48733,48747,48761,
+	48775,48789,48803,48818,48832,48846,48860,48874,
+	48888,48902,48916,48930,48945,48959,48973,48987,
+	49001,49015,49029,49044,49058,49072,49086,49100,
+	49114,49129,49143,49157,49171,49185,49200,49214,
+	49228,49242,49257,49271,49285,49299,49313,49328,
+	49342,49356,49370,49385,49399,49413,49428,49442,
+	49456,49470,49485,49499,49513,49528,49542,49556,
+	49570,49585,49599,49613,49628,49642,49656,49671,
+	49685,49700,49714,49728,49743,49757,49771,49786,
+	49800,49814,49829,49843,49858,49872,49886,49901,
+	49915,49930,49944,49959,49973,49987,50002,50016,
+	50031,50045,50060,50074,50089,50103,50118,50132,
+	50146,50161,50175,50190,50204,50219,50233,50248,
+	50262,50277,50292,50306,50321,50335,50350,50364,
+	50379,50393,50408,50422,50437,50452,50466,50481,
+	50495,50510,50524,50539,50554,50568,50583,50597,
+	50612,50627,50641,50656,50671,50685,50700,50714,
+	50729,50744,50758,50773,50788,50802,50817,50832,
+	50846,50861,50876,50891,50905,50920,50935,50949,
+	50964,50979,50994,51008,51023,51038,51052,51067,
+	51082,51097,51111,51126,51141,51156,51171,51185,
+	51200,51215,51230,51245,51259,51274,51289,51304,
+	51319,51333,51348,51363,51378,51393,51408,51422,
+	51437,51452,51467,51482,51497,51512,51526,51541,
+	51556,51571,51586,51601,51616,51631,51646,51661,
+	51676,51690,51705,51720,51735,51750,51765,51780,
+	51795,51810,51825,51840,51855,51870,51885,51900,
+	51915,51930,51945,51960,51975,51990,52005,52020,
+	52035,52050,52065,52080,52095,52110,52125,52140,
+	52155,52170,52185,52201,52216,52231,52246,52261,
+	52276,52291,52306,52321,52336,52352,52367,52382,
+	52397,52412,52427,52442,52457,52473,52488,52503,
+	52518,52533,52548,52564,52579,52594,52609,52624,
+	52640,52655,52670,52685,52700,52716,52731,52746,
+	52761,52777,52792,52807,52822,52838,52853,52868,
+	52883,52899,52914,52929,52944,52960,52975,52990,
+	53006,53021,53036,53052,53067,53082,53098,53113,
+	53128,53144,53159,53174,53190,53205,53220,53236,
+	53251,53267,53282,53297,53313,53328,53344,53359,
+	53374,53390,53405,53421,53436,53452,53467,53482,
+	53498,53513,53529,53544,53560,53575,53591,53606,
+	53622,53637,53653,53668,53684,53699,53715,53730,
+	53746,53761,53777,53792,53808,53823,53839,53854,
+	53870,53886,53901,53917,53932,53948,53963,53979,
+	53995,54010,54026,54041,54057,54073,54088,54104,
+	54119,54135,54151,54166,54182,54198,54213,54229,
+	54245,54260,54276,54292,54307,54323,54339,54354,
+	54370,54386,54402,54417,54433,54449,54464,54480,
+	54496,54512,54527,54543,54559,54575,54590,54606,
+	54622,54638,54653,54669,54685,54701,54717,54732,
+	54748,54764,54780,54796,54812,54827,54843,54859,
+	54875,54891,54907,54922,54938,54954,54970,54986,
+	55002,55018,55034,55050,55065,55081,55097,55113,
+	55129,55145,55161,55177,55193,55209,55225,55241,
+	55257,55273,55289,55304,55320,55336,55352,55368,
+	55384,55400,55416,55432,55448,55464,55480,55496,
+	55513,55529,55545,55561,55577,55593,55609,55625,
+	55641,55657,55673,55689,55705,55721,55737,55754,
+	55770,55786,55802,55818,55834,55850,55866,55883,
+	55899,55915,55931,55947,55963,55979,55996,56012,
+	56028,56044,56060,56077,56093,56109,56125,56141,
+	56158,56174,56190,56206,56222,56239,56255,56271,
+	56287,56304,56320,56336,56353,56369,56385,56401,
+	56418,56434,56450,56467,56483,56499,56515,56532,
+	56548,56564,56581,56597,56614,56630,56646,56663,
+	56679,56695,56712,56728,56744,56761,56777,56794,
+	56810,56826,56843,56859,56876,56892,56909,56925,
+	56941,56958,56974,56991,57007,57024,57040,57057,
+	57073,57090,57106,57123,57139,57156,57172,57189,
+	57205,57222,57238,57255,57271,57288,57304,57321,
+	57338,57354,57371,57387,57404,57420,57437,57454,
+	57470,57487,57503,57520,57537,57553,57570,57586,
+	57603,57620,57636,57653,57670,57686,57703,57720,
+	57736,57753,57770,57786,57803,57820,57836,57853,
+	57870,57887,57903,57920,57937,57954,57970,57987,
+	58004,58021,58037,58054,58071,58088,58104,58121,
+	58138,58155,58172,58188,58205,58222,58239,58256,
+	58272,58289,58306,58323,58340,58357,58373,58390,
+	58407,58424,58441,58458,58475,58492,58508,58525,
+	58542,58559,58576,58593,58610,58627,58644,58661,
+	58678,58695,58712,58729,58746,58763,58779,58796,
+	58813,58830,58847,58864,58881,58898,58915,58932,
+	58949,58967,58984,59001,59018,59035,59052,59069,
+	59086,59103,59120,59137,59154,59171,59188,59205,
+	59223,59240,59257,59274,59291,59308,59325,59342,
+	59360,59377,59394,59411,59428,59445,59462,59480,
+	59497,59514,59531,59548,59566,59583,59600,59617,
+	59634,59652,59669,59686,59703,59721,59738,59755,
+	59772,59790,59807,59824,59841,59859,59876,59893,
+	59911,59928,59945,59963,59980,59997,60015,60032,
+	60049,60067,60084,60101,60119,60136,60153,60171,
+	60188,60206,60223,60240,60258,60275,60293,60310,
+	60327,60345,60362,60380,60397,60415,60432,60449,
+	60467,60484,60502,60519,60537,60554,60572,60589,
+	60607,60624,60642,60659,60677,60694,60712,60729,
+	60747,60765,60782,60800,60817,60835,60852,60870,
+	60887,60905,60923,60940,60958,60975,60993,61011,
+	61028,61046,61064,61081,61099,61117,61134,61152,
+	61169,61187,61205,61223,61240,61258,61276,61293,
+	61311,61329,61346,61364,61382,61400,61417,61435,
+	61453,61471,61488,61506,61524,61542,61559,61577,
+	61595,61613,61631,61648,61666,61684,61702,61720,
+	61737,61755,61773,61791,61809,61827,61845,61862,
+	61880,61898,61916,61934,61952,61970,61988,62005,
+	62023,62041,62059,62077,62095,62113,62131,62149,
+	62167,62185,62203,62221,62239,62257,62275,62293,
+	62311,62329,62347,62365,62383,62401,62419,62437,
+	62455,62473,62491,62509,62527,62545,62563,62581,
+	62599,62617,62635,62654,62672,62690,62708,62726,
+	62744,62762,62780,62798,62817,62835,62853,62871,
+	62889,62907,62926,62944,62962,62980,62998,63016,
+	63035,63053,63071,63089,63108,63126,63144,63162,
+	63180,63199,63217,63235,63253,63272,63290,63308,
+	63327,63345,63363,63382,63400,63418,63436,63455,
+	63473,63491,63510,63528,63546,63565,63583,63602,
+	63620,63638,63657,63675,63693,63712,63730,63749,
+	63767,63785,63804,63822,63841,63859,63878,63896,
+	63915,63933,63952,63970,63988,64007,64025,64044,
+	64062,64081,64099,64118,64136,64155,64174,64192,
+	64211,64229,64248,64266,64285,64303,64322,64341,
+	64359,64378,64396,64415,64434,64452,64471,64489,
+	64508,64527,64545,64564,64583,64601,64620,64639,
+	64657,64676,64695,64713,64732,64751,64769,64788,
+	64807,64826,64844,64863,64882,64900,64919,64938,
+	64957,64975,64994,65013,65032,65051,65069,65088,
+	65107,65126,65145,65163,65182,65201,65220,65239,
+	65258,65276,65295,65314,65333,65352,65371,65390,
+	65408,65427,65446,65465,65484,65503,65522,65541,
+	65560,65579,65598,65617,65636,65655,65674,65692,
+	65711,65730,65749,65768,65787,65806,65825,65844,
+	65863,65882,65902,65921,65940,65959,65978,65997,
+	66016,66035,66054,66073,66092,66111,66130,66149,
+	66169,66188,66207,66226,66245,66264,66283,66302,
+	66322,66341,66360,66379,66398,66417,66437,66456,
+	66475,66494,66513,66533,66552,66571,66590,66609,
+	66629,66648,66667,66686,66706,66725,66744,66764,
+	66783,66802,66821,66841,66860,66879,66899,66918,
+	66937,66957,66976,66995,67015,67034,67053,67073,
+	67092,67112,67131,67150,67170,67189,67209,67228,
+	67247,67267,67286,67306,67325,67345,67364,67383,
+	67403,67422,67442,67461,67481,67500,67520,67539,
+	67559,67578,67598,67617,67637,67656,67676,67696,
+	67715,67735,67754,67774,67793,67813,67833,67852,
+	67872,67891,67911,67931,67950,67970,67989,68009,
+	68029,68048,68068,68088,68107,68127,68147,68166,
+	68186,68206,68225,68245,68265,68285,68304,68324,
+	68344,68364,68383,68403,68423,68443,68462,68482,
+	68502,68522,68541,68561,68581,68601,68621,68641,
+	68660,68680,68700,68720,68740,68760,68779,68799,
+	68819,68839,68859,68879,68899,68919,68939,68958,
+	68978,68998,69018,69038,69058,69078,69098,69118,
+	69138,69158,69178,69198,69218,69238,69258,69278,
+	69298,69318,69338,69358,69378,69398,69418,69438,
+	69458,69478,69498,69518,69538,69559,69579,69599,
+	69619,69639,69659,69679,69699,69719,69740,69760,
+	69780,69800,69820,69840,69861,69881,69901,69921,
+	69941,69961,69982,70002,70022,70042,70063,70083,
+	70103,70123,70144,70164,70184,70204,70225,70245,
+	70265,70286,70306,70326,70346,70367,70387,70407,
+	70428,70448,70468,70489,70509,70530,70550,70570,
+	70591,70611,70631,70652,70672,70693,70713,70734,
+	70754,70774,70795,70815,70836,70856,70877,70897,
+	70918,70938,70959,70979,71000,71020,71041,71061,
+	71082,71102,71123,71143,71164,71184,71205,71226,
+	71246,71267,71287,71308,71328,71349,71370,71390,
+	71411,71432,71452,71473,71493,71514,71535,71555,
+	71576,71597,71617,71638,71659,71679,71700,71721,
+	71742,71762,71783,71804,71825,71845,71866,71887,
+	71908,71928,71949,71970,71991,72011,72032,72053,
+	72074,72095,72116,72136,72157,72178,72199,72220,
+	72241,72261,72282,72303,72324,72345,72366,72387,
+	72408,72429,72450,72470,72491,72512,72533,72554,
+	72575,72596,72617,72638,72659,72680,72701,72722,
+	72743,72764,72785,72806,72827,72848,72869,72890,
+	72911,72932,72953,72975,72996,73017,73038,73059,
+	73080,73101,73122,73143,73164,73186,73207,73228,
+	73249,73270,73291,73313,73334,73355,73376,73397,
+	73418,73440,73461,73482,73503,73525,73546,73567,
+	73588,73610,73631,73652,73673,73695,73716,73737,
+	73759,73780,73801,73822,73844,73865,73886,73908,
+	73929,73951,73972,73993,74015,74036,74057,74079,
+	74100,74122,74143,74164,74186,74207,74229,74250,
+	74272,74293,74314,74336,74357,74379,74400,74422,
+	74443,74465,74486,74508,74529,74551,74572,74594,
+	74616,74637,74659,74680,74702,74723,74745,74767,
+	74788,74810,74831,74853,74875,74896,74918,74940,
+	74961,74983,75004,75026,75048,75069,75091,75113,
+	75135,75156,75178,75200,75221,75243,75265,75287,
+	75308,75330,75352,75374,75395,75417,75439,75461,
+	75483,75504,75526,75548,75570,75592,75613,75635,
+	75657,75679,75701,75723,75745,75766,75788,75810,
+	75832,75854,75876,75898,75920,75942,75964,75986,
+	76008,76030,76051,76073,76095,76117,76139,76161,
+	76183,76205,76227,76249,76271,76293,76316,76338,
+	76360,76382,76404,76426,76448,76470,76492,76514,
+	76536,76558,76580,76603,76625,76647,76669,76691,
+	76713,76735,76758,76780,76802,76824,76846,76869,
+	76891,76913,76935,76957,76980,77002,77024,77046,
+	77069,77091,77113,77135,77158,77180,77202,77225,
+	77247,77269,77292,77314,77336,77358,77381,77403,
+	77426,77448,77470,77493,77515,77537,77560,77582,
+	77605,77627,77649,77672,77694,77717,77739,77762,
+	77784,77807,77829,77852,77874,77897,77919,77942,
+	77964,77987,78009,78032,78054,78077,78099,78122,
+	78144,78167,78190,78212,78235,78257,78280,78303,
+	78325,78348,78370,78393,78416,78438,78461,78484,
+	78506,78529,78552,78574,78597,78620,78643,78665,
+	78688,78711,78733,78756,78779,78802,78824,78847,
+	78870,78893,78916,78938,78961,78984,79007,79030,
+	79052,79075,79098,79121,79144,79167,79190,79212,
+	79235,79258,79281,79304,79327,79350,79373,79396,
+	79419,79441,79464,79487,79510,79533,79556,79579,
+	79602,79625,79648,79671,79694,79717,79740,79763,
+	79786,79809,79832,79856,79879,79902,79925,79948,
+	79971,79994,80017,80040,80063,80087,80110,80133,
+	80156,80179,80202,80225,80249,80272,80295,80318,
+	80341,80365,80388,80411,80434,80457,80481,80504,
+	80527,80550,80574,80597,80620,80644,80667,80690,
+	80713,80737,80760,80783,80807,80830,80853,80877,
+	80900,80924,80947,80970,80994,81017,81040,81064,
+	81087,81111,81134,81158,81181,81204,81228,81251,
+	81275,81298,81322,81345,81369,81392,81416,81439,
+	81463,81486,81510,81533,81557,81581,81604,81628,
+	81651,81675,81698,81722,81746,81769,81793,81817,
+	81840,81864,81887,81911,81935,81958,81982,82006,
+	82029,82053,82077,82101,82124,82148,82172,82195,
+	82219,82243,82267,82290,82314,82338,82362,82386,
+	82409,82433,82457,82481,82505,82529,82552,82576,
+	82600,82624,82648,82672,82696,82719,82743,82767,
+	82791,82815,82839,82863,82887,82911,82935,82959,
+	82983,83007,83031,83055,83079,83103,83127,83151,
+	83175,83199,83223,83247,83271,83295,83319,83343,
+	83367,83391,83415,83439,83463,83487,83512,83536,
+	83560,83584,83608,83632,83656,83681,83705,83729,
+	83753,83777,83801,83826,83850,83874,83898,83923,
+	83947,83971,83995,84020,84044,84068,84092,84117,
+	84141,84165,84190,84214,84238,84263,84287,84311,
+	84336,84360,84384,84409,84433,84458,84482,84506,
+	84531,84555,84580,84604,84628,84653,84677,84702,
+	84726,84751,84775,84800,84824,84849,84873,84898,
+	84922,84947,84971,84996,85020,85045,85070,85094,
+	85119,85143,85168,85192,85217,85242,85266,85291,
+	85316,85340,85365,85390,85414,85439,85464,85488,
+	85513,85538,85562,85587,85612,85636,85661,85686,
+	85711,85735,85760,85785,85810,85835,85859,85884,
+	85909,85934,85959,85983,86008,86033,86058,86083,
+	86108,86133,86157,86182,86207,86232,86257,86282,
+	86307,86332,86357,86382,86407,86432,86457,86482,
+	86507,86532,86556,86581,86607,86632,86657,86682,
+	86707,86732,86757,86782,86807,86832,86857,86882,
+	86907,86932,86957,86983,87008,87033,87058,87083,
+	87108,87133,87159,87184,87209,87234,87259,87284,
+	87310,87335,87360,87385,87411,87436,87461,87486,
+	87512,87537,87562,87588,87613,87638,87663,87689,
+	87714,87739,87765,87790,87815,87841,87866,87892,
+	87917,87942,87968,87993,88019,88044,88069,88095,
+	88120,88146,88171,88197,88222,88248,88273,88299,
+	88324,88350,88375,88401,88426,88452,88477,88503,
+	88528,88554,88580,88605,88631,88656,88682,88708,
+	88733,88759,88785,88810,88836,88862,88887,88913,
+	88939,88964,88990,89016,89041,89067,89093,89119,
+	89144,89170,89196,89222,89247,89273,89299,89325,
+	89350,89376,89402,89428,89454,89480,89505,89531,
+	89557,89583,89609,89635,89661,89687,89712,89738,
+	89764,89790,89816,89842,89868,89894,89920,89946,
+	89972,89998,90024,90050,90076,90102,90128,90154,
+	90180,90206,90232,90258,90284,90310,90336,90363,
+	90389,90415,90441,90467,90493,90519,90545,90572,
+	90598,90624,90650,90676,90702,90729,90755,90781,
+	90807,90834,90860,90886,90912,90939,90965,90991,
+	91017,91044,91070,91096,91123,91149,91175,91202,
+	91228,91254,91281,91307,91333,91360,91386,91413,
+	91439,91465,91492,91518,91545,91571,91598,91624,
+	91650,91677,91703,91730,91756,91783,91809,91836,
+	91862,91889,91916,91942,91969,91995,92022,92048,
+	92075,92102,92128,92155,92181,92208,92235,92261,
+	92288,92315,92341,92368,92395,92421,92448,92475,
+	92501,92528,92555,92582,92608,92635,92662,92689,
+	92715,92742,92769,92796,92823,92849,92876,92903,
+	92930,92957,92984,93010,93037,93064,93091,93118,
+	93145,93172,93199,93226,93252,93279,93306,93333,
+	93360,93387,93414,93441,93468,93495,93522,93549,
+	93576,93603,93630,93657,93684,93711,93738,93766,
+	93793,93820,93847,93874,93901,93928,93955,93982,
+	94010,94037,94064,94091,94118,94145,94173,94200,
+	94227,94254,94282,94309,94336,94363,94390,94418,
+	94445,94472,94500,94527,94554,94582,94609,94636,
+	94663,94691,94718,94746,94773,94800,94828,94855,
+	94882,94910,94937,94965,94992,95020,95047,95074,
+	95102,95129,95157,95184,95212,95239,95267,95294,
+	95322,95349,95377,95405,95432,95460,95487,95515,
+	95542,95570,95598,95625,95653,95680,95708,95736,
+	95763,95791,95819,95846,95874,95902,95930,95957,
+	95985,96013,96040,96068,96096,96124,96151,96179,
+	96207,96235,96263,96290,96318,96346,96374,96402,
+	96430,96457,96485,96513,96541,96569,96597,96625,
+	96653,96680,96708,96736,96764,96792,96820,96848,
+	96876,96904,96932,96960,96988,97016,97044,97072,
+	97100,97128,97156,97184,97212,97241,97269,97297,
+	97325,97353,97381,97409,97437,97465,97494,97522,
+	97550,97578,97606,97635,97663,97691,97719,97747,
+	97776,97804,97832,97860,97889,97917,97945,97973,
+	98002,98030,98058,98087,98115,98143,98172,98200,
+	98228,98257,98285,98314,98342,98370,98399,98427,
+	98456,98484,98513,98541,98569,98598,98626,98655,
+	98683,98712,98740,98769,98797,98826,98855,98883,
+	98912,98940,98969,98997,99026,99055,99083,99112,
+	99140,99169,99198,99226,99255,99284,99312,99341,
+	99370,99399,99427,99456,99485,99513,99542,99571,
+	99600,99628,99657,99686,99715,99744,99772,99801,
+	99830,99859,99888,99917,99945,99974,100003,100032,
+	100061,100090,100119,100148,100177,100206,100235,100263,
+	100292,100321,100350,100379,100408,100437,100466,100495,
+	100524,100553,100583,100612,100641,100670,100699,100728,
+	100757,100786,100815,100844,100873,100903,100932,100961,
+	100990,101019,101048,101078,101107,101136,101165,101194,
+	101224,101253,101282,101311,101341,101370,101399,101428,
+	101458,101487,101516,101546,101575,101604,101634,101663,
+	101692,101722,101751,101781,101810,101839,101869,101898,
+	101928,101957,101987,102016,102046,102075,102104,102134,
+	102163,102193,102222,102252,102282,102311,102341,102370,
+	102400,102429,102459,102489,102518,102548,102577,102607,
+	102637,102666,102696,102726,102755,102785,102815,102844,
+	102874,102904,102934,102963,102993,103023,103052,103082,
+	103112,103142,103172,103201,103231,103261,103291,103321,
+	103351,103380,103410,103440,103470,103500,103530,103560,
+	103590,103620,103649,103679,103709,103739,103769,103799,
+	103829,103859,103889,103919,103949,103979,104009,104039,
+	104069,104099,104130,104160,104190,104220,104250,104280,
+	104310,104340,104370,104401,104431,104461,104491,104521,
+	104551,104582,104612,104642,104672,104703,104733,104763,
+	104793,104824,104854,104884,104914,104945,104975,105005,
+	105036,105066,105096,105127,105157,105187,105218,105248,
+	105279,105309,105339,105370,105400,105431,105461,105492,
+	105522,105553,105583,105614,105644,105675,105705,105736,
+	105766,105797,105827,105858,105888,105919,105950,105980,
+	106011,106042,106072,106103,106133,106164,106195,106225,
+	106256,106287,106318,106348,106379,106410,106440,106471,
+	106502,106533,106563,106594,106625,106656,106687,106717,
+	106748,106779,106810,106841,106872,106903,106933,106964,
+	106995,107026,107057,107088,107119,107150,107181,107212,
+	107243,107274,107305,107336,107367,107398,107429,107460,
+	107491,107522,107553,107584,107615,107646,107677,107708,
+	107739,107771,107802,107833,107864,107895,107926,107957,
+	107989,108020,108051,108082,108113,108145,108176,108207,
+	108238,108270,108301,108332,108364,108395,108426,108457,
+	108489,108520,108551,108583,108614,108646,108677,108708,
+	108740,108771,108803,108834,108865,108897,108928,108960,
+	108991,109023,109054,109086,109117,109149,109180,109212,
+	109243,109275,109306,109338,109370,109401,109433,109464,
+	109496,109528,109559,109591,109623,109654,109686,109718,
+	109749,109781,109813,109844,109876,109908,109940,109971,
+	110003,110035,110067,110099,110130,110162,110194,110226,
+	110258,110290,110321,110353,110385,110417,110449,110481,
+	110513,110545,110577,110608,110640,110672,110704,110736,
+	110768,110800,110832,110864,110896,110928,110960,110992,
+	111025,111057,111089,111121,111153,111185,111217,111249,
+	111281,111314,111346,111378,111410,111442,111474,111507,
+	111539,111571,111603,111635,111668,111700,111732,111765,
+	111797,111829,111861,111894,111926,111958,111991,112023,
+	112055,112088,112120,112153,112185,112217,112250,112282,
+	112315,112347,112379,112412,112444,112477,112509,112542,
+	112574,112607,112639,112672,112705,112737,112770,112802,
+	112835,112867,112900,112933,112965,112998,113030,113063,
+	113096,113128,113161,113194,113227,113259,113292,113325,
+	113357,113390,113423,113456,113488,113521,113554,113587,
+	113620,113652,113685,113718,113751,113784,113817,113850,
+	113882,113915,113948,113981,114014,114047,114080,114113,
+	114146,114179,114212,114245,114278,114311,114344,114377,
+	114410,114443,114476,114509,114542,114575,114608,114641,
+	114675,114708,114741,114774,114807,114840,114873,114907,
+	114940,114973,115006,115039,115073,115106,115139,115172,
+	115206,115239,115272,115306,115339,115372,115405,115439,
+	115472,115506,115539,115572,115606,115639,115672,115706,
+	115739,115773,115806,115840,115873,115907,115940,115974,
+	116007,116041,116074,116108,116141,116175,116208,116242,
+	116275,116309,116343,116376,116410,116443,116477,116511,
+	116544,116578,116612,116645,116679,116713,116746,116780,
+	116814,116848,116881,116915,116949,116983,117016,117050,
+	117084,117118,117152,117186,117219,117253,117287,117321,
+	117355,117389,117423,117457,117491,117525,117558,117592,
+	117626,117660,117694,117728,117762,117796,117830,117864,
+	117898,117933,117967,118001,118035,118069,118103,118137,
+	118171,118205,118239,118274,118308,118342,118376,118410,
+	118445,118479,118513,118547,118581,118616,118650,118684,
+	118719,118753,118787,118821,118856,118890,118924,118959,
+	118993,119028,119062,119096,119131,119165,119200,119234,
+	119268,119303,119337,119372,119406,119441,119475,119510,
+	119544,119579,119613,119648,119682,119717,119752,119786,
+	119821,119855,119890,119925,119959,119994,120029,120063,
+	120098,120133,120167,120202,120237,120272,120306,120341,
+	120376,120411,120445,120480,120515,120550,120585,120619,
+	120654,120689,120724,120759,120794,120829,120863,120898,
+	120933,120968,121003,121038,121073,121108,121143,121178,
+	121213,121248,121283,121318,121353,121388,121423,121458,
+	121493,121529,121564,121599,121634,121669,121704,121739,
+	121774,121810,121845,121880,121915,121950,121986,122021,
+	122056,122091,122127,122162,122197,122233,122268,122303,
+	122338,122374,122409,122445,122480,122515,122551,122586,
+	122621,122657,122692,122728,122763,122799,122834,122870,
+	122905,122941,122976,123012,123047,123083,123118,123154,
+	123189,123225,123261,123296,123332,123367,123403,123439,
+	123474,123510,123546,123581,123617,123653,123689,123724,
+	123760,123796,123831,123867,123903,123939,123975,124010,
+	124046,124082,124118,124154,124190,124226,124261,124297,
+	124333,124369,124405,124441,124477,124513,124549,124585,
+	124621,124657,124693,124729,124765,124801,124837,124873,
+	124909,124945,124981,125017,125053,125090,125126,125162,
+	125198,125234,125270,125307,125343,125379,125415,125451,
+	125488,125524,125560,125596,125633,125669,125705,125742,
+	125778,125814,125851,125887,125923,125960,125996,126032,
+	126069,126105,126142,126178,126215,126251,126287,126324,
+	126360,126397,126433,126470,126506,126543,126580,126616,
+	126653,126689,126726,126763,126799,126836,126872,126909,
+	126946,126982,127019,127056,127092,127129,127166,127203,
+	127239,127276,127313,127350,127386,127423,127460,127497,
+	127534,127570,127607,127644,127681,127718,127755,127792,
+	127829,127866,127903,127939,127976,128013,128050,128087,
+	128124,128161,128198,128235,128272,128309,128347,128384,
+	128421,128458,128495,128532,128569,128606,128643,128681,
+	128718,128755,128792,128829,128867,128904,128941,128978,
+	129016,129053,129090,129127,129165,129202,129239,129277,
+	129314,129351,129389,129426,129463,129501,129538,129576,
+	129613,129651,129688,129725,129763,129800,129838,129875,
+	129913,129950,129988,130025,130063,130101,130138,130176,
+	130213,130251,130289,130326,130364,130402,130439,130477,
+	130515,130552,130590,130628,130665,130703,130741,130779,
+	130816,130854,130892,130930,130968,131006,131043,131081,
+	131119,131157,131195,131233,131271,131309,131347,131384,
+	131422,131460,131498,131536,131574,131612,131650,131688,
+	131726,131764,131803,131841,131879,131917,131955,131993,
+	132031,132069,132107,132146,132184,132222,132260,132298,
+	132337,132375,132413,132451,132489,132528,132566,132604,
+	132643,132681,132719,132758,132796,132834,132873,132911,
+	132949,132988,133026,133065,133103,133142,133180,133218,
+	133257,133295,133334,133372,133411,133450,133488,133527,
+	133565,133604,133642,133681,133720,133758,133797,133836,
+	133874,133913,133952,133990,134029,134068,134106,134145,
+	134184,134223,134261,134300,134339,134378,134417,134455,
+	134494,134533,134572,134611,134650,134689,134728,134766,
+	134805,134844,134883,134922,134961,135000,135039,135078,
+	135117,135156,135195,135234,135273,135312,135352,135391,
+	135430,135469,135508,135547,135586,135625,135665,135704,
+	135743,135782,135821,135861,135900,135939,135978,136018,
+	136057,136096,136136,136175,136214,136254,136293,136332,
+	136372,136411,136450,136490,136529,136569,136608,136648,
+	136687,136727,136766,136806,136845,136885,136924,136964,
+	137003,137043,137082,137122,137162,137201,137241,137281,
+	137320,137360,137400,137439,137479,137519,137558,137598,
+	137638,137678,137717,137757,137797,137837,137877,137916,
+	137956,137996,138036,138076,138116,138156,138196,138235,
+	138275,138315,138355,138395,138435,138475,138515,138555,
+	138595,138635,138675,138715,138755,138796,138836,138876,
+	138916,138956,138996,139036,139076,139117,139157,139197,
+	139237,139277,139318,139358,139398,139438,139479,139519,
+	139559,139600,139640,139680,139721,139761,139801,139842,
+	139882,139922,139963,140003,140044,140084,140125,140165,
+	140206,140246,140287,140327,140368,140408,140449,140489,
+	140530,140571,140611,140652,140692,140733,140774,140814,
+	140855,140896,140936,140977,141018,141059,141099,141140,
+	141181,141222,141262,141303,141344,141385,141426,141467,
+	141507,141548,141589,141630,141671,141712,141753,141794,
+	141835,141876,141917,141958,141999,142040,142081,142122,
+	142163,142204,142245,142286,142327,142368,142409,142451,
+	142492,142533,142574,142615,142656,142698,142739,142780,
+	142821,142863,142904,142945,142986,143028,143069,143110,
+	143152,143193,143234,143276,143317,143358,143400,143441,
+	143483,143524,143566,143607,143649,143690,143732,143773,
+	143815,143856,143898,143939,143981,144022,144064,144106,
+	144147,144189,144231,144272,144314,144356,144397,144439,
+	144481,144522,144564,144606,144648,144690,144731,144773,
+	144815,144857,144899,144940,144982,145024,145066,145108,
+	145150,145192,145234,145276,145318,145360,145402,145444,
+	145486,145528,145570,145612,145654,145696,145738,145780,
+	145822,145864,145906,145949,145991,146033,146075,146117,
+	146160,146202,146244,146286,146328,146371,146413,146455,
+	146498,146540,146582,146625,146667,146709,146752,146794,
+	146836,146879,146921,146964,147006,147049,147091,147134,
+	147176,147219,147261,147304,147346,147389,147431,147474,
+	147517,147559,147602,147644,147687,147730,147772,147815,
+	147858,147901,147943,147986,148029,148071,148114,148157,
+	148200,148243,148285,148328,148371,148414,148457,148500,
+	148543,148586,148628,148671,148714,148757,148800,148843,
+	148886,148929,148972,149015,149058,149101,149144,149188,
+	149231,149274,149317,149360,149403,149446,149489,149533,
+	149576,149619,149662,149705,149749,149792,149835,149879,
+	149922,149965,150008,150052,150095,150138,150182,150225,
+	150269,150312,150355,150399,150442,150486,150529,150573,
+	150616,150660,150703,150747,150790,150834,150877,150921,
+	150965,151008,151052,151095,151139,151183,151226,151270,
+	151314,151358,151401,151445,151489,151532,151576,151620,
+	151664,151708,151751,151795,151839,151883,151927,151971,
+	152015,152059,152102,152146,152190,152234,152278,152322,
+	152366,152410,152454,152498,152542,152586,152631,152675,
+	152719,152763,152807,152851,152895,152939,152984,153028,
+	153072,153116,153160,153205,153249,153293,153337,153382,
+	153426,153470,153515,153559,153603,153648,153692,153737,
+	153781,153825,153870,153914,153959,154003,154048,154092,
+	154137,154181,154226,154270,154315,154359,154404,154449,
+	154493,154538,154583,154627,154672,154716,154761,154806,
+	154851,154895,154940,154985,155030,155074,155119,155164,
+	155209,155254,155298,155343,155388,155433,155478,155523,
+	155568,155613,155658,155703,155748,155793,155838,155883,
+	155928,155973,156018,156063,156108,156153,156198,156243,
+	156288,156333,156379,156424,156469,156514,156559,156605,
+	156650,156695,156740,156786,156831,156876,156922,156967,
+	157012,157058,157103,157148,157194,157239,157285,157330,
+	157375,157421,157466,157512,157557,157603,157648,157694,
+	157739,157785,157831,157876,157922,157967,158013,158059,
+	158104,158150,158196,158241,158287,158333,158379,158424,
+	158470,158516,158562,158607,158653,158699,158745,158791,
+	158837,158882,158928,158974,159020,159066,159112,159158,
+	159204,159250,159296,159342,159388,159434,159480,159526,
+	159572,159618,159664,159711,159757,159803,159849,159895,
+	159941,159988,160034,160080,160126,160173,160219,160265,
+	160311,160358,160404,160450,160497,160543,160589,160636,
+	160682,160729,160775,160821,160868,160914,160961,161007,
+	161054,161100,161147,161193,161240,161287,161333,161380,
+	161426,161473,161520,161566,161613,161660,161706,161753,
+	161800,161847,161893,161940,161987,162034,162080,162127,
+	162174,162221,162268,162315,162362,162408,162455,162502,
+	162549,162596,162643,162690,162737,162784,162831,162878,
+	162925,162972,163019,163066,163114,163161,163208,163255,
+	163302,163349,163396,163444,163491,163538,163585,163633,
+	163680,163727,163774,163822,163869,163916,163964,164011,
+	164058,164106,164153,164201,164248,164296,164343,164390,
+	164438,164485,164533,164580,164628,164676,164723,164771,
+	164818,164866,164914,164961,165009,165057,165104,165152,
+	165200,165247,165295,165343,165391,165438,165486,165534,
+	165582,165630,165677,165725,165773,165821,165869,165917,
+	165965,166013,166061,166109,166157,166205,166253,166301,
+	166349,166397,166445,166493,166541,166589,166637,166685,
+	166733,166782,166830,166878,166926,166974,167023,167071,
+	167119,167167,167216,167264,167312,167361,167409,167457,
+	167506,167554,167602,167651,167699,167748,167796,167845,
+	167893,167942,167990,168039,168087,168136,168184,168233,
+	168282,168330,168379,168427,168476,168525,168573,168622,
+	168671,168719,168768,168817,168866,168915,168963,169012,
+	169061,169110,169159,169207,169256,169305,169354,169403,
+	169452,169501,169550,169599,169648,169697,169746,169795,
+	169844,169893,169942,169991,170040,170089,170139,170188,
+	170237,170286,170335,170384,170434,170483,170532,170581,
+	170631,170680,170729,170779,170828,170877,170927,170976,
+	171025,171075,171124,171174,171223,171272,171322,171371,
+	171421,171470,171520,171570,171619,171669,171718,171768,
+	171817,171867,171917,171966,172016,172066,172115,172165,
+	172215,172265,172314,172364,172414,172464,172514,172563,
+	172613,172663,172713,172763,172813,172863,172913,172963,
+	173013,173063,173112,173162,173213,173263,173313,173363,
+	173413,173463,173513,173563,173613,173663,173713,173764,
+	173814,173864,173914,173965,174015,174065,174115,174166,
+	174216,174266,174317,174367,174417,174468,174518,174568,
+	174619,174669,174720,174770,174821,174871,174922,174972,
+	175023,175073,175124,175175,175225,175276,175326,175377,
+	175428,175478,175529,175580,175630,175681,175732,175783,
+	175833,175884,175935,175986,176037,176088,176138,176189,
+	176240,176291,176342,176393,176444,176495,176546,176597,
+	176648,176699,176750,176801,176852,176903,176954,177005,
+	177056,177108,177159,177210,177261,177312,177364,177415,
+	177466,177517,177569,177620,177671,177723,177774,177825,
+	177877,177928,177979,178031,178082,178134,178185,178237,
+	178288,178340,178391,178443,178494,178546,178597,178649,
+	178700,178752,178804,178855,178907,178959,179010,179062,
+	179114,179166,179217,179269,179321,179373,179424,179476,
+	179528,179580,179632,179684,179736,179788,179839,179891,
+	179943,179995,180047,180099,180151,180203,180255,180308,
+	180360,180412,180464,180516,180568,180620,180672,180725,
+	180777,180829,180881,180934,180986,181038,181090,181143,
+	181195,181247,181300,181352,181404,181457,181509,181562,
+	181614,181667,181719,181772,181824,181877,181929,181982,
+	182034,182087,182139,182192,182245,182297,182350,182403,
+	182455,182508,182561,182613,182666,182719,182772,182825,
+	182877,182930,182983,183036,183089,183142,183195,183247,
+	183300,183353,183406,183459,183512,183565,183618,183671,
+	183724,183777,183831,183884,183937,183990,184043,184096,
+	184149,184203,184256,184309,184362,184415,184469,184522,
+	184575,184629,184682,184735,184789,184842,184895,184949,
+	185002,185056,185109,185163,185216,185270,185323,185377,
+	185430,185484,185537,185591,185645,185698,185752,185805,
+	185859,185913,185967,186020,186074,186128,186181,186235,
+	186289,186343,186397,186451,186504,186558,186612,186666,
+	186720,186774,186828,186882,186936,186990,187044,187098,
+	187152,187206,187260,187314,187368,187422,187476,187531,
+	187585,187639,187693,187747,187802,187856,187910,187964,
+	188019,188073,188127,188182,188236,188290,188345,188399,
+	188454,188508,188563,188617,188671,188726,188780,188835,
+	188890,188944,188999,189053,189108,189163,189217,189272,
+	189326,189381,189436,189491,189545,189600,189655,189710,
+	189764,189819,189874,189929,189984,190039,190094,190148,
+	190203,190258,190313,190368,190423,190478,190533,190588,
+	190643,190698,190753,190809,190864,190919,190974,191029,
+	191084,191140,191195,191250,191305,191360,191416,191471,
+	191526,191582,191637,191692,191748,191803,191859,191914,
+	191969,192025,192080,192136,192191,192247,192302,192358,
+	192413,192469,192525,192580,192636,192691,192747,192803,
+	192859,192914,192970,193026,193081,193137,193193,193249,
+	193305,193360,193416,193472,193528,193584,193640,193696,
+	193752,193808,193864,193920,193976,194032,194088,194144,
+	194200,194256,194312,194368,194424,194481,194537,194593,
+	194649,194705,194762,194818,194874,194930,194987,195043,
+	195099,195156,195212,195269,195325,195381,195438,195494,
+	195551,195607,195664,195720,195777,195833,195890,195946,
+	196003,196060,196116,196173,196230,196286,196343,196400,
+	196456,196513,196570,196627,196684,196740,196797,196854,
+	196911,196968,197025,197082,197138,197195,197252,197309,
+	197366,197423,197480,197537,197594,197652,197709,197766,
+	197823,197880,197937,197994,198052,198109,198166,198223,
+	198280,198338,198395,198452,198510,198567,198624,198682,
+	198739,198797,198854,198911,198969,199026,199084,199141,
+	199199,199256,199314,199372,199429,199487,199544,199602,
+	199660,199717,199775,199833,199890,199948,200006,200064,
+	200121,200179,200237,200295,200353,200411,200469,200526,
+	200584,200642,200700,200758,200816,200874,200932,200990,
+	201048,201106,201165,201223,201281,201339,201397,201455,
+	201513,201572,201630,201688,201746,201805,201863,201921,
+	201980,202038,202096,202155,202213,202271,202330,202388,
+	202447,202505,202564,202622,202681,202739,202798,202856,
+	202915,202974,203032,203091,203150,203208,203267,203326,
+	203384,203443,203502,203561,203620,203678,203737,203796,
+	203855,203914,203973,204032,204091,204149,204208,204267,
+	204326,204385,204444,204504,204563,204622,204681,204740,
+	204799,204858,204917,204977,205036,205095,205154,205214,
+	205273,205332,205391,205451,205510,205569,205629,205688,
+	205748,205807,205867,205926,205985,206045,206104,206164,
+	206224,206283,206343,206402,206462,206522,206581,206641,
+	206701,206760,206820,206880,206940,206999,207059,207119,
+	207179,207239,207298,207358,207418,207478,207538,207598,
+	207658,207718,207778,207838,207898,207958,208018,208078,
+	208138,208198,208259,208319,208379,208439,208499,208560,
+	208620,208680,208740,208801,208861,208921,208982,209042,
+	209102,209163,209223,209284,209344,209405,209465,209525,
+	209586,209647,209707,209768,209828,209889,209950,210010,
+	210071,210131,210192,210253,210314,210374,210435,210496,
+	210557,210618,210678,210739,210800,210861,210922,210983,
+	211044,211105,211166,211227,211288,211349,211410,211471,
+	211532,211593,211654,211715,211776,211838,211899,211960,
+	212021,212083,212144,212205,212266,212328,212389,212450,
+	212512,212573,212635,212696,212757,212819,212880,212942,
+	213003,213065,213126,213188,213250,213311,213373,213434,
+	213496,213558,213619,213681,213743,213805,213866,213928,
+	213990,214052,214113,214175,214237,214299,214361,214423,
+	214485,214547,214609,214671,214733,214795,214857,214919,
+	214981,215043,215105,215167,215229,215292,215354,215416,
+	215478,215541,215603,215665,215727,215790,215852,215914,
+	215977,216039,216101,216164,216226,216289,216351,216414,
+	216476,216539,216601,216664,216727,216789,216852,216914,
+	216977,217040,217102,217165,217228,217291,217353,217416,
+	217479,217542,217605,217667,217730,217793,217856,217919,
+	217982,218045,218108,218171,218234,218297,218360,218423,
+	218486,218549,218612,218676,218739,218802,218865,218928,
+	218992,219055,219118,219181,219245,219308,219371,219435,
+	219498,219562,219625,219688,219752,219815,219879,219942,
+	220006,220069,220133,220197,220260,220324,220387,220451,
+	220515,220579,220642,220706,220770,220833,220897,220961,
+	221025,221089,221153,221216,221280,221344,221408,221472,
+	221536,221600,221664,221728,221792,221856,221920,221984,
+	222049,222113,222177,222241,222305,222369,222434,222498,
+	222562,222627,222691,222755,222820,222884,222948,223013,
+	223077,223142,223206,223270,223335,223399,223464,223529,
+	223593,223658,223722,223787,223852,223916,223981,224046,
+	224110,224175,224240,224305,224369,224434,224499,224564,
+	224629,224694,224758,224823,224888,224953,225018,225083,
+	225148,225213,225278,225343,225409,225474,225539,225604,
+	225669,225734,225799,225865,225930,225995,226060,226126,
+	226191,226256,226322,226387,226453,226518,226583,226649,
+	226714,226780,226845,226911,226976,227042,227108,227173,
+	227239,227304,227370,227436,227501,227567,227633,227699,
+	227764,227830,227896,227962,228028,228094,228159,228225,
+	228291,228357,228423,228489,228555,228621,228687,228753,
+	228819,228885,228952,229018,229084,229150,229216,229282,
+	229349,229415,229481,229547,229614,229680,229746,229813,
+	229879,229946,230012,230078,230145,230211,230278,230344,
+	230411,230477,230544,230611,230677,230744,230810,230877,
+	230944,231011,231077,231144,231211,231278,231344,231411,
+	231478,231545,231612,231679,231746,231813,231880,231947,
+	232014,232081,232148,232215,232282,232349,232416,232483,
+	232550,232617,232685,232752,232819,232886,232954,233021,
+	233088,233155,233223,233290,233358,233425,233492,233560,
+	233627,233695,233762,233830,233897,233965,234032,234100,
+	234168,234235,234303,234371,234438,234506,234574,234642,
+	234709,234777,234845,234913,234981,235049,235116,235184,
+	235252,235320,235388,235456,235524,235592,235660,235728,
+	235796,235865,235933,236001,236069,236137,236205,236274,
+	236342,236410,236478,236547,236615,236683,236752,236820,
+	236889,236957,237025,237094,237162,237231,237299,237368,
+	237437,237505,237574,237642,237711,237780,237848,237917,
+	237986,238055,238123,238192,238261,238330,238399,238467,
+	238536,238605,238674,238743,238812,238881,238950,239019,
+	239088,239157,239226,239295,239364,239434,239503,239572,
+	239641,239710,239780,239849,239918,239987,240057,240126,
+	240195,240265,240334,240404,240473,240543,240612,240682,
+	240751,240821,240890,240960,241029,241099,241169,241238,
+	241308,241378,241447,241517,241587,241657,241726,241796,
+	241866,241936,242006,242076,242146,242216,242286,242356,
+	242426,242496,242566,242636,242706,242776,242846,242916,
+	242986,243057,243127,243197,243267,243337,243408,243478,
+	243548,243619,243689,243760,243830,243900,243971,244041,
+	244112,244182,244253,244323,244394,244465,244535,244606,
+	244676,244747,244818,244889,244959,245030,245101,245172,
+	245242,245313,245384,245455,245526,245597,245668,245739,
+	245810,245881,245952,246023,246094,246165,246236,246307,
+	246378,246449,246521,246592,246663,246734,246806,246877,
+	246948,247020,247091,247162,247234,247305,247377,247448,
+	247519,247591,247662,247734,247806,247877,247949,248020,
+	248092,248164,248235,248307,248379,248451,248522,248594,
+	248666,248738,248810,248881,248953,249025,249097,249169,
+	249241,249313,249385,249457,249529,249601,249673,249745,
+	249818,249890,249962,250034,250106,250179,250251,250323,
+	250395,250468,250540,250613,250685,250757,250830,250902,
+	250975,251047,251120,251192,251265,251337,251410,251483,
+	251555,251628,251701,251773,251846,251919,251992,252064,
+	252137,252210,252283,252356,252429,252501,252574,252647,
+	252720,252793,252866,252939,253012,253086,253159,253232,
+	253305,253378,253451,253525,253598,253671,253744,253818,
+	253891,253964,254038,254111,254184,254258,254331,254405,
+	254478,254552,254625,254699,254772,254846,254920,254993,
+	255067,255140,255214,255288,255362,255435,255509,255583,
+	255657,255731,255805,255878,255952,256026,256100,256174,
+	256248,256322,256396,256470,256544,256618,256693,256767,
+	256841,256915,256989,257064,257138,257212,257286,257361,
+	257435,257509,257584,257658,257733,257807,257882,257956,
+	258031,258105,258180,258254,258329,258403,258478,258553,
+	258627,258702,258777,258852,258926,259001,259076,259151,
+	259226,259301,259375,259450,259525,259600,259675,259750,
+	259825,259900,259975,260050,260126,260201,260276,260351,
+	260426,260502,260577,260652,260727,260803,260878,260953,
+	261029,261104,261180,261255,261330,261406,261481,261557,
+	261632,261708,261784,261859,261935,262011,262086,262162,
+	262238,262313,262389,262465,262541,262617,262693,262768,
+	262844,262920,262996,263072,263148,263224,263300,263376,
+	263452,263528,263605,263681,263757,263833,263909,263985,
+	264062,264138,264214,264291,264367,264443,264520,264596,
+	264673,264749,264825,264902,264978,265055,265132,265208,
+	265285,265361,265438,265515,265591,265668,265745,265822,
+	265898,265975,266052,266129,266206,266283,266360,266436,
+	266513,266590,266667,266744,266822,266899,266976,267053,
+	267130,267207,267284,267361,267439,267516,267593,267671,
+	267748,267825,267903,267980,268057,268135,268212,268290,
+	268367,268445,268522,268600,268677,268755,268833,268910,
+	268988,269066,269143,269221,269299,269377,269455,269532,
+	269610,269688,269766,269844,269922,270000,270078,270156,
+	270234,270312,270390,270468,270546,270624,270703,270781,
+	270859,270937,271015,271094,271172,271250,271329,271407,
+	271485,271564,271642,271721,271799,271878,271956,272035,
+	272113,272192,272271,272349,272428,272507,272585,272664,
+	272743,272822,272900,272979,273058,273137,273216,273295,
+	273374,273453,273532,273611,273690,273769,273848,273927,
+	274006,274085,274164,274244,274323,274402,274481,274561,
+	274640,274719,274799,274878,274957,275037,275116,275196,
+	275275,275355,275434,275514,275593,275673,275753,275832,
+	275912,275992,276071,276151,276231,276311,276391,276470,
+	276550,276630,276710,276790,276870,276950,277030,277110,
+	277190,277270,277350,277430,277510,277591,277671,277751,
+	277831,277911,277992,278072,278152,278233,278313,278393,
+	278474,278554,278635,278715,278796,278876,278957,279037,
+	279118,279199,279279,279360,279441,279521,279602,279683,
+	279764,279844,279925,280006,280087,280168,280249,280330,
+	280411,280492,280573,280654,280735,280816,280897,280978,
+	281059,281141,281222,281303,281384,281466,281547,281628,
+	281710,281791,281872,281954,282035,282117,282198,282280,
+	282361,282443,282524,282606,282688,282769,282851,282933,
+	283014,283096,283178,283260,283341,283423,283505,283587,
+	283669,283751,283833,283915,283997,284079,284161,284243,
+	284325,284407,284489,284572,284654,284736,284818,284901,
+	284983,285065,285147,285230,285312,285395,285477,285560,
+	285642,285725,285807,285890,285972,286055,286137,286220,
+	286303,286385,286468,286551,286634,286716,286799,286882,
+	286965,287048,287131,287214,287297,287380,287463,287546,
+	287629,287712,287795,287878,287961,288044,288128,288211,
+	288294,288377,288461,288544,288627,288711,288794,288878,
+	288961,289044,289128,289211,289295,289379,289462,289546,
+	289629,289713,289797,289880,289964,290048,290132,290216,
+	290299,290383,290467,290551,290635,290719,290803,290887,
+	290971,291055,291139,291223,291307,291391,291476,291560,
+	291644,291728,291812,291897,291981,292065,292150,292234,
+	292319,292403,292487,292572,292656,292741,292826,292910,
+	292995,293079,293164,293249,293333,293418,293503,293588,
+	293672,293757,293842,293927,294012,294097,294182,294267,
+	294352,294437,294522,294607,294692,294777,294862,294947,
+	295033,295118,295203,295288,295374,295459,295544,295630,
+	295715,295801,295886,295971,296057,296142,296228,296314,
+	296399,296485,296570,296656,296742,296828,296913,296999,
+	297085,297171,297256,297342,297428,297514,297600,297686,
+	297772,297858,297944,298030,298116,298202,298288,298375,
+	298461,298547,298633,298720,298806,298892,298978,299065,
+	299151,299238,299324,299410,299497,299583,299670,299757,
+	299843,299930,300016,300103,300190,300276,300363,300450,
+	300537,300624,300710,300797,300884,300971,301058,301145,
+	301232,301319,301406,301493,301580,301667,301754,301842,
+	301929,302016,302103,302190,302278,302365,302452,302540,
+	302627,302715,302802,302889,302977,303064,303152,303240,
+	303327,303415,303502,303590,303678,303766,303853,303941,
+	304029,304117,304204,304292,304380,304468,304556,304644,
+	304732,304820,304908,304996,305084,305172,305261,305349,
+	305437,305525,305613,305702,305790,305878,305967,306055,
+	306143,306232,306320,306409,306497,306586,306674,306763,
+	306852,306940,307029,307118,307206,307295,307384,307473,
+	307561,307650,307739,307828,307917,308006,308095,308184,
+	308273,308362,308451,308540,308629,308718,308808,308897,
+	308986,309075,309165,309254,309343,309432,309522,309611,
+	309701,309790,309880,309969,310059,310148,310238,310327,
+	310417,310507,310596,310686,310776,310866,310955,311045,
+	311135,311225,311315,311405,311495,311585,311675,311765,
+	311855,311945,312035,312125,312215,312306,312396,312486,
+	312576,312666,312757,312847,312938,313028,313118,313209,
+	313299,313390,313480,313571,313661,313752,313843,313933,
+	314024,314115,314205,314296,314387,314478,314569,314659,
+	314750,314841,314932,315023,315114,315205,315296,315387,
+	315478,315570,315661,315752,315843,315934,316026,316117,
+	316208,316300,316391,316482,316574,316665,316757,316848,
+	316940,317031,317123,317214,317306,317398,317489,317581,
+	317673,317764,317856,317948,318040,318132,318224,318316,
+	318408,318500,318592,318684,318776,318868,318960,319052,
+	319144,319236,319328,319421,319513,319605,319698,319790,
+	319882,319975,320067,320160,320252,320345,320437,320530,
+	320622,320715,320808,320900,320993,321086,321178,321271,
+	321364,321457,321550,321642,321735,321828,321921,322014,
+	322107,322200,322293,322386,322480,322573,322666,322759,
+	322852,322946,323039,323132,323226,323319,323412,323506,
+	323599,323693,323786,323880,323973,324067,324160,324254,
+	324348,324441,324535,324629,324723,324816,324910,325004,
+	325098,325192,325286,325380,325474,325568,325662,325756,
+	325850,325944,326038,326132,326227,326321,326415,326509,
+	326604,326698,326792,326887,326981,327076,327170,327265,
+	327359,327454,327548,327643,327738,327832,327927,328022,
+	328116,328211,328306,328401,328496,328591,328686,328780,
+	328875,328970,329065,329160,329256,329351,329446,329541,
+	329636,329731,329827,329922,330017,330113,330208,330303,
+	330399,330494,330590,330685,330781,330876,330972,331067,
+	331163,331259,331354,331450,331546,331641,331737,331833,
+	331929,332025,332121,332217,332313,332409,332505,332601,
+	332697,332793,332889,332985,333081,333178,333274,333370,
+	333466,333563,333659,333755,333852,333948,334045,334141,
+	334238,334334,334431,334527,334624,334721,334817,334914,
+	335011,335108,335204,335301,335398,335495,335592,335689,
+	335786,335883,335980,336077,336174,336271,336368,336465,
+	336563,336660,336757,336854,336952,337049,337146,337244,
+	337341,337438,337536,337633,337731,337829,337926,338024,
+	338121,338219,338317,338414,338512,338610,338708,338806,
+	338903,339001,339099,339197,339295,339393,339491,339589,
+	339687,339786,339884,339982,340080,340178,340277,340375,
+	340473,340572,340670,340768,340867,340965,341064,341162,
+	341261,341359,341458,341557,341655,341754,341853,341951,
+	342050,342149,342248,342347,342446,342544,342643,342742,
+	342841,342940,343039,343139,343238,343337,343436,343535,
+	343634,343734,343833,343932,344032,344131,344230,344330,
+	344429,344529,344628,344728,344827,344927,345027,345126,
+	345226,345326,345425,345525,345625,345725,345825,345925,
+	346025,346125,346224,346324,346425,346525,346625,346725,
+	346825,346925,347025,347126,347226,347326,347426,347527,
+	347627,347728,347828,347929,348029,348130,348230,348331,
+	348431,348532,348633,348733,348834,348935,349036,349136,
+	349237,349338,349439,349540,349641,349742,349843,349944,
+	350045,350146,350247,350349,350450,350551,350652,350754,
+	350855,350956,351058,351159,351260,351362,351463,351565,
+	351666,351768,351870,351971,352073,352175,352276,352378,
+	352480,352582,352684,352785,352887,352989,353091,353193,
+	353295,353397,353499,353601,353704,353806,353908,354010,
+	354112,354215,354317,354419,354522,354624,354727,354829,
+	354932,355034,355137,355239,355342,355445,355547,355650,
+	355753,355855,355958,356061,356164,356267,356370,356473,
+	356576,356679,356782,356885,356988,357091,357194,357297,
+	357400,357504,357607,357710,357813,357917,358020,358124,
+	358227,358331,358434,358538,358641,358745,358848,358952,
+	359056,359159,359263,359367,359471,359575,359678,359782,
+	359886,359990,360094,360198,360302,360406,360510,360615,
+	360719,360823,360927,361031,361136,361240,361344,361449,
+	361553,361658,361762,361867,361971,362076,362180,362285,
+	362389,362494,362599,362704,362808,362913,363018,363123,
+	363228,363333,363438,363543,363648,363753,363858,363963,
+	364068,364173,364278,364384,364489,364594,364699,364805,
+	364910,365015,365121,365226,365332,365437,365543,365649,
+	365754,365860,365965,366071,366177,366283,366389,366494,
+	366600,366706,366812,366918,367024,367130,367236,367342,
+	367448,367554,367661,367767,367873,367979,368086,368192,
+	368298,368405,368511,368617,368724,368830,368937,369044,
+	369150,369257,369363,369470,369577,369684,369790,369897,
+	370004,370111,370218,370325,370432,370539,370646,370753,
+	370860,370967,371074,371181,371289,371396,371503,371610,
+	371718,371825,371933,372040,372147,372255,372362,372470,
+	372578,372685,372793,372901,373008,373116,373224,373332,
+	373439,373547,373655,373763,373871,373979,374087,374195,
+	374303,374411,374520,374628,374736,374844,374952,375061,
+	375169,375277,375386,375494,375603,375711,375820,375928,
+	376037,376146,376254,376363,376472,376580,376689,376798,
+	376907,377016,377125,377233,377342,377451,377560,377669,
+	377779,377888,377997,378106,378215,378325,378434,378543,
+	378652,378762,378871,378981,379090,379200,379309,379419,
+	379528,379638,379748,379857,379967,380077,380187,380296,
+	380406,380516,380626,380736,380846,380956,381066,381176,
+	381286,381396,381506,381617,381727,381837,381947,382058,
+	382168,382279,382389,382499,382610,382720,382831,382942,
+	383052,383163,383273,383384,383495,383606,383717,383827,
+	383938,384049,384160,384271,384382,384493,384604,384715,
+	384826,384937,385049,385160,385271,385382,385494,385605,
+	385717,385828,385939,386051,386162,386274,386385,386497,
+	386609,386720,386832,386944,387056,387167,387279,387391,
+	387503,387615,387727,387839,387951,388063,388175,388287,
+	388399,388512,388624,388736,388848,388961,389073,389185,
+	389298,389410,389523,389635,389748,389860,389973,390086,
+	390198,390311,390424,390537,390649,390762,390875,390988,
+	391101,391214,391327,391440,391553,391666,391779,391892,
+	392006,392119,392232,392345,392459,392572,392685,392799,
+	392912,393026,393139,393253,393367,393480,393594,393707,
+	393821,393935,394049,394163,394276,394390,394504,394618,
+	394732,394846,394960,395074,395188,395303,395417,395531,
+	395645,395760,395874,395988,396103,396217,396331,396446,
+	396560,396675,396790,396904,397019,397134,397248,397363,
+	397478,397593,397707,397822,397937,398052,398167,398282,
+	398397,398512,398627,398743,398858,398973,399088,399203,
+	399319,399434,399549,399665,399780,399896,400011,400127,
+	400242,400358,400474,400589,400705,400821,400937,401052,
+	401168,401284,401400,401516,401632,401748,401864,401980,
+	402096,402212,402329,402445,402561,402677,402794,402910,
+	403026,403143,403259,403376,403492,403609,403725,403842,
+	403959,404075,404192,404309,404426,404542,404659,404776,
+	404893,405010,405127,405244,405361,405478,405595,405712,
+	405830,405947,406064,406181,406299,406416,406533,406651,
+	406768,406886,407003,407121,407239,407356,407474,407592,
+	407709,407827,407945,408063,408181,408298,408416,408534,
+	408652,408770,408888,409007,409125,409243,409361,409479,
+	409598,409716,409834,409953,410071,410190,410308,410427,
+	410545,410664,410782,410901,411020,411138,411257,411376,
+	411495,411614,411733,411851,411970,412089,412208,412328,
+	412447,412566,412685,412804,412923,413043,413162,413281,
+	413401,413520,413640,413759,413879,413998,414118,414237,
+	414357,414477,414596,414716,414836,414956,415076,415195,
+	415315,415435,415555,415675,415795,415916,416036,416156,
+	416276,416396,416517,416637,416757,416878,416998,417119,
+	417239,417360,417480,417601,417721,417842,417963,418083,
+	418204,418325,418446,418567,418688,418809,418929,419050,
+	419172,419293,419414,419535,419656,419777,419899,420020,
+	420141,420262,420384,420505,420627,420748,420870,420991,
+	421113,421235,421356,421478,421600,421722,421843,421965,
+	422087,422209,422331,422453,422575,422697,422819,422941,
+	423063,423186,423308,423430,423552,423675,423797,423920,
+	424042,424165,424287,424410,424532,424655,424778,424900,
+	425023,425146,425269,425391,425514,425637,425760,425883,
+	426006,426129,426252,426375,426499,426622,426745,426868,
+	426992,427115,427238,427362,427485,427609,427732,427856,
+	427979,428103,428226,428350,428474,428598,428721,428845,
+	428969,429093,429217,429341,429465,429589,429713,429837,
+	429961,430086,430210,430334,430458,430583,430707,430832,
+	430956,431081,431205,431330,431454,431579,431703,431828,
+	431953,432078,432202,432327,432452,432577,432702,432827,
+	432952,433077,433202,433327,433453,433578,433703,433828,
+	433954,434079,434204,434330,434455,434581,434706,434832,
+	434957,435083,435209,435334,435460,435586,435712,435838,
+	435963,436089,436215,436341,436467,436594,436720,436846,
+	436972,437098,437224,437351,437477,437603,437730,437856,
+	437983,438109,438236,438362,438489,438616,438742,438869,
+	438996,439123,439250,439376,439503,439630,439757,439884,
+	440011,440138,440266,440393,440520,440647,440774,440902,
+	441029,441157,441284,441411,441539,441666,441794,441922,
+	442049,442177,442305,442432,442560,442688,442816,442944,
+	443072,443200,443328,443456,443584,443712,443840,443968,
+	444097,444225,444353,444482,444610,444738,444867,444995,
+	445124,445253,445381,445510,445639,445767,445896,446025,
+	446154,446283,446411,446540,446669,446798,446927,447057,
+	447186,447315,447444,447573,447703,447832,447961,448091,
+	448220,448350,448479,448609,448738,448868,448997,449127,
+	449257,449387,449516,449646,449776,449906,450036,450166,
+	450296,450426,450556,450686,450817,450947,451077,451207,
+	451338,451468,451598,451729,451859,451990,452120,452251,
+	452382,452512,452643,452774,452905,453035,453166,453297,
+	453428,453559,453690,453821,453952,454083,454215,454346,
+	454477,454608,454740,454871,455002,455134,455265,455397,
+	455528,455660,455791,455923,456055,456187,456318,456450,
+	456582,456714,456846,456978,457110,457242,457374,457506,
+	457638,457770,457903,458035,458167,458299,458432,458564,
+	458697,458829,458962,459094,459227,459360,459492,459625,
+	459758,459891,460023,460156,460289,460422,460555,460688,
+	460821,460954,461088,461221,461354,461487,461620,461754,
+	461887,462021,462154,462288,462421,462555,462688,462822,
+	462956,463089,463223,463357,463491,463625,463759,463893,
+	464027,464161,464295,464429,464563,464697,464831,464966,
+	465100,465234,465369,465503,465637,465772,465907,466041,
+	466176,466310,466445,466580,466715,466849,466984,467119,
+	467254,467389,467524,467659,467794,467929,468064,468200,
+	468335,468470,468605,468741,468876,469012,469147,469283,
+	469418,469554,469689,469825,469961,470097,470232,470368,
+	470504,470640,470776,470912,471048,471184,471320,471456,
+	471592,471729,471865,472001,472138,472274,472410,472547,
+	472683,472820,472956,473093,473230,473366,473503,473640,
+	473777,473914,474050,474187,474324,474461,474598,474735,
+	474873,475010,475147,475284,475422,475559,475696,475834,
+	475971,476109,476246,476384,476521,476659,476797,476934,
+	477072,477210,477348,477486,477624,477761,477899,478038,
+	478176,478314,478452,478590,478728,478867,479005,479143,
+	479282,479420,479559,479697,479836,479974,480113,480252,
+	480390,480529,480668,480807,480946,481085,481224,481363,
+	481502,481641,481780,481919,482058,482197,482337,482476,
+	482615,482755,482894,483034,483173,483313,483452,483592,
+	483732,483871,484011,484151,484291,484431,484571,484711,
+	484851,484991,485131,485271,485411,485551,485692,485832,
+	485972,486113,486253,486393,486534,486674,486815,486956,
+	487096,487237,487378,487519,487659,487800,487941,488082,
+	488223,488364,488505,488646,488787,488929,489070,489211,
+	489352,489494,489635,489777,489918,490060,490201,490343,
+	490484,490626,490768,490910,491051,491193,491335,491477,
+	491619,491761,491903,492045,492187,492329,492472,492614,
+	492756,492898,493041,493183,493326,493468,493611,493753,
+	493896,494039,494181,494324,494467,494610,494753,494895,
+	495038,495181,495324,495468,495611,495754,495897,496040,
+	496184,496327,496470,496614,496757,496901,497044,497188,
+	497331,497475,497619,497762,497906,498050,498194,498338,
+	498482,498626,498770,498914,499058,499202,499346,499490,
+	499635,499779,499923,500068,500212,500357,500501,500646,
+	500790,500935,501080,501225,501369,501514,501659,501804,
+	501949,502094,502239,502384,502529,502674,502819,502965,
+	503110,503255,503401,503546,503692,503837,503983,504128,
+	504274,504419,504565,504711,504857,505002,505148,505294,
+	505440,505586,505732,505878,506024,506171,506317,506463,
+	506609,506756,506902,507049,507195,507341,507488,507635,
+	507781,507928,508075,508221,508368,508515,508662,508809,
+	508956,509103,509250,509397,509544,509691,509839,509986,
+	510133,510280,510428,510575,510723,510870,511018,511165,
+	511313,511461,511609,511756,511904,512052,512200,512348,
+	512496,512644,512792,512940,513088,513236,513385,513533,
+	513681,513830,513978,514127,514275,514424,514572,514721,
+	514870,515018,515167,515316,515465,515614,515763,515912,
+	516061,516210,516359,516508,516657,516806,516956,517105,
+	517254,517404,517553,517703,517852,518002,518151,518301,
+	518451,518601,518750,518900,519050,519200,519350,519500,
+	519650,519800,519950,520100,520251,520401,520551,520702,
+	520852,521003,521153,521304,521454,521605,521755,521906,
+	522057,522208,522359,522509,522660,522811,522962,523113,
+	523264,523416,523567,523718,523869,524021,524172,524323,
+	524475,524626,524778,524930,525081,525233,525385,525536,
+	525688,525840,525992,526144,526296,526448,526600,526752,
+	526904,527056,527209,527361,527513,527666,527818,527970,
+	528123,528275,528428,528581,528733,528886,529039,529192,
+	529345,529497,529650,529803,529956,530109,530263,530416,
+	530569,530722,530876,531029,531182,531336,531489,531643,
+	531796,531950,532104,532257,532411,532565,532719,532872,
+	533026,533180,533334,533488,533643,533797,533951,534105,
+	534259,534414,534568,534722,534877,535031,535186,535341,
+	535495,535650,535805,535959,536114,536269,536424,536579,
+	536734,536889,537044,537199,537354,537510,537665,537820,
+	537975,538131,538286,538442,538597,538753,538909,539064,
+	539220,539376,539531,539687,539843,539999,540155,540311,
+	540467,540623,540779,540936,541092,541248,541405,541561,
+	541717,541874,542030,542187,542344,542500,542657,542814,
+	542970,543127,543284,543441,543598,543755,543912,544069,
+	544226,544384,544541,544698,544855,545013,545170,545328,
+	545485,545643,545800,545958,546116,546274,546431,546589,
+	546747,546905,547063,547221,547379,547537,547695,547854,
+	548012,548170,548328,548487,548645,548804,548962,549121,
+	549279,549438,549597,549756,549914,550073,550232,550391,
+	550550,550709,550868,551027,551186,551346,551505,551664,
+	551824,551983,552142,552302,552461,552621,552781,552940,
+	553100,553260,553420,553579,553739,553899,554059,554219,
+	554379,554540,554700,554860,555020,555181,555341,555501,
+	555662,555822,555983,556143,556304,556465,556625,556786,
+	556947,557108,557269,557430,557591,557752,557913,558074,
+	558235,558397,558558,558719,558881,559042,559204,559365,
+	559527,559688,559850,560012,560173,560335,560497,560659,
+	560821,560983,561145,561307,561469,561631,561794,561956,
+	562118,562281,562443,562605,562768,562931,563093,563256,
+	563419,563581,563744,563907,564070,564233,564396,564559,
+	564722,564885,565048,565211,565375,565538,565701,565865,
+	566028,566192,566355,566519,566682,566846,567010,567174,
+	567337,567501,567665,567829,567993,568157,568321,568486,
+	568650,568814,568978,569143,569307,569471,569636,569801,
+	569965,570130,570294,570459,570624,570789,570954,571119,
+	571284,571449,571614,571779,571944,572109,572274,572440,
+	572605,572770,572936,573101,573267,573432,573598,573764,
+	573930,574095,574261,574427,574593,574759,574925,575091,
+	575257,575423,575589,575756,575922,576088,576255,576421,
+	576588,576754,576921,577088,577254,577421,577588,577755,
+	577922,578088,578255,578422,578590,578757,578924,579091,
+	579258,579426,579593,579760,579928,580095,580263,580431,
+	580598,580766,580934,581102,581269,581437,581605,581773,
+	581941,582109,582278,582446,582614,582782,582951,583119,
+	583287,583456,583624,583793,583962,584130,584299,584468,
+	584637,584806,584974,585143,585312,585481,585651,585820,
+	585989,586158,586328,586497,586666,586836,587005,587175,
+	587344,587514,587684,587854,588023,588193,588363,588533,
+	588703,588873,589043,589213,589384,589554,589724,589894,
+	590065,590235,590406,590576,590747,590918,591088,591259,
+	591430,591601,591772,591942,592113,592284,592456,592627,
+	592798,592969,593140,593312,593483,593655,593826,593998,
+	594169,594341,594512,594684,594856,595028,595200,595372,
+	595543,595716,595888,596060,596232,596404,596576,596749,
+	596921,597094,597266,597439,597611,597784,597956,598129,
+	598302,598475,598648,598820,598993,599166,599340,599513,
+	599686,599859,600032,600206,600379,600552,600726,600899,
+	601073,601247,601420,601594,601768,601942,602115,602289,
+	602463,602637,602811,602986,603160,603334,603508,603683,
+	603857,604031,604206,604380,604555,604730,604904,605079,
+	605254,605429,605603,605778,605953,606128,606304,606479,
+	606654,606829,607004,607180,607355,607531,607706,607882,
+	608057,608233,608408,608584,608760,608936,609112,609288,
+	609464,609640,609816,609992,610168,610344,610521,610697,
+	610873,611050,611226,611403,611580,611756,611933,612110,
+	612286,612463,612640,612817,612994,613171,613348,613526,
+	613703,613880,614057,614235,614412,614590,614767,614945,
+	615122,615300,615478,615656,615833,616011,616189,616367,
+	616545,616723,616902,617080,617258,617436,617615,617793,
+	617971,618150,618329,618507,618686,618864,619043,619222,
+	619401,619580,619759,619938,620117,620296,620475,620654,
+	620834,621013,621192,621372,621551,621731,621910,622090,
+	622270,622450,622629,622809,622989,623169,623349,623529,
+	623709,623889,624070,624250,624430,624611,624791,624971,
+	625152,625332,625513,625694,625875,626055,626236,626417,
+	626598,626779,626960,627141,627322,627503,627685,627866,
+	628047,628229,628410,628592,628773,628955,629137,629318,
+	629500,629682,629864,630046,630228,630410,630592,630774,
+	630956,631139,631321,631503,631686,631868,632051,632233,
+	632416,632599,632781,632964,633147,633330,633513,633696,
+	633879,634062,634245,634428,634611,634795,634978,635162,
+	635345,635528,635712,635896,636079,636263,636447,636631,
+	636815,636999,637183,637367,637551,637735,637919,638103,
+	638288,638472,638656,638841,639025,639210,639395,639579,
+	639764,639949,640134,640319,640504,640689,640874,641059,
+	641244,641429,641615,641800,641985,642171,642356,642542,
+	642727,642913,643099,643284,643470,643656,643842,644028,
+	644214,644400,644586,644772,644959,645145,645331,645518,
+	645704,645891,646077,646264,646451,646637,646824,647011,
+	647198,647385,647572,647759,647946,648133,648320,648508,
+	648695,648882,649070,649257,649445,649632,649820,650008,
+	650195,650383,650571,650759,650947,651135,651323,651511,
+	651699,651888,652076,652264,652453,652641,652830,653018,
+	653207,653396,653584,653773,653962,654151,654340,654529,
+	654718,654907,655096,655285,655475,655664,655853,656043,
+	656232,656422,656612,656801,656991,657181,657371,657560,
+	657750,657940,658130,658320,658511,658701,658891,659081,
+	659272,659462,659653,659843,660034,660225,660415,660606,
+	660797,660988,661179,661370,661561,661752,661943,662134,
+	662325,662517,662708,662899,663091,663282,663474,663666,
+	663857,664049,664241,664433,664625,664817,665009,665201,
+	665393,665585,665777,665970,666162,666355,666547,666740,
+	666932,667125,667318,667510,667703,667896,668089,668282,
+	668475,668668,668861,669054,669248,669441,669634,669828,
+	670021,670215,670408,670602,670796,670989,671183,671377,
+	671571,671765,671959,672153,672347,672542,672736,672930,
+	673125,673319,673513,673708,673903,674097,674292,674487,
+	674682,674876,675071,675266,675461,675657,675852,676047,
+	676242,676438,676633,676828,677024,677219,677415,677611,
+	677806,678002,678198,678394,678590,678786,678982,679178,
+	679374,679571,679767,679963,680160,680356,680553,680749,
+	680946,681143,681339,681536,681733,681930,682127,682324,
+	682521,682718,682915,683113,683310,683507,683705,683902,
+	684100,684297,684495,684693,684891,685088,685286,685484,
+	685682,685880,686078,686277,686475,686673,686871,687070,
+	687268,687467,687665,687864,688063,688261,688460,688659,
+	688858,689057,689256,689455,689654,689854,690053,690252,
+	690451,690651,690850,691050,691250,691449,691649,691849,
+	692049,692249,692448,692648,692849,693049,693249,693449,
+	693649,693850,694050,694251,694451,694652,694852,695053,
+	695254,695455,695656,695857,696058,696259,696460,696661,
+	696862,697063,697265,697466,697668,697869,698071,698272,
+	698474,698676,698878,699080,699282,699484,699686,699888,
+	700090,700292,700494,700697,700899,701102,701304,701507,
+	701709,701912,702115,702317,702520,702723,702926,703129,
+	703332,703536,703739,703942,704145,704349,704552,704756,
+	704959,705163,705367,705570,705774,705978,706182,706386,
+	706590,706794,706998,707202,707407,707611,707816,708020,
+	708224,708429,708634,708838,709043,709248,709453,709658,
+	709863,710068,710273,710478,710683,710889,711094,711299,
+	711505,711710,711916,712121,712327,712533,712739,712945,
+	713151,713357,713563,713769,713975,714181,714387,714594,
+	714800,715007,715213,715420,715626,715833,716040,716247,
+	716454,716661,716868,717075,717282,717489,717696,717904,
+	718111,718318,718526,718733,718941,719149,719356,719564,
+	719772,719980,720188,720396,720604,720812,721020,721229,
+	721437,721645,721854,722062,722271,722480,722688,722897,
+	723106,723315,723524,723733,723942,724151,724360,724569,
+	724778,724988,725197,725407,725616,725826,726035,726245,
+	726455,726665,726875,727085,727295,727505,727715,727925,
+	728135,728346,728556,728767,728977,729188,729398,729609,
+	729820,730030,730241,730452,730663,730874,731085,731297,
+	731508,731719,731930,732142,732353,732565,732777,732988,
+	733200,733412,733624,733835,734047,734259,734472,734684,
+	734896,735108,735321,735533,735745,735958,736171,736383,
+	736596,736809,737021,737234,737447,737660,737873,738087,
+	738300,738513,738726,738940,739153,739367,739580,739794,
+	740008,740221,740435,740649,740863,741077,741291,741505,
+	741719,741934,742148,742362,742577,742791,743006,743220,
+	743435,743650,743865,744079,744294,744509,744724,744940,
+	745155,745370,745585,745801,746016,746232,746447,746663,
+	746878,747094,747310,747526,747742,747958,748174,748390,
+	748606,748822,749039,749255,749471,749688,749904,750121,
+	750338,750554,750771,750988,751205,751422,751639,751856,
+	752073,752291,752508,752725,752943,753160,753378,753595,
+	753813,754031,754249,754466,754684,754902,755120,755338,
+	755557,755775,755993,756212,756430,756649,756867,757086,
+	757304,757523,757742,757961,758180,758399,758618,758837,
+	759056,759275,759495,759714,759934,760153,760373,760592,
+	760812,761032,761252,761471,761691,761911,762132,762352,
+	762572,762792,763012,763233,763453,763674,763894,764115,
+	764336,764557,764777,764998,765219,765440,765661,765883,
+	766104,766325,766546,766768,766989,767211,767433,767654,
+	767876,768098,768320,768542,768764,768986,769208,769430,
+	769652,769874,770097,770319,770542,770764,770987,771210,
+	771433,771655,771878,772101,772324,772547,772770,772994,
+	773217,773440,773664,773887,774111,774334,774558,774782,
+	775006,775229,775453,775677,775901,776125,776350,776574,
+	776798,777023,777247,777472,777696,777921,778145,778370,
+	778595,778820,779045,779270,779495,779720,779945,780171,
+	780396,780622,780847,781073,781298,781524,781750,781975,
+	782201,782427,782653,782879,783105,783332,783558,783784,
+	784011,784237,784464,784690,784917,785144,785370,785597,
+	785824,786051,786278,786505,786733,786960,787187,787414,
+	787642,787869,788097,788325,788552,788780,789008,789236,
+	789464,789692,789920,790148,790376,790605,790833,791062,
+	791290,791519,791747,791976,792205,792434,792662,792891,
+	793120,793350,793579,793808,794037,794267,794496,794725,
+	794955,795185,795414,795644,795874,796104,796334,796564,
+	796794,797024,797254,797485,797715,797945,798176,798406,
+	798637,798868,799098,799329,799560,799791,800022,800253,
+	800484,800716,800947,801178,801410,801641,801873,802104,
+	802336,802568,802800,803031,803263,803495,803728,803960,
+	804192,804424,804657,804889,805122,805354,805587,805819,
+	806052,806285,806518,806751,806984,807217,807450,807683,
+	807917,808150,808384,808617,808851,809084,809318,809552,
+	809786,810019,810253,810487,810722,810956,811190,811424,
+	811659,811893,812128,812362,812597,812832,813066,813301,
+	813536,813771,814006,814241,814477,814712,814947,815183,
+	815418,815654,815889,816125,816361,816596,816832,817068,
+	817304,817540,817776,818013,818249,818485,818722,818958,
+	819195,819431,819668,819905,820142,820379,820616,820853,
+	821090,821327,821564,821801,822039,822276,822514,822751,
+	822989,823227,823465,823702,823940,824178,824416,824655,
+	824893,825131,825369,825608,825846,826085,826323,826562,
+	826801,827040,827279,827518,827757,827996,828235,828474,
+	828713,828953,829192,829432,829671,829911,830151,830390,
+	830630,830870,831110,831350,831590,831831,832071,832311,
+	832552,832792,833033,833273,833514,833755,833996,834237,
+	834478,834719,834960,835201,835442,835683,835925,836166,
+	836408,836649,836891,837133,837375,837617,837858,838100,
+	838343,838585,838827,839069,839312,839554,839797,840039,
+	840282,840524,840767,841010,841253,841496,841739,841982,
+	842225,842469,842712,842956,843199,843443,843686,843930,
+	844174,844418,844661,844905,845149,845394,845638,845882,
+	846126,846371,846615,846860,847104,847349,847594,847839,
+	848084,848329,848574,848819,849064,849309,849555,849800,
+	850045,850291,850537,850782,851028,851274,851520,851766,
+	852012,852258,852504,852750,852997,853243,853489,853736,
+	853983,854229,854476,854723,854970,855217,855464,855711,
+	855958,856205,856452,856700,856947,857195,857442,857690,
+	857938,858186,858434,858682,858930,859178,859426,859674,
+	859922,860171,860419,860668,860916,861165,861414,861663,
+	861912,862161,862410,862659,862908,863157,863406,863656,
+	863905,864155,864404,864654,864904,865154,865404,865654,
+	865904,866154,866404,866654,866905,867155,867405,867656,
+	867907,868157,868408,868659,868910,869161,869412,869663,
+	869914,870166,870417,870668,870920,871171,871423,871675,
+	871926,872178,872430,872682,872934,873187,873439,873691,
+	873943,874196,874448,874701,874954,875206,875459,875712,
+	875965,876218,876471,876724,876978,877231,877484,877738,
+	877991,878245,878499,878752,879006,879260,879514,879768,
+	880022,880276,880531,880785,881039,881294,881548,881803,
+	882058,882313,882567,882822,883077,883332,883588,883843,
+	884098,884353,884609,884864,885120,885376,885631,885887,
+	886143,886399,886655,886911,887167,887424,887680,887936,
+	888193,888450,888706,888963,889220,889476,889733,889990,
+	890248,890505,890762,891019,891277,891534,891792,892049,
+	892307,892565,892822,893080,893338,893596,893854,894113,
+	894371,894629,894888,895146,895405,895663,895922,896181,
+	896440,896699,896958,897217,897476,897735,897994,898254,
+	898513,898773,899032,899292,899552,899812,900072,900332,
+	900592,900852,901112,901372,901633,901893,902154,902414,
+	902675,902936,903196,903457,903718,903979,904240,904502,
+	904763,905024,905286,905547,905809,906070,906332,906594,
+	906856,907118,907380,907642,907904,908166,908429,908691,
+	908953,909216,909479,909741,910004,910267,910530,910793,
+	911056,911319,911582,911846,912109,912373,912636,912900,
+	913163,913427,913691,913955,914219,914483,914747,915011,
+	915276,915540,915805,916069,916334,916598,916863,917128,
+	917393,917658,917923,918188,918453,918719,918984,919249,
+	919515,919781,920046,920312,920578,920844,921110,921376,
+	921642,921908,922175,922441,922707,922974,923240,923507,
+	923774,924041,924308,924575,924842,925109,925376,925643,
+	925911,926178,926446,926713,926981,927249,927517,927785,
+	928053,928321,928589,928857,929125,929394,929662,929931,
+	930199,930468,930737,931006,931274,931543,931813,932082,
+	932351,932620,932890,933159,933429,933698,933968,934238,
+	934508,934778,935048,935318,935588,935858,936128,936399,
+	936669,936940,937210,937481,937752,938023,938294,938565,
+	938836,939107,939378,939650,939921,940193,940464,940736,
+	941008,941279,941551,941823,942095,942367,942640,942912,
+	943184,943457,943729,944002,944275,944547,944820,945093,
+	945366,945639,945912,946186,946459,946732,947006,947279,
+	947553,947827,948100,948374,948648,948922,949196,949470,
+	949745,950019,950293,950568,950843,951117,951392,951667,
+	951942,952217,952492,952767,953042,953317,953593,953868,
+	954144,954419,954695,954971,955247,955522,955798,956075,
+	956351,956627,956903,957180,957456,957733,958009,958286,
+	958563,958840,959117,959394,959671,959948,960225,960503,
+	960780,961058,961335,961613,961891,962169,962447,962725,
+	963003,963281,963559,963837,964116,964394,964673,964951,
+	965230,965509,965788,966067,966346,966625,966904,967184,
+	967463,967742,968022,968302,968581,968861,969141,969421,
+	969701,969981,970261,970541,970822,971102,971383,971663,
+	971944,972225,972506,972786,973067,973348,973630,973911,
+	974192,974474,974755,975037,975318,975600,975882,976164,
+	976446,976728,977010,977292,977574,977857,978139,978422,
+	978704,978987,979270,979553,979836,980119,980402,980685,
+	980968,981252,981535,981819,982102,982386,982670,982953,
+	983237,983521,983805,984090,984374,984658,984943,985227,
+	985512,985796,986081,986366,986651,986936,987221,987506,
+	987791,988077,988362,988648,988933,989219,989505,989790,
+	990076,990362,990648,990935,991221,991507,991793,992080,
+	992367,992653,992940,993227,993514,993801,994088,994375,
+	994662,994949,995237,995524,995812,996099,996387,996675,
+	996963,997251,997539,997827,998115,998404,998692,998980,
+	999269,999558,999846,1000135,1000424,1000713,1001002,1001291,
+	1001580,1001870,1002159,1002449,1002738,1003028,1003318,1003607,
+	1003897,1004187,1004477,1004767,1005058,1005348,1005638,1005929,
+	1006219,1006510,1006801,1007092,1007383,1007674,1007965,1008256,
+	1008547,1008838,1009130,1009421,1009713,1010004,1010296,1010588,
+	1010880,1011172,1011464,1011756,1012048,1012341,1012633,1012926,
+	1013218,1013511,1013804,1014097,1014389,1014682,1014976,1015269,
+	1015562,1015855,1016149,1016442,1016736,1017030,1017323,1017617,
+	1017911,1018205,1018499,1018793,1019088,1019382,1019677,1019971,
+	1020266,1020560,1020855,1021150,1021445,1021740,1022035,1022330,
+	1022626,1022921,1023217,1023512,1023808,1024104,1024399,1024695,
+	1024991,1025287,1025583,1025880,1026176,1026472,1026769,1027066,
+	1027362,1027659,1027956,1028253,1028550,1028847,1029144,1029441,
+	1029739,1030036,1030334,1030631,1030929,1031227,1031525,1031823,
+	1032121,1032419,1032717,1033015,1033314,1033612,1033911,1034209,
+	1034508,1034807,1035106,1035405,1035704,1036003,1036302,1036602,
+	1036901,1037201,1037500,1037800,1038100,1038400,1038699,1038999,
+	1039300,1039600,1039900,1040200,1040501,1040801,1041102,1041403,
+	1041704,1042005,1042306,1042607,1042908,1043209,1043510,1043812,
+	1044113,1044415,1044717,1045018,1045320,1045622,1045924,1046226,
+	1046528,1046831,1047133,1047436,1047738,1048041,1048344,1048646,
+	1048949,1049252,1049555,1049859,1050162,1050465,1050769,1051072,
+	1051376,1051679,1051983,1052287,1052591,1052895,1053199,1053503,
+	1053808,1054112,1054417,1054721,1055026,1055331,1055635,1055940,
+	1056245,1056550,1056856,1057161,1057466,1057772,1058077,1058383,
+	1058689,1058994,1059300,1059606,1059912,1060218,1060525,1060831,
+	1061137,1061444,1061751,1062057,1062364,1062671,1062978,1063285,
+	1063592,1063899,1064207,1064514,1064821,1065129,1065437,1065744,
+	1066052,1066360,1066668,1066976,1067285,1067593,1067901,1068210,
+	1068518,1068827,1069136,1069444,1069753,1070062,1070371,1070681,
+	1070990,1071299,1071609,1071918,1072228,1072538,1072847,1073157,
+	1073467,1073777,1074088,1074398,1074708,1075019,1075329,1075640,
+	1075950,1076261,1076572,1076883,1077194,1077505,1077817,1078128,
+	1078439,1078751,1079062,1079374,1079686,1079998,1080310,1080622,
+	1080934,1081246,1081558,1081871,1082183,1082496,1082809,1083121,
+	1083434,1083747,1084060,1084373,1084687,1085000,1085313,1085627,
+	1085940,1086254,1086568,1086882,1087196,1087510,1087824,1088138,
+	1088452,1088767,1089081,1089396,1089710,1090025,1090340,1090655,
+	1090970,1091285,1091600,1091916,1092231,1092547,1092862,1093178,
+	1093494,1093810,1094126,1094442,1094758,1095074,1095390,1095707,
+	1096023,1096340,1096656,1096973,1097290,1097607,1097924,1098241,
+	1098558,1098876,1099193,1099511,1099828,1100146,1100464,1100782,
+	1101100,1101418,1101736,1102054,1102372,1102691,1103009,1103328,
+	1103647,1103965,1104284,1104603,1104922,1105241,1105561,1105880,
+	1106199,1106519,1106839,1107158,1107478,1107798,1108118,1108438,
+	1108758,1109079,1109399,1109719,1110040,1110361,1110681,1111002,
+	1111323,1111644,1111965,1112286,1112608,1112929,1113250,1113572,
+	1113894,1114215,1114537,1114859,1115181,1115503,1115826,1116148,
+	1116470,1116793,1117115,1117438,1117761,1118084,1118407,1118730,
+	1119053,1119376,1119699,1120023,1120346,1120670,1120994,1121318,
+	1121641,1121965,1122290,1122614,1122938,1123262,1123587,1123911,
+	1124236,1124561,1124886,1125210,1125535,1125861,1126186,1126511,
+	1126837,1127162,1127488,1127813,1128139,1128465,1128791,1129117,
+	1129443,1129769,1130096,1130422,1130749,1131075,1131402,1131729,
+	1132056,1132383,1132710,1133037,1133364,1133692,1134019,1134347,
+	1134674,1135002,1135330,1135658,1135986,1136314,1136642,1136971,
+	1137299,1137627,1137956,1138285,1138614,1138942,1139271,1139601,
+	1139930,1140259,1140588,1140918,1141247,1141577,1141907,1142237,
+	1142567,1142897,1143227,1143557,1143887,1144218,1144548,1144879,
+	1145209,1145540,1145871,1146202,1146533,1146864,1147196,1147527,
+	1147859,1148190,1148522,1148854,1149185,1149517,1149849,1150182,
+	1150514,1150846,1151178,1151511,1151844,1152176,1152509,1152842,
+	1153175,1153508,1153841,1154175,1154508,1154842,1155175,1155509,
+	1155843,1156176,1156510,1156844,1157179,1157513,1157847,1158182,
+	1158516,1158851,1159186,1159520,1159855,1160190,1160525,1160861,
+	1161196,1161531,1161867,1162203,1162538,1162874,1163210,1163546,
+	1163882,1164218,1164555,1164891,1165227,1165564,1165901,1166237,
+	1166574,1166911,1167248,1167585,1167923,1168260,1168598,1168935,
+	1169273,1169611,1169948,1170286,1170624,1170962,1171301,1171639,
+	1171977,1172316,1172655,1172993,1173332,1173671,1174010,1174349,
+	1174688,1175028,1175367,1175707,1176046,1176386,1176726,1177066,
+	1177406,1177746,1178086,1178426,1178767,1179107,1179448,1179788,
+	1180129,1180470,1180811,1181152,1181493,1181835,1182176,1182517,
+	1182859,1183201,1183543,1183884,1184226,1184568,1184911,1185253,
+	1185595,1185938,1186280,1186623,1186966,1187309,1187651,1187995,
+	1188338,1188681,1189024,1189368,1189711,1190055,1190399,1190743,
+	1191086,1191431,1191775,1192119,1192463,1192808,1193152,1193497,
+	1193842,1194187,1194531,1194877,1195222,1195567,1195912,1196258,
+	1196603,1196949,1197295,1197640,1197986,1198332,1198679,1199025,
+	1199371,1199718,1200064,1200411,1200758,1201104,1201451,1201798,
+	1202145,1202493,1202840,1203188,1203535,1203883,1204230,1204578,
+	1204926,1205274,1205622,1205971,1206319,1206667,1207016,1207365,
+	1207713,1208062,1208411,1208760,1209109,1209459,1209808,1210158,
+	1210507,1210857,1211206,1211556,1211906,1212256,1212607,1212957,
+	1213307,1213658,1214008,1214359,1214710,1215061,1215411,1215763,
+	1216114,1216465,1216816,1217168,1217519,1217871,1218223,1218575,
+	1218927,1219279,1219631,1219983,1220336,1220688,1221041,1221394,
+	1221746,1222099,1222452,1222805,1223159,1223512,1223865,1224219,
+	1224572,1224926,1225280,1225634,1225988,1226342,1226696,1227051,
+	1227405,1227760,1228114,1228469,1228824,1229179,1229534,1229889,
+	1230244,1230600,1230955,1231311,1231666,1232022,1232378,1232734,
+	1233090,1233446,1233803,1234159,1234515,1234872,1235229,1235585,
+	1235942,1236299,1236657,1237014,1237371,1237728,1238086,1238444,
+	1238801,1239159,1239517,1239875,1240233,1240592,1240950,1241308,
+	1241667,1242026,1242384,1242743,1243102,1243461,1243820,1244180,
+	1244539,1244899,1245258,1245618,1245978,1246338,1246698,1247058,
+	1247418,1247778,1248139,1248499,1248860,1249221,1249581,1249942,
+	1250303,1250664,1251026,1251387,1251749,1252110,1252472,1252834,
+	1253195,1253557,1253920,1254282,1254644,1255006,1255369,1255732,
+	1256094,1256457,1256820,1257183,1257546,1257910,1258273,1258636,
+	1259000,1259364,1259727,1260091,1260455,1260819,1261183,1261548,
+	1261912,1262277,1262641,1263006,1263371,1263736,1264101,1264466,
+	1264831,1265197,1265562,1265928,1266293,1266659,1267025,1267391,
+	1267757,1268123,1268489,1268856,1269222,1269589,1269956,1270323,
+	1270689,1271056,1271424,1271791,1272158,1272526,1272893,1273261,
+	1273629,1273997,1274365,1274733,1275101,1275469,1275838,1276206,
+	1276575,1276944,1277312,1277681,1278050,1278420,1278789,1279158,
+	1279528,1279897,1280267,1280637,1281007,1281377,1281747,1282117,
+	1282488,1282858,1283229,1283599,1283970,1284341,1284712,1285083,
+	1285454,1285825,1286197,1286568,1286940,1287312,1287684,1288056,
+	1288428,1288800,1289172,1289544,1289917,1290290,1290662,1291035,
+	1291408,1291781,1292154,1292527,1292901,1293274,1293648,1294021,
+	1294395,1294769,1295143,1295517,1295891,1296266,1296640,1297015,
+	1297389,1297764,1298139,1298514,1298889,1299264,1299639,1300015,
+	1300390,1300766,1301142,1301518,1301894,1302270,1302646,1303022,
+	1303398,1303775,1304151,1304528,1304905,1305282,1305659,1306036,
+	1306413,1306791,1307168,1307546,1307923,1308301,1308679,1309057,
+	1309435,1309814,1310192,1310570,1310949,1311328,1311706,1312085,
+	1312464,1312843,1313223,1313602,1313981,1314361,1314741,1315120,
+	1315500,1315880,1316260,1316640,1317021,1317401,1317782,1318162,
+	1318543,1318924,1319305,1319686,1320067,1320449,1320830,1321212,
+	1321593,1321975,1322357,1322739,1323121,1323503,1323885,1324268,
+	1324650,1325033,1325416,1325798,1326181,1326564,1326948,1327331,
+	1327714,1328098,1328481,1328865,1329249,1329633,1330017,1330401,
+	1330786,1331170,1331554,1331939,1332324,1332709,1333094,1333479,
+	1333864,1334249,1334635,1335020,1335406,1335791,1336177,1336563,
+	1336949,1337336,1337722,1338108,1338495,1338881,1339268,1339655,
+	1340042,1340429,1340816,1341203,1341591,1341978,1342366,1342754,
+	1343142,1343530,1343918,1344306,1344694,1345083,1345471,1345860,
+	1346249,1346637,1347026,1347415,1347805,1348194,1348583,1348973,
+	1349363,1349752,1350142,1350532,1350922,1351313,1351703,1352093,
+	1352484,1352875,1353265,1353656,1354047,1354438,1354830,1355221,
+	1355612,1356004,1356396,1356787,1357179,1357571,1357964,1358356,
+	1358748,1359141,1359533,1359926,1360319,1360712,1361105,1361498,
+	1361891,1362285,1362678,1363072,1363465,1363859,1364253,1364647,
+	1365041,1365436,1365830,1366225,1366619,1367014,1367409,1367804,
+	1368199,1368594,1368990,1369385,1369781,1370176,1370572,1370968,
+	1371364,1371760,1372156,1372553,1372949,1373346,1373742,1374139,
+	1374536,1374933,1375330,1375728,1376125,1376522,1376920,1377318,
+	1377716,1378114,1378512,1378910,1379308,1379707,1380105,1380504,
+	1380902,1381301,1381700,1382099,1382499,1382898,1383297,1383697,
+	1384097,1384497,1384896,1385296,1385697,1386097,1386497,1386898,
+	1387298,1387699,1388100,1388501,1388902,1389303,1389704,1390106,
+	1390507,1390909,1391311,1391713,1392115,1392517,1392919,1393321,
+	1393724,1394126,1394529,1394932,1395335,1395738,1396141,1396544,
+	1396948,1397351,1397755,1398159,1398563,1398967,1399371,1399775,
+	1400179,1400584,1400988,1401393,1401798,1402203,1402608,1403013,
+	1403418,1403823,1404229,1404634,1405040,1405446,1405852,1406258,
+	1406664,1407071,1407477,1407884,1408290,1408697,1409104,1409511,
+	1409918,1410325,1410733,1411140,1411548,1411956,1412363,1412771,
+	1413180,1413588,1413996,1414404,1414813,1415222,1415631,1416039,
+	1416448,1416858,1417267,1417676,1418086,1418495,1418905,1419315,
+	1419725,1420135,1420545,1420956,1421366,1421777,1422187,1422598,
+	1423009,1423420,1423831,1424242,1424654,1425065,1425477,1425889,
+	1426301,1426713,1427125,1427537,1427949,1428362,1428774,1429187,
+	1429600,1430013,1430426,1430839,1431252,1431666,1432079,1432493,
+	1432907,1433321,1433735,1434149,1434563,1434977,1435392,1435807,
+	1436221,1436636,1437051,1437466,1437881,1438297,1438712,1439128,
+	1439544,1439959,1440375,1440791,1441208,1441624,1442040,1442457,
+	1442873,1443290,1443707,1444124,1444541,1444959,1445376,1445793,
+	1446211,1446629,1447047,1447465,1447883,1448301,1448719,1449138,
+	1449556,1449975,1450394,1450813,1451232,1451651,1452070,1452490,
+	1452909,1453329,1453749,1454169,1454589,1455009,1455429,1455850,
+	1456270,1456691,1457112,1457533,1457954,1458375,1458796,1459217,
+	1459639,1460060,1460482,1460904,1461326,1461748,1462170,1462593,
+	1463015,1463438,1463860,1464283,1464706,1465129,1465553,1465976,
+	1466399,1466823,1467247,1467670,1468094,1468518,1468943,1469367,
+	1469791,1470216,1470641,1471065,1471490,1471915,1472341,1472766,
+	1473191,1473617,1474042,1474468,1474894,1475320,1475746,1476173,
+	1476599,1477025,1477452,1477879,1478306,1478733,1479160,1479587,
+	1480015,1480442,1480870,1481297,1481725,1482153,1482581,1483010,
+	1483438,1483867,1484295,1484724,1485153,1485582,1486011,1486440,
+	1486870,1487299,1487729,1488158,1488588,1489018,1489448,1489879,
+	1490309,1490739,1491170,1491601,1492032,1492463,1492894,1493325,
+	1493756,1494188,1494619,1495051,1495483,1495915,1496347,1496779,
+	1497212,1497644,1498077,1498509,1498942,1499375,1499808,1500241,
+	1500675,1501108,1501542,1501976,1502409,1502843,1503278,1503712,
+	1504146,1504581,1505015,1505450,1505885,1506320,1506755,1507190,
+	1507625,1508061,1508497,1508932,1509368,1509804,1510240,1510676,
+	1511113,1511549,1511986,1512423,1512860,1513297,1513734,1514171,
+	1514608,1515046,1515483,1515921,1516359,1516797,1517235,1517673,
+	1518112,1518550,1518989,1519428,1519867,1520306,1520745,1521184,
+	1521623,1522063,1522503,1522942,1523382,1523822,1524263,1524703,
+	1525143,1525584,1526024,1526465,1526906,1527347,1527788,1528230,
+	1528671,1529113,1529554,1529996,1530438,1530880,1531322,1531765,
+	1532207,1532650,1533092,1533535,1533978,1534421,1534865,1535308,
+	1535751,1536195,1536639,1537083,1537527,1537971,1538415,1538859,
+	1539304,1539748,1540193,1540638,1541083,1541528,1541974,1542419,
+	1542865,1543310,1543756,1544202,1544648,1545094,1545540,1545987,
+	1546433,1546880,1547327,1547774,1548221,1548668,1549115,1549563,
+	1550011,1550458,1550906,1551354,1551802,1552250,1552699,1553147,
+	1553596,1554045,1554494,1554943,1555392,1555841,1556290,1556740,
+	1557190,1557639,1558089,1558539,1558990,1559440,1559890,1560341,
+	1560792,1561243,1561694,1562145,1562596,1563047,1563499,1563950,
+	1564402,1564854,1565306,1565758,1566210,1566663,1567115,1567568,
+	1568021,1568474,1568927,1569380,1569833,1570287,1570740,1571194,
+	1571648,1572102,1572556,1573010,1573465,1573919,1574374,1574828,
+	1575283,1575738,1576194,1576649,1577104,1577560,1578015,1578471,
+	1578927,1579383,1579840,1580296,1580752,1581209,1581666,1582123,
+	1582580,1583037,1583494,1583951,1584409,1584867,1585324,1585782,
+	1586240,1586699,1587157,1587615,1588074,1588533,1588991,1589450,
+	1589910,1590369,1590828,1591288,1591747,1592207,1592667,1593127,
+	1593587,1594048,1594508,1594969,1595429,1595890,1596351,1596812,
+	1597273,1597735,1598196,1598658,1599120,1599582,1600044,1600506,
+	1600968,1601431,1601893,1602356,1602819,1603282,1603745,1604208,
+	1604672,1605135,1605599,1606062,1606526,1606990,1607455,1607919,
+	1608383,1608848,1609313,1609778,1610243,1610708,1611173,1611638,
+	1612104,1612570,1613035,1613501,1613967,1614434,1614900,1615366,
+	1615833,1616300,1616767,1617234,1617701,1618168,1618635,1619103,
+	1619571,1620038,1620506,1620974,1621443,1621911,1622380,1622848,
+	1623317,1623786,1624255,1624724,1625193,1625663,1626132,1626602,
+	1627072,1627542,1628012,1628482,1628953,1629423,1629894,1630365,
+	1630836,1631307,1631778,1632249,1632721,1633192,1633664,1634136,
+	1634608,1635080,1635552,1636025,1636497,1636970,1637443,1637916,
+	1638389,1638862,1639336,1639809,1640283,1640757,1641231,1641705,
+	1642179,1642653,1643128,1643602,1644077,1644552,1645027,1645502,
+	1645978,1646453,1646929,1647404,1647880,1648356,1648832,1649309,
+	1649785,1650262,1650738,1651215,1651692,1652169,1652646,1653124,
+	1653601,1654079,1654557,1655035,1655513,1655991,1656469,1656948,
+	1657426,1657905,1658384,1658863,1659342,1659821,1660301,1660780,
+	1661260,1661740,1662220,1662700,1663180,1663661,1664141,1664622,
+	1665103,1665584,1666065,1666546,1667028,1667509,1667991,1668473,
+	1668955,1669437,1669919,1670401,1670884,1671366,1671849,1672332,
+	1672815,1673298,1673782,1674265,1674749,1675233,1675716,1676200,
+	1676685,1677169,1677653,1678138,1678623,1679108,1679593,1680078,
+	1680563,1681048,1681534,1682020,1682506,1682992,1683478,1683964,
+	1684450,1684937,1685424,1685911,1686398,1686885,1687372,1687859,
+	1688347,1688835,1689322,1689810,1690298,1690787,1691275,1691764,
+	1692252,1692741,1693230,1693719,1694208,1694698,1695187,1695677,
+	1696167,1696657,1697147,1697637,1698127,1698618,1699109,1699599,
+	1700090,1700581,1701073,1701564,1702055,1702547,1703039,1703531,
+	1704023,1704515,1705007,1705500,1705993,1706485,1706978,1707471,
+	1707965,1708458,1708951,1709445,1709939,1710433,1710927,1711421,
+	1711915,1712410,1712904,1713399,1713894,1714389,1714884,1715380,
+	1715875,1716371,1716867,1717363,1717859,1718355,1718851,1719348,
+	1719844,1720341,1720838,1721335,1721832,1722330,1722827,1723325,
+	1723823,1724321,1724819,1725317,1725815,1726314,1726812,1727311,
+	1727810,1728309,1728808,1729308,1729807,1730307,1730807,1731307,
+	1731807,1732307,1732807,1733308,1733809,1734309,1734810,1735312,
+	1735813,1736314,1736816,1737317,1737819,1738321,1738823,1739326,
+	1739828,1740331,1740833,1741336,1741839,1742342,1742845,1743349,
+	1743852,1744356,1744860,1745364,1745868,1746373,1746877,1747382,
+	1747886,1748391,1748896,1749401,1749907,1750412,1750918,1751424,
+	1751929,1752435,1752942,1753448,1753955,1754461,1754968,1755475,
+	1755982,1756489,1756997,1757504,1758012,1758519,1759027,1759536,
+	1760044,1760552,1761061,1761569,1762078,1762587,1763096,1763606,
+	1764115,1764625,1765134,1765644,1766154,1766664,1767175,1767685,
+	1768196,1768706,1769217,1769728,1770240,1770751,1771262,1771774,
+	1772286,1772798,1773310,1773822,1774334,1774847,1775360,1775872,
+	1776385,1776899,1777412,1777925,1778439,1778952,1779466,1779980,
+	1780495,1781009,1781523,1782038,1782553,1783067,1783583,1784098,
+	1784613,1785129,1785644,1786160,1786676,1787192,1787708,1788225,
+	1788741,1789258,1789775,1790292,1790809,1791326,1791844,1792361,
+	1792879,1793397,1793915,1794433,1794951,1795470,1795988,1796507,
+	1797026,1797545,1798064,1798584,1799103,1799623,1800143,1800663,
+	1801183,1801703,1802224,1802744,1803265,1803786,1804307,1804828,
+	1805349,1805871,1806392,1806914,1807436,1807958,1808480,1809003,
+	1809525,1810048,1810571,1811094,1811617,1812140,1812664,1813187,
+	1813711,1814235,1814759,1815283,1815808,1816332,1816857,1817382,
+	1817906,1818432,1818957,1819482,1820008,1820534,1821059,1821585,
+	1822112,1822638,1823164,1823691,1824218,1824745,1825272,1825799,
+	1826326,1826854,1827382,1827909,1828437,1828966,1829494,1830022,
+	1830551,1831080,1831609,1832138,1832667,1833196,1833726,1834256,
+	1834785,1835315,1835845,1836376,1836906,1837437,1837968,1838498,
+	1839030,1839561,1840092,1840624,1841155,1841687,1842219,1842751,
+	1843283,1843816,1844349,1844881,1845414,1845947,1846480,1847014,
+	1847547,1848081,1848615,1849149,1849683,1850217,1850752,1851286,
+	1851821,1852356,1852891,1853426,1853962,1854497,1855033,1855569,
+	1856105,1856641,1857177,1857713,1858250,1858787,1859324,1859861,
+	1860398,1860935,1861473,1862011,1862548,1863086,1863625,1864163,
+	1864701,1865240,1865779,1866318,1866857,1867396,1867935,1868475,
+	1869015,1869555,1870095,1870635,1871175,1871716,1872256,1872797,
+	1873338,1873879,1874420,1874962,1875504,1876045,1876587,1877129,
+	1877671,1878214,1878756,1879299,1879842,1880385,1880928,1881471,
+	1882015,1882558,1883102,1883646,1884190,1884734,1885279,1885823,
+	1886368,1886913,1887458,1888003,1888549,1889094,1889640,1890186,
+	1890732,1891278,1891824,1892371,1892917,1893464,1894011,1894558,
+	1895105,1895653,1896200,1896748,1897296,1897844,1898392,1898940,
+	1899489,1900038,1900586,1901135,1901685,1902234,1902783,1903333,
+	1903883,1904433,1904983,1905533,1906083,1906634,1907185,1907736,
+	1908287,1908838,1909389,1909941,1910493,1911044,1911596,1912149,
+	1912701,1913253,1913806,1914359,1914912,1915465,1916018,1916572,
+	1917125,1917679,1918233,1918787,1919341,1919896,1920450,1921005,
+	1921560,1922115,1922670,1923226,1923781,1924337,1924893,1925449,
+	1926005,1926561,1927118,1927674,1928231,1928788,1929345,1929902,
+	1930460,1931018,1931575,1932133,1932691,1933250,1933808,1934367,
+	1934925,1935484,1936043,1936603,1937162,1937722,1938281,1938841,
+	1939401,1939961,1940522,1941082,1941643,1942204,1942765,1943326,
+	1943887,1944449,1945011,1945572,1946134,1946696,1947259,1947821,
+	1948384,1948947,1949510,1950073,1950636,1951199,1951763,1952327,
+	1952891,1953455,1954019,1954584,1955148,1955713,1956278,1956843,
+	1957408,1957974,1958539,1959105,1959671,1960237,1960803,1961369,
+	1961936,1962503,1963070,1963637,1964204,1964771,1965339,1965906,
+	1966474,1967042,1967610,1968179,1968747,1969316,1969885,1970454,
+	1971023,1971592,1972162,1972732,1973301,1973871,1974441,1975012,
+	1975582,1976153,1976724,1977295,1977866,1978437,1979009,1979580,
+	1980152,1980724,1981296,1981869,1982441,1983014,1983586,1984159,
+	1984733,1985306,1985879,1986453,1987027,1987601,1988175,1988749,
+	1989324,1989898,1990473,1991048,1991623,1992198,1992774,1993349,
+	1993925,1994501,1995077,1995654,1996230,1996807,1997383,1997960,
+	1998537,1999115,1999692,2000270,2000848,2001426,2002004,2002582,
+	2003160,2003739,2004318,2004897,2005476,2006055,2006635,2007214,
+	2007794,2008374,2008954,2009534,2010115,2010695,2011276,2011857,
+	2012438,2013020,2013601,2014183,2014765,2015347,2015929,2016511,
+	2017093,2017676,2018259,2018842,2019425,2020008,2020592,2021176,
+	2021759,2022343,2022927,2023512,2024096,2024681,2025266,2025851,
+	2026436,2027021,2027607,2028193,2028778,2029364,2029951,2030537,
+	2031123,2031710,2032297,2032884,2033471,2034059,2034646,2035234,
+	2035822,2036410,2036998,2037586,2038175,2038764,2039353,2039942,
+	2040531,2041120,2041710,2042300,2042890,2043480,2044070,2044660,
+	2045251,2045842,2046433,2047024,2047615,2048207,2048798,2049390,
+	2049982,2050574,2051166,2051759,2052352,2052944,2053537,2054131,
+	2054724,2055317,2055911,2056505,2057099,2057693,2058288,2058882,
+	2059477,2060072,2060667,2061262,2061857,2062453,2063049,2063645,
+	2064241,2064837,2065433,2066030,2066627,2067224,2067821,2068418,
+	2069016,2069613,2070211,2070809,2071407,2072006,2072604,2073203,
+	2073802,2074401,2075000,2075599,2076199,2076799,2077398,2077998,
+	2078599,2079199,2079800,2080400,2081001,2081602,2082204,2082805,
+	2083407,2084009,2084611,2085213,2085815,2086418,2087020,2087623,
+	2088226,2088829,2089433,2090036,2090640,2091244,2091848,2092452,
+	2093056,2093661,2094266,2094871,2095476,2096081,2096687,2097292,
+	2097898,2098504,2099110,2099717,2100323,2100930,2101537,2102144,
+	2102751,2103358,2103966,2104574,2105181,2105790,2106398,2107006,
+	2107615,2108224,2108833,2109442,2110051,2110661,2111270,2111880,
+	2112490,2113100,2113711,2114321,2114932,2115543,2116154,2116765,
+	2117377,2117988,2118600,2119212,2119824,2120436,2121049,2121662,
+	2122274,2122887,2123501,2124114,2124728,2125341,2125955,2126569,
+	2127184,2127798,2128413,2129027,2129642,2130258,2130873,2131488,
+	2132104,2132720,2133336,2133952,2134569,2135185,2135802,2136419,
+	2137036,2137653,2138271,2138888,2139506,2140124,2140742,2141361,
+	2141979,2142598,2143217,2143836,2144455,2145075,2145694,2146314,
+	2146934,2147554,2148175,2148795,2149416,2150037,2150658,2151279,
+	2151900,2152522,2153144,2153766,2154388,2155010,2155633,2156255,
+	2156878,2157501,2158124,2158748,2159371,2159995,2160619,2161243,
+	2161867,2162492,2163116,2163741,2164366,2164991,2165617,2166242,
+	2166868,2167494,2168120,2168746,2169373,2169999,2170626,2171253,
+	2171880,2172508,2173135,2173763,2174391,2175019,2175647,2176276,
+	2176904,2177533,2178162,2178791,2179420,2180050,2180680,2181310,
+	2181940,2182570,2183200,2183831,2184462,2185093,2185724,2186355,
+	2186987,2187619,2188251,2188883,2189515,2190147,2190780,2191413,
+	2192046,2192679,2193312,2193946,2194580,2195213,2195848,2196482,
+	2197116,2197751,2198386,2199021,2199656,2200291,2200927,2201563,
+	2202199,2202835,2203471,2204107,2204744,2205381,2206018,2206655,
+	2207293,2207930,2208568,2209206,2209844,2210482,2211121,2211760,
+	2212398,2213038,2213677,2214316,2214956,2215596,2216236,2216876,
+	2217516,2218157,2218797,2219438,2220079,2220721,2221362,2222004,
+	2222646,2223288,2223930,2224572,2225215,2225858,2226500,2227144,
+	2227787,2228430,2229074,2229718,2230362,2231006,2231651,2232295,
+	2232940,2233585,2234230,2234876,2235521,2236167,2236813,2237459,
+	2238105,2238752,2239398,2240045,2240692,2241340,2241987,2242635,
+	2243282,2243930,2244579,2245227,2245875,2246524,2247173,2247822,
+	2248471,2249121,2249771,2250420,2251070,2251721,2252371,2253022,
+	2253673,2254324,2254975,2255626,2256278,2256929,2257581,2258233,
+	2258886,2259538,2260191,2260844,2261497,2262150,2262803,2263457,
+	2264111,2264765,2265419,2266073,2266728,2267383,2268038,2268693,
+	2269348,2270004,2270659,2271315,2271971,2272627,2273284,2273941,
+	2274597,2275254,2275912,2276569,2277227,2277884,2278542,2279201,
+	2279859,2280517,2281176,2281835,2282494,2283154,2283813,2284473,
+	2285133,2285793,2286453,2287113,2287774,2288435,2289096,2289757,
+	2290418,2291080,2291742,2292404,2293066,2293728,2294391,2295054,
+	2295717,2296380,2297043,2297707,2298370,2299034,2299698,2300363,
+	2301027,2301692,2302356,2303022,2303687,2304352,2305018,2305684,
+	2306350,2307016,2307682,2308349,2309016,2309683,2310350,2311017,
+	2311685,2312352,2313020,2313688,2314357,2315025,2315694,2316363,
+	2317032,2317701,2318371,2319040,2319710,2320380,2321050,2321721,
+	2322392,2323062,2323733,2324405,2325076,2325748,2326419,2327091,
+	2327764,2328436,2329109,2329781,2330454,2331127,2331801,2332474,
+	2333148,2333822,2334496,2335170,2335845,2336520,2337195,2337870,
+	2338545,2339221,2339896,2340572,2341248,2341924,2342601,2343278,
+	2343954,2344632,2345309,2345986,2346664,2347342,2348020,2348698,
+	2349376,2350055,2350734,2351413,2352092,2352772,2353451,2354131,
+	2354811,2355491,2356171,2356852,2357533,2358214,2358895,2359576,
+	2360258,2360940,2361622,2362304,2362986,2363669,2364352,2365034,
+	2365718,2366401,2367085,2367768,2368452,2369136,2369821,2370505,
+	2371190,2371875,2372560,2373245,2373931,2374617,2375302,2375989,
+	2376675,2377361,2378048,2378735,2379422,2380109,2380797,2381485,
+	2382172,2382861,2383549,2384237,2384926,2385615,2386304,2386993,
+	2387683,2388373,2389062,2389753,2390443,2391133,2391824,2392515,
+	2393206,2393897,2394589,2395280,2395972,2396664,2397357,2398049,
+	2398742,2399435,2400128,2400821,2401515,2402208,2402902,2403596,
+	2404290,2404985,2405680,2406375,2407070,2407765,2408460,2409156,
+	2409852,2410548,2411244,2411941,2412638,2413334,2414032,2414729,
+	2415426,2416124,2416822,2417520,2418218,2418917,2419616,2420315,
+	2421014,2421713,2422412,2423112,2423812,2424512,2425213,2425913,
+	2426614,2427315,2428016,2428717,2429419,2430121,2430822,2431525,
+	2432227,2432930,2433632,2434335,2435038,2435742,2436445,2437149,
+	2437853,2438557,2439262,2439966,2440671,2441376,2442081,2442787,
+	2443492,2444198,2444904,2445610,2446317,2447023,2447730,2448437,
+	2449144,2449852,2450560,2451267,2451975,2452684,2453392,2454101,
+	2454810,2455519,2456228,2456938,2457647,2458357,2459067,2459778,
+	2460488,2461199,2461910,2462621,2463332,2464044,2464755,2465467,
+	2466180,2466892,2467605,2468317,2469030,2469743,2470457,2471170,
+	2471884,2472598,2473313,2474027,2474742,2475456,2476171,2476887,
+	2477602,2478318,2479034,2479750,2480466,2481183,2481899,2482616,
+	2483333,2484051,2484768,2485486,2486204,2486922,2487640,2488359,
+	2489078,2489797,2490516,2491235,2491955,2492675,2493395,2494115,
+	2494835,2495556,2496277,2496998,2497719,2498441,2499162,2499884,
+	2500606,2501328,2502051,2502774,2503497,2504220,2504943,2505667,
+	2506390,2507114,2507839,2508563,2509288,2510012,2510737,2511463,
+	2512188,2512914,2513640,2514366,2515092,2515819,2516545,2517272,
+	2517999,2518727,2519454,2520182,2520910,2521638,2522366,2523095,
+	2523824,2524553,2525282,2526011,2526741,2527471,2528201,2528931,
+	2529662,2530393,2531123,2531855,2532586,2533317,2534049,2534781,
+	2535513,2536246,2536978,2537711,2538444,2539177,2539911,2540645,
+	2541378,2542112,2542847,2543581,2544316,2545051,2545786,2546521,
+	2547257,2547993,2548729,2549465,2550201,2550938,2551675,2552412,
+	2553149,2553887,2554624,2555362,2556100,2556839,2557577,2558316,
+	2559055,2559794,2560534,2561273,2562013,2562753,2563493,2564234,
+	2564975,2565715,2566457,2567198,2567939,2568681,2569423,2570165,
+	2570908,2571650,2572393,2573136,2573880,2574623,2575367,2576111,
+	2576855,2577599,2578344,2579088,2579833,2580579,2581324,2582070,
+	2582815,2583561,2584308,2585054,2585801,2586548,2587295,2588042,
+	2588790,2589538,2590286,2591034,2591782,2592531,2593280,2594029,
+	2594778,2595528,2596277,2597027,2597777,2598528,2599278,2600029,
+	2600780,2601532,2602283,2603035,2603787,2604539,2605291,2606044,
+	2606796,2607549,2608302,2609056,2609810,2610563,2611317,2612072,
+	2612826,2613581,2614336,2615091,2615846,2616602,2617358,2618114,
+	2618870,2619627,2620383,2621140,2621897,2622655,2623412,2624170,
+	2624928,2625686,2626445,2627203,2627962,2628721,2629481,2630240,
+	2631000,2631760,2632520,2633280,2634041,2634802,2635563,2636324,
+	2637086,2637848,2638609,2639372,2640134,2640897,2641659,2642423,
+	2643186,2643949,2644713,2645477,2646241,2647005,2647770,2648535,
+	2649300,2650065,2650831,2651596,2652362,2653128,2653895,2654661,
+	2655428,2656195,2656962,2657730,2658498,2659266,2660034,2660802,
+	2661571,2662339,2663108,2663878,2664647,2665417,2666187,2666957,
+	2667727,2668498,2669269,2670040,2670811,2671582,2672354,2673126,
+	2673898,2674671,2675443,2676216,2676989,2677762,2678536,2679309,
+	2680083,2680857,2681632,2682406,2683181,2683956,2684732,2685507,
+	2686283,2687059,2687835,2688611,2689388,2690165,2690942,2691719,
+	2692497,2693274,2694052,2694830,2695609,2696388,2697166,2697945,
+	2698725,2699504,2700284,2701064,2701844,2702625,2703405,2704186,
+	2704967,2705749,2706530,2707312,2708094,2708876,2709659,2710441,
+	2711224,2712008,2712791,2713574,2714358,2715142,2715927,2716711,
+	2717496,2718281,2719066,2719851,2720637,2721423,2722209,2722995,
+	2723782,2724569,2725356,2726143,2726930,2727718,2728506,2729294,
+	2730082,2730871,2731660,2732449,2733238,2734028,2734817,2735607,
+	2736398,2737188,2737979,2738769,2739561,2740352,2741143,2741935,
+	2742727,2743520,2744312,2745105,2745898,2746691,2747484,2748278,
+	2749072,2749866,2750660,2751455,2752249,2753044,2753840,2754635,
+	2755431,2756227,2757023,2757819,2758616,2759413,2760210,2761007,
+	2761804,2762602,2763400,2764198,2764997,2765796,2766594,2767394,
+	2768193,2768993,2769792,2770592,2771393,2772193,2772994,2773795,
+	2774596,2775398,2776199,2777001,2777803,2778606,2779408,2780211,
+	2781014,2781818,2782621,2783425,2784229,2785033,2785838,2786642,
+	2787447,2788252,2789058,2789863,2790669,2791475,2792282,2793088,
+	2793895,2794702,2795509,2796317,2797125,2797933,2798741,2799549,
+	2800358,2801167,2801976,2802785,2803595,2804405,2805215,2806025,
+	2806835,2807646,2808457,2809268,2810080,2810892,2811704,2812516,
+	2813328,2814141,2814954,2815767,2816580,2817394,2818207,2819022,
+	2819836,2820650,2821465,2822280,2823095,2823911,2824726,2825542,
+	2826359,2827175,2827992,2828808,2829626,2830443,2831261,2832078,
+	2832896,2833715,2834533,2835352,2836171,2836990,2837810,2838629,
+	2839449,2840270,2841090,2841911,2842731,2843553,2844374,2845196,
+	2846017,2846840,2847662,2848484,2849307,2850130,2850953,2851777,
+	2852601,2853425,2854249,2855073,2855898,2856723,2857548,2858374,
+	2859199,2860025,2860851,2861678,2862504,2863331,2864158,2864985,
+	2865813,2866641,2867469,2868297,2869126,2869954,2870783,2871613,
+	2872442,2873272,2874102,2874932,2875762,2876593,2877424,2878255,
+	2879087,2879918,2880750,2881582,2882415,2883247,2884080,2884913,
+	2885746,2886580,2887414,2888248,2889082,2889917,2890751,2891586,
+	2892422,2893257,2894093,2894929,2895765,2896601,2897438,2898275,
+	2899112,2899950,2900787,2901625,2902463,2903302,2904140,2904979,
+	2905818,2906658,2907497,2908337,2909177,2910017,2910858,2911699,
+	2912540,2913381,2914223,2915065,2915907,2916749,2917591,2918434,
+	2919277,2920120,2920964,2921808,2922652,2923496,2924340,2925185,
+	2926030,2926875,2927720,2928566,2929412,2930258,2931105,2931951,
+	2932798,2933645,2934493,2935340,2936188,2937036,2937885,2938733,
+	2939582,2940431,2941281,2942130,2942980,2943830,2944681,2945531,
+	2946382,2947233,2948084,2948936,2949788,2950640,2951492,2952345,
+	2953197,2954050,2954904,2955757,2956611,2957465,2958319,2959174,
+	2960029,2960884,2961739,2962594,2963450,2964306,2965162,2966019,
+	2966876,2967733,2968590,2969447,2970305,2971163,2972021,2972880,
+	2973739,2974598,2975457,2976316,2977176,2978036,2978896,2979757,
+	2980617,2981478,2982339,2983201,2984063,2984925,2985787,2986649,
+	2987512,2988375,2989238,2990102,2990965,2991829,2992693,2993558,
+	2994423,2995288,2996153,2997018,2997884,2998750,2999616,3000482,
+	3001349,3002216,3003083,3003951,3004818,3005686,3006555,3007423,
+	3008292,3009161,3010030,3010899,3011769,3012639,3013509,3014380,
+	3015250,3016121,3016993,3017864,3018736,3019608,3020480,3021352,
+	3022225,3023098,3023971,3024845,3025719,3026593,3027467,3028341,
+	3029216,3030091,3030966,3031842,3032718,3033594,3034470,3035346,
+	3036223,3037100,3037977,3038855,3039733,3040611,3041489,3042368,
+	3043246,3044125,3045005,3045884,3046764,3047644,3048525,3049405,
+	3050286,3051167,3052048,3052930,3053812,3054694,3055576,3056459,
+	3057342,3058225,3059108,3059992,3060876,3061760,3062644,3063529,
+	3064414,3065299,3066184,3067070,3067956,3068842,3069729,3070615,
+	3071502,3072390,3073277,3074165,3075053,3075941,3076829,3077718,
+	3078607,3079496,3080386,3081276,3082166,3083056,3083947,3084837,
+	3085729,3086620,3087511,3088403,3089295,3090188,3091080,3091973,
+	3092866,3093760,3094653,3095547,3096441,3097336,3098230,3099125,
+	3100021,3100916,3101812,3102708,3103604,3104500,3105397,3106294,
+	3107191,3108089,3108987,3109885,3110783,3111682,3112580,3113480,
+	3114379,3115278,3116178,3117078,3117979,3118879,3119780,3120682,
+	3121583,3122485,3123387,3124289,3125191,3126094,3126997,3127900,
+	3128804,3129707,3130611,3131516,3132420,3133325,3134230,3135136,
+	3136041,3136947,3137853,3138759,3139666,3140573,3141480,3142388,
+	3143295,3144203,3145111,3146020,3146929,3147838,3148747,3149656,
+	3150566,3151476,3152387,3153297,3154208,3155119,3156030,3156942,
+	3157854,3158766,3159679,3160591,3161504,3162417,3163331,3164245,
+	3165159,3166073,3166987,3167902,3168817,3169733,3170648,3171564,
+	3172480,3173397,3174313,3175230,3176147,3177065,3177982,3178900,
+	3179819,3180737,3181656,3182575,3183494,3184414,3185334,3186254,
+	3187174,3188095,3189016,3189937,3190858,3191780,3192702,3193624,
+	3194546,3195469,3196392,3197316,3198239,3199163,3200087,3201011,
+	3201936,3202861,3203786,3204711,3205637,3206563,3207489,3208416,
+	3209343,3210270,3211197,3212124,3213052,3213980,3214909,3215837,
+	3216766,3217695,3218625,3219555,3220485,3221415,3222345,3223276,
+	3224207,3225139,3226070,3227002,3227934,3228867,3229799,3230732,
+	3231665,3232599,3233533,3234467,3235401,3236335,3237270,3238205,
+	3239141,3240076,3241012,3241948,3242885,3243822,3244759,3245696,
+	3246633,3247571,3248509,3249448,3250386,3251325,3252264,3253204,
+	3254143,3255083,3256024,3256964,3257905,3258846,3259787,3260729,
+	3261671,3262613,3263555,3264498,3265441,3266384,3267328,3268271,
+	3269215,3270160,3271104,3272049,3272994,3273940,3274885,3275831,
+	3276778,3277724,3278671,3279618,3280565,3281513,3282461,3283409,
+	3284357,3285306,3286255,3287204,3288154,3289104,3290054,3291004,
+	3291955,3292906,3293857,3294808,3295760,3296712,3297664,3298617,
+	3299569,3300523,3301476,3302430,3303383,3304338,3305292,3306247,
+	3307202,3308157,3309113,3310069,3311025,3311981,3312938,3313895,
+	3314852,3315810,3316767,3317725,3318684,3319642,3320601,3321560,
+	3322520,3323480,3324440,3325400,3326360,3327321,3328282,3329244,
+	3330205,3331167,3332129,3333092,3334055,3335018,3335981,3336945,
+	3337909,3338873,3339837,3340802,3341767,3342732,3343698,3344664,
+	3345630,3346596,3347563,3348530,3349497,3350465,3351432,3352400,
+	3353369,3354337,3355306,3356275,3357245,3358215,3359185,3360155,
+	3361126,3362096,3363068,3364039,3365011,3365983,3366955,3367928,
+	3368900,3369874,3370847,3371821,3372795,3373769,3374743,3375718,
+	3376693,3377669,3378644,3379620,3380596,3381573,3382550,3383527,
+	3384504,3385482,3386460,3387438,3388416,3389395,3390374,3391353,
+	3392333,3393313,3394293,3395273,3396254,3397235,3398217,3399198,
+	3400180,3401162,3402145,3403127,3404110,3405094,3406077,3407061,
+	3408045,3409030,3410014,3410999,3411985,3412970,3413956,3414942,
+	3415929,3416915,3417902,3418889,3419877,3420865,3421853,3422841,
+	3423830,3424819,3425808,3426798,3427788,3428778,3429768,3430759,
+	3431750,3432741,3433733,3434725,3435717,3436709,3437702,3438695,
+	3439688,3440682,3441676,3442670,3443664,3444659,3445654,3446649,
+	3447645,3448641,3449637,3450633,3451630,3452627,3453624,3454622,
+	3455620,3456618,3457616,3458615,3459614,3460613,3461613,3462613,
+	3463613,3464614,3465614,3466615,3467617,3468618,3469620,3470623,
+	3471625,3472628,3473631,3474634,3475638,3476642,3477646,3478651,
+	3479655,3480661,3481666,3482672,3483678,3484684,3485690,3486697,
+	3487704,3488712,3489720,3490728,3491736,3492745,3493753,3494763,
+	3495772,3496782,3497792,3498802,3499813,3500824,3501835,3502847,
+	3503858,3504870,3505883,3506896,3507909,3508922,3509935,3510949,
+	3511963,3512978,3513993,3515008,3516023,3517038,3518054,3519071,
+	3520087,3521104,3522121,3523138,3524156,3525174,3526192,3527211,
+	3528230,3529249,3530268,3531288,3532308,3533328,3534349,3535370,
+	3536391,3537412,3538434,3539456,3540479,3541501,3542524,3543548,
+	3544571,3545595,3546619,3547644,3548668,3549693,3550719,3551744,
+	3552770,3553797,3554823,3555850,3556877,3557904,3558932,3559960,
+	3560989,3562017,3563046,3564075,3565105,3566134,3567165,3568195,
+	3569226,3570257,3571288,3572319,3573351,3574384,3575416,3576449,
+	3577482,3578515,3579549,3580583,3581617,3582652,3583687,3584722,
+	3585757,3586793,3587829,3588865,3589902,3590939,3591976,3593014,
+	3594052,3595090,3596128,3597167,3598206,3599245,3600285,3601325,
+	3602365,3603406,3604447,3605488,3606529,3607571,3608613,3609655,
+	3610698,3611741,3612784,3613828,3614872,3615916,3616960,3618005,
+	3619050,3620096,3621141,3622187,3623233,3624280,3625327,3626374,
+	3627422,3628469,3629518,3630566,3631615,3632664,3633713,3634763,
+	3635812,3636863,3637913,3638964,3640015,3641067,3642118,3643170,
+	3644223,3645275,3646328,3647382,3648435,3649489,3650543,3651598,
+	3652652,3653707,3654763,3655818,3656874,3657931,3658987,3660044,
+	3661102,3662159,3663217,3664275,3665333,3666392,3667451,3668511,
+	3669570,3670630,3671690,3672751,3673812,3674873,3675935,3676996,
+	3678059,3679121,3680184,3681247,3682310,3683374,3684438,3685502,
+	3686566,3687631,3688697,3689762,3690828,3691894,3692960,3694027,
+	3695094,3696161,3697229,3698297,3699365,3700434,3701503,3702572,
+	3703641,3704711,3705781,3706852,3707923,3708994,3710065,3711137,
+	3712209,3713281,3714353,3715426,3716500,3717573,3718647,3719721,
+	3720796,3721870,3722945,3724021,3725096,3726172,3727249,3728325,
+	3729402,3730480,3731557,3732635,3733713,3734792,3735870,3736950,
+	3738029,3739109,3740189,3741269,3742350,3743431,3744512,3745594,
+	3746676,3747758,3748840,3749923,3751007,3752090,3753174,3754258,
+	3755342,3756427,3757512,3758598,3759683,3760769,3761856,3762942,
+	3764029,3765116,3766204,3767292,3768380,3769468,3770557,3771646,
+	3772736,3773826,3774916,3776006,3777097,3778188,3779279,3780371,
+	3781463,3782555,3783648,3784741,3785834,3786927,3788021,3789115,
+	3790210,3791305,3792400,3793495,3794591,3795687,3796784,3797880,
+	3798977,3800075,3801172,3802270,3803369,3804467,3805566,3806665,
+	3807765,3808865,3809965,3811066,3812166,3813268,3814369,3815471,
+	3816573,3817675,3818778,3819881,3820985,3822088,3823192,3824297,
+	3825401,3826506,3827612,3828717,3829823,3830929,3832036,3833143,
+	3834250,3835358,3836465,3837574,3838682,3839791,3840900,3842010,
+	3843119,3844229,3845340,3846451,3847562,3848673,3849785,3850897,
+	3852009,3853122,3854235,3855348,3856462,3857576,3858690,3859804,
+	3860919,3862035,3863150,3864266,3865382,3866499,3867616,3868733,
+	3869850,3870968,3872086,3873205,3874324,3875443,3876562,3877682,
+	3878802,3879922,3881043,3882164,3883285,3884407,3885529,3886652,
+	3887774,3888897,3890021,3891144,3892268,3893392,3894517,3895642,
+	3896767,3897893,3899019,3900145,3901272,3902398,3903526,3904653,
+	3905781,3906909,3908038,3909167,3910296,3911425,3912555,3913685,
+	3914816,3915947,3917078,3918209,3919341,3920473,3921606,3922738,
+	3923871,3925005,3926139,3927273,3928407,3929542,3930677,3931812,
+	3932948,3934084,3935220,3936357,3937494,3938631,3939769,3940907,
+	3942045,3943184,3944323,3945463,3946602,3947742,3948882,3950023,
+	3951164,3952305,3953447,3954589,3955731,3956874,3958017,3959160,
+	3960304,3961448,3962592,3963737,3964882,3966027,3967172,3968318,
+	3969465,3970611,3971758,3972905,3974053,3975201,3976349,3977498,
+	3978647,3979796,3980945,3982095,3983246,3984396,3985547,3986698,
+	3987850,3989002,3990154,3991307,3992459,3993613,3994766,3995920,
+	3997074,3998229,3999384,4000539,4001695,4002851,4004007,4005163,
+	4006320,4007478,4008635,4009793,4010951,4012110,4013269,4014428,
+	4015588,4016747,4017908,4019068,4020229,4021390,4022552,4023714,
+	4024876,4026039,4027202,4028365,4029529,4030693,4031857,4033021,
+	4034186,4035352,4036517,4037683,4038850,4040016,4041183,4042351,
+	4043518,4044686,4045854,4047023,4048192,4049361,4050531,4051701,
+	4052871,4054042,4055213,4056385,4057556,4058728,4059901,4061073,
+	4062246,4063420,4064594,4065768,4066942,4068117,4069292,4070467,
+	4071643,4072819,4073996,4075172,4076350,4077527,4078705,4079883,
+	4081061,4082240,4083419,4084599,4085779,4086959,4088139,4089320,
+	4090502,4091683,4092865,4094047,4095230,4096413,4097596,4098780,
+	4099964,4101148,4102332,4103517,4104703,4105888,4107074,4108261,
+	4109447,4110634,4111822,4113010,4114198,4115386,4116575,4117764,
+	4118953,4120143,4121333,4122524,4123714,4124906,4126097,4127289,
+	4128481,4129674,4130866,4132060,4133253,4134447,4135641,4136836,
+	4138031,4139226,4140422,4141618,4142814,4144011,4145208,4146405,
+	4147603,4148801,4149999,4151198,4152397,4153597,4154796,4155996,
+	4157197,4158398,4159599,4160800,4162002,4163204,4164407,4165610,
+	4166813,4168017,4169221,4170425,4171630,4172835,4174040,4175246,
+	4176452,4177658,4178865,4180072,4181279,4182487,4183695,4184904,
+	4186112,4187322,4188531,4189741,4190951,4192162,4193373,4194584,
+	4195796,4197008,4198220,4199433,4200646,4201859,4203073,4204287,
+	4205501,4206716,4207931,4209147,4210362,4211579,4212795,4214012,
+	4215229,4216447,4217665,4218883,4220102,4221321,4222540,4223760,
+	4224980,4226200,4227421,4228642,4229863,4231085,4232307,4233530,
+	4234753,4235976,4237200,4238424,4239648,4240872,4242097,4243323,
+	4244548,4245774,4247001,4248228,4249455,4250682,4251910,4253138,
+	4254367,4255596,4256825,4258054,4259284,4260515,4261745,4262976,
+	4264208,4265440,4266672,4267904,4269137,4270370,4271604,4272837,
+	4274072,4275306,4276541,4277776,4279012,4280248,4281484,4282721,
+	4283958,4285196,4286433,4287672,4288910,4290149,4291388,4292628,
+	4293868,4295108,4296349,4297590,4298831,4300073,4301315,4302557,
+	4303800,4305043,4306287,4307531,4308775,4310020,4311265,4312510,
+	4313756,4315002,4316248,4317495,4318742,4319989,4321237,4322485,
+	4323734,4324983,4326232,4327482,4328732,4329982,4331233,4332484,
+	4333735,4334987,4336239,4337492,4338745,4339998,4341252,4342506,
+	4343760,4345015,4346270,4347525,4348781,4350037,4351294,4352551,
+	4353808,4355065,4356323,4357582,4358840,4360100,4361359,4362619,
+	4363879,4365139,4366400,4367662,4368923,4370185,4371448,4372710,
+	4373973,4375237,4376501,4377765,4379029,4380294,4381559,4382825,
+	4384091,4385357,4386624,4387891,4389159,4390426,4391695,4392963,
+	4394232,4395501,4396771,4398041,4399311,4400582,4401853,4403125,
+	4404397,4405669,4406941,4408214,4409488,4410761,4412036,4413310,
+	4414585,4415860,4417135,4418411,4419688,4420964,4422241,4423519,
+	4424796,4426075,4427353,4428632,4429911,4431191,4432471,4433751,
+	4435032,4436313,4437594,4438876,4440158,4441441,4442724,4444007,
+	4445291,4446575,4447859,4449144,4450429,4451715,4453000,4454287,
+	4455573,4456860,4458148,4459435,4460724,4462012,4463301,4464590,
+	4465880,4467170,4468460,4469751,4471042,4472333,4473625,4474917,
+	4476210,4477503,4478796,4480090,4481384,4482679,4483973,4485269,
+	4486564,4487860,4489157,4490453,4491750,4493048,4494346,4495644,
+	4496942,4498241,4499541,4500840,4502140,4503441,4504742,4506043,
+	4507345,4508647,4509949,4511252,4512555,4513858,4515162,4516466,
+	4517771,4519076,4520381,4521687,4522993,4524299,4525606,4526913,
+	4528221,4529529,4530837,4532146,4533455,4534765,4536075,4537385,
+	4538696,4540007,4541318,4542630,4543942,4545254,4546567,4547881,
+	4549194,4550508,4551823,4553138,4554453,4555768,4557084,4558401,
+	4559717,4561034,4562352,4563670,4564988,4566307,4567626,4568945,
+	4570265,4571585,4572905,4574226,4575548,4576869,4578191,4579514,
+	4580836,4582160,4583483,4584807,4586132,4587456,4588781,4590107,
+	4591433,4592759,4594086,4595413,4596740,4598068,4599396,4600725,
+	4602053,4603383,4604712,4606043,4607373,4608704,4610035,4611367,
+	4612699,4614031,4615364,4616697,4618031,4619365,4620699,4622034,
+	4623369,4624704,4626040,4627376,4628713,4630050,4631387,4632725,
+	4634063,4635402,4636741,4638080,4639420,4640760,4642100,4643441,
+	4644783,4646124,4647466,4648809,4650152,4651495,4652838,4654182,
+	4655527,4656871,4658217,4659562,4660908,4662254,4663601,4664948,
+	4666296,4667644,4668992,4670340,4671690,4673039,4674389,4675739,
+	4677090,4678441,4679792,4681144,4682496,4683848,4685201,4686555,
+	4687908,4689263,4690617,4691972,4693327,4694683,4696039,4697395,
+	4698752,4700110,4701467,4702825,4704184,4705543,4706902,4708261,
+	4709621,4710982,4712342,4713704,4715065,4716427,4717790,4719152,
+	4720515,4721879,4723243,4724607,4725972,4727337,4728703,4730068,
+	4731435,4732801,4734169,4735536,4736904,4738272,4739641,4741010,
+	4742379,4743749,4745119,4746490,4747861,4749233,4750604,4751977,
+	4753349,4754722,4756096,4757469,4758844,4760218,4761593,4762969,
+	4764344,4765721,4767097,4768474,4769852,4771229,4772608,4773986,
+	4775365,4776745,4778124,4779505,4780885,4782266,4783647,4785029,
+	4786411,4787794,4789177,4790560,4791944,4793328,4794713,4796098,
+	4797483,4798869,4800255,4801642,4803029,4804416,4805804,4807192,
+	4808580,4809969,4811359,4812749,4814139,4815529,4816920,4818312,
+	4819703,4821096,4822488,4823881,4825275,4826668,4828063,4829457,
+	4830852,4832248,4833643,4835040,4836436,4837833,4839231,4840629,
+	4842027,4843425,4844824,4846224,4847624,4849024,4850425,4851826,
+	4853227,4854629,4856031,4857434,4858837,4860241,4861644,4863049,
+	4864453,4865859,4867264,4868670,4870076,4871483,4872890,4874298,
+	4875706,4877114,4878523,4879932,4881342,4882752,4884162,4885573,
+	4886984,4888396,4889808,4891220,4892633,4894046,4895460,4896874,
+	4898288,4899703,4901119,4902534,4903950,4905367,4906784,4908201,
+	4909619,4911037,4912456,4913875,4915294,4916714,4918134,4919555,
+	4920976,4922397,4923819,4925241,4926664,4928087,4929510,4930934,
+	4932359,4933783,4935209,4936634,4938060,4939486,4940913,4942340,
+	4943768,4945196,4946625,4948053,4949483,4950912,4952342,4953773,
+	4955204,4956635,4958067,4959499,4960932,4962365,4963798,4965232,
+	4966666,4968101,4969536,4970971,4972407,4973843,4975280,4976717,
+	4978155,4979593,4981031,4982470,4983909,4985349,4986789,4988229,
+	4989670,4991111,4992553,4993995,4995438,4996881,4998324,4999768,
+	5001212,5002656,5004102,5005547,5006993,5008439,5009886,5011333,
+	5012780,5014228,5015677,5017126,5018575,5020024,5021474,5022925,
+	5024376,5025827,5027279,5028731,5030184,5031637,5033090,5034544,
+	5035998,5037453,5038908,5040363,5041819,5043276,5044732,5046190,
+	5047647,5049105,5050564,5052022,5053482,5054941,5056402,5057862,
+	5059323,5060785,5062246,5063709,5065171,5066634,5068098,5069562,
+	5071026,5072491,5073956,5075422,5076888,5078354,5079821,5081289,
+	5082756,5084224,5085693,5087162,5088631,5090101,5091572,5093042,
+	5094514,5095985,5097457,5098929,5100402,5101876,5103349,5104823,
+	5106298,5107773,5109248,5110724,5112200,5113677,5115154,5116632,
+	5118110,5119588,5121067,5122546,5124026,5125506,5126986,5128467,
+	5129949,5131430,5132913,5134395,5135878,5137362,5138846,5140330,
+	5141815,5143300,5144786,5146272,5147759,5149245,5150733,5152221,
+	5153709,5155198,5156687,5158176,5159666,5161157,5162647,5164139,
+	5165630,5167122,5168615,5170108,5171601,5173095,5174589,5176084,
+	5177579,5179075,5180571,5182067,5183564,5185061,5186559,5188057,
+	5189556,5191055,5192554,5194054,5195554,5197055,5198556,5200058,
+	5201560,5203063,5204565,5206069,5207573,5209077,5210581,5212087,
+	5213592,5215098,5216604,5218111,5219619,5221126,5222634,5224143,
+	5225652,5227161,5228671,5230182,5231692,5233204,5234715,5236227,
+	5237740,5239253,5240766,5242280,5243794,5245309,5246824,5248340,
+	5249856,5251372,5252889,5254406,5255924,5257442,5258961,5260480,
+	5261999,5263519,5265040,5266560,5268082,5269603,5271126,5272648,
+	5274171,5275695,5277218,5278743,5280268,5281793,5283318,5284845,
+	5286371,5287898,5289426,5290953,5292482,5294010,5295540,5297069,
+	5298599,5300130,5301661,5303192,5304724,5306256,5307789,5309322,
+	5310856,5312390,5313924,5315459,5316995,5318531,5320067,5321604,
+	5323141,5324678,5326216,5327755,5329294,5330833,5332373,5333913,
+	5335454,5336995,5338537,5340079,5341621,5343164,5344708,5346252,
+	5347796,5349341,5350886,5352431,5353977,5355524,5357071,5358618,
+	5360166,5361714,5363263,5364812,5366362,5367912,5369463,5371014,
+	5372565,5374117,5375669,5377222,5378775,5380329,5381883,5383438,
+	5384993,5386548,5388104,5389660,5391217,5392775,5394332,5395890,
+	5397449,5399008,5400568,5402128,5403688,5405249,5406810,5408372,
+	5409934,5411497,5413060,5414624,5416188,5417752,5419317,5420882,
+	5422448,5424015,5425581,5427148,5428716,5430284,5431853,5433422,
+	5434991,5436561,5438132,5439702,5441274,5442845,5444418,5445990,
+	5447563,5449137,5450711,5452285,5453860,5455436,5457011,5458588,
+	5460164,5461742,5463319,5464897,5466476,5468055,5469634,5471214,
+	5472795,5474375,5475957,5477538,5479121,5480703,5482286,5483870,
+	5485454,5487039,5488623,5490209,5491795,5493381,5494968,5496555,
+	5498143,5499731,5501320,5502909,5504498,5506088,5507679,5509270,
+	5510861,5512453,5514045,5515638,5517231,5518825,5520419,5522013,
+	5523608,5525204,5526800,5528396,5529993,5531591,5533188,5534787,
+	5536385,5537985,5539584,5541184,5542785,5544386,5545988,5547590,
+	5549192,5550795,5552398,5554002,5555606,5557211,5558816,5560422,
+	5562028,5563635,5565242,5566849,5568457,5570066,5571675,5573284,
+	5574894,5576504,5578115,5579726,5581338,5582950,5584563,5586176,
+	5587790,5589404,5591018,5592633,5594249,5595865,5597481,5599098,
+	5600715,5602333,5603951,5605570,5607189,5608809,5610429,5612049,
+	5613670,5615292,5616914,5618536,5620159,5621783,5623407,5625031,
+	5626656,5628281,5629907,5631533,5633160,5634787,5636414,5638043,
+	5639671,5641300,5642930,5644560,5646190,5647821,5649452,5651084,
+	5652717,5654349,5655983,5657616,5659251,5660885,5662521,5664156,
+	5665792,5667429,5669066,5670703,5672341,5673980,5675619,5677258,
+	5678898,5680539,5682179,5683821,5685462,5687105,5688747,5690391,
+	5692034,5693679,5695323,5696968,5698614,5700260,5701906,5703553,
+	5705201,5706849,5708497,5710146,5711796,5713446,5715096,5716747,
+	5718398,5720050,5721702,5723355,5725008,5726662,5728316,5729970,
+	5731626,5733281,5734937,5736594,5738251,5739908,5741566,5743225,
+	5744884,5746543,5748203,5749863,5751524,5753186,5754848,5756510,
+	5758173,5759836,5761500,5763164,5764829,5766494,5768159,5769826,
+	5771492,5773159,5774827,5776495,5778164,5779833,5781502,5783172,
+	5784843,5786514,5788185,5789857,5791529,5793202,5794876,5796550,
+	5798224,5799899,5801574,5803250,5804926,5806603,5808280,5809958,
+	5811636,5813315,5814994,5816674,5818354,5820034,5821716,5823397,
+	5825079,5826762,5828445,5830129,5831813,5833497,5835182,5836868,
+	5838554,5840240,5841927,5843615,5845303,5846991,5848680,5850369,
+	5852059,5853750,5855440,5857132,5858824,5860516,5862209,5863902,
+	5865596,5867290,5868985,5870680,5872376,5874072,5875769,5877466,
+	5879164,5880862,5882561,5884260,5885960,5887660,5889361,5891062,
+	5892764,5894466,5896168,5897871,5899575,5901279,5902984,5904689,
+	5906394,5908100,5909807,5911514,5913222,5914930,5916638,5918347,
+	5920057,5921767,5923477,5925188,5926900,5928612,5930324,5932037,
+	5933751,5935465,5937179,5938894,5940610,5942326,5944042,5945759,
+	5947477,5949195,5950913,5952632,5954351,5956071,5957792,5959513,
+	5961234,5962956,5964678,5966401,5968125,5969849,5971573,5973298,
+	5975023,5976749,5978476,5980203,5981930,5983658,5985386,5987115,
+	5988845,5990575,5992305,5994036,5995767,5997499,5999231,6000964,
+	6002698,6004432,6006166,6007901,6009636,6011372,6013109,6014846,
+	6016583,6018321,6020059,6021798,6023538,6025278,6027018,6028759,
+	6030500,6032242,6033985,6035728,6037471,6039215,6040959,6042704,
+	6044450,6046196,6047942,6049689,6051437,6053185,6054933,6056682,
+	6058432,6060182,6061932,6063683,6065435,6067187,6068939,6070692,
+	6072446,6074200,6075954,6077709,6079465,6081221,6082978,6084735,
+	6086492,6088250,6090009,6091768,6093528,6095288,6097049,6098810,
+	6100571,6102334,6104096,6105859,6107623,6109387,6111152,6112917,
+	6114683,6116449,6118216,6119983,6121751,6123519,6125288,6127057,
+	6128827,6130598,6132368,6134140,6135912,6137684,6139457,6141230,
+	6143004,6144779,6146554,6148329,6150105,6151881,6153658,6155436,
+	6157214,6158992,6160772,6162551,6164331,6166112,6167893,6169674,
+	6171457,6173239,6175022,6176806,6178590,6180375,6182160,6183946,
+	6185732,6187519,6189306,6191094,6192882,6194671,6196460,6198250,
+	6200041,6201832,6203623,6205415,6207207,6209000,6210794,6212588,
+	6214382,6216177,6217973,6219769,6221566,6223363,6225160,6226959,
+	6228757,6230556,6232356,6234156,6235957,6237758,6239560,6241363,
+	6243165,6244969,6246773,6248577,6250382,6252187,6253993,6255800,
+	6257607,6259414,6261222,6263031,6264840,6266650,6268460,6270271,
+	6272082,6273893,6275706,6277518,6279332,6281146,6282960,6284775,
+	6286590,6288406,6290222,6292039,6293857,6295675,6297493,6299312,
+	6301132,6302952,6304773,6306594,6308416,6310238,6312060,6313884,
+	6315708,6317532,6319357,6321182,6323008,6324834,6326661,6328489,
+	6330317,6332145,6333974,6335804,6337634,6339465,6341296,6343128,
+	6344960,6346793,6348626,6350460,6352294,6354129,6355964,6357800,
+	6359637,6361474,6363311,6365149,6366988,6368827,6370667,6372507,
+	6374348,6376189,6378031,6379873,6381716,6383559,6385403,6387248,
+	6389092,6390938,6392784,6394631,6396478,6398325,6400174,6402022,
+	6403871,6405721,6407572,6409422,6411274,6413126,6414978,6416831,
+	6418685,6420539,6422393,6424248,6426104,6427960,6429817,6431674,
+	6433532,6435390,6437249,6439109,6440969,6442829,6444690,6446552,
+	6448414,6450277,6452140,6454003,6455868,6457733,6459598,6461464,
+	6463330,6465197,6467065,6468933,6470801,6472670,6474540,6476410,
+	6478281,6480152,6482024,6483896,6485769,6487643,6489517,6491391,
+	6493266,6495142,6497018,6498895,6500772,6502650,6504528,6506407,
+	6508286,6510166,6512047,6513928,6515809,6517691,6519574,6521457,
+	6523341,6525225,6527110,6528995,6530881,6532768,6534655,6536542,
+	6538430,6540319,6542208,6544098,6545988,6547879,6549770,6551662,
+	6553555,6555448,6557341,6559236,6561130,6563025,6564921,6566817,
+	6568714,6570612,6572510,6574408,6576307,6578207,6580107,6582008,
+	6583909,6585811,6587713,6589616,6591519,6593423,6595328,6597233,
+	6599138,6601045,6602951,6604859,6606766,6608675,6610584,6612493,
+	6614403,6616314,6618225,6620137,6622049,6623962,6625875,6627789,
+	6629704,6631619,6633534,6635450,6637367,6639284,6641202,6643120,
+	6645039,6646959,6648879,6650799,6652720,6654642,6656564,6658487,
+	6660410,6662334,6664258,6666183,6668109,6670035,6671962,6673889,
+	6675817,6677745,6679674,6681603,6683533,6685464,6687395,6689327,
+	6691259,6693192,6695125,6697059,6698994,6700929,6702864,6704800,
+	6706737,6708674,6710612,6712550,6714489,6716429,6718369,6720310,
+	6722251,6724192,6726135,6728078,6730021,6731965,6733910,6735855,
+	6737800,6739747,6741693,6743641,6745589,6747537,6749486,6751436,
+	6753386,6755337,6757288,6759240,6761192,6763145,6765099,6767053,
+	6769008,6770963,6772919,6774875,6776832,6778790,6780748,6782706,
+	6784665,6786625,6788586,6790546,6792508,6794470,6796433,6798396,
+	6800360,6802324,6804289,6806254,6808220,6810187,6812154,6814122,
+	6816090,6818059,6820028,6821998,6823969,6825940,6827911,6829884,
+	6831857,6833830,6835804,6837778,6839754,6841729,6843706,6845682,
+	6847660,6849638,6851616,6853595,6855575,6857555,6859536,6861518,
+	6863499,6865482,6867465,6869449,6871433,6873418,6875403,6877389,
+	6879376,6881363,6883351,6885339,6887328,6889317,6891307,6893298,
+	6895289,6897281,6899273,6901266,6903259,6905253,6907248,6909243,
+	6911239,6913235,6915232,6917230,6919228,6921226,6923226,6925225,
+	6927226,6929227,6931228,6933230,6935233,6937236,6939240,6941245,
+	6943250,6945255,6947261,6949268,6951275,6953283,6955292,6957301,
+	6959310,6961321,6963331,6965343,6967355,6969367,6971380,6973394,
+	6975408,6977423,6979439,6981455,6983471,6985489,6987506,6989525,
+	6991544,6993563,6995583,6997604,6999625,7001647,7003670,7005693,
+	7007716,7009740,7011765,7013791,7015817,7017843,7019870,7021898,
+	7023926,7025955,7027985,7030015,7032045,7034076,7036108,7038141,
+	7040174,7042207,7044241,7046276,7048311,7050347,7052384,7054421,
+	7056459,7058497,7060536,7062575,7064615,7066656,7068697,7070739,
+	7072781,7074824,7076868,7078912,7080957,7083002,7085048,7087095,
+	7089142,7091190,7093238,7095287,7097336,7099386,7101437,7103488,
+	7105540,7107593,7109646,7111699,7113754,7115808,7117864,7119920,
+	7121977,7124034,7126092,7128150,7130209,7132268,7134329,7136389,
+	7138451,7140513,7142575,7144638,7146702,7148767,7150832,7152897,
+	7154963,7157030,7159097,7161165,7163234,7165303,7167373,7169443,
+	7171514,7173585,7175657,7177730,7179803,7181877,7183952,7186027,
+	7188103,7190179,7192256,7194333,7196411,7198490,7200569,7202649,
+	7204730,7206811,7208893,7210975,7213058,7215141,7217226,7219310,
+	7221396,7223482,7225568,7227655,7229743,7231831,7233920,7236010,
+	7238100,7240191,7242282,7244374,7246466,7248560,7250653,7252748,
+	7254843,7256938,7259035,7261131,7263229,7265327,7267425,7269525,
+	7271624,7273725,7275826,7277927,7280030,7282133,7284236,7286340,
+	7288445,7290550,7292656,7294763,7296870,7298977,7301086,7303195,
+	7305304,7307414,7309525,7311636,7313748,7315861,7317974,7320088,
+	7322203,7324318,7326433,7328549,7330666,7332784,7334902,7337021,
+	7339140,7341260,7343380,7345502,7347623,7349746,7351869,7353992,
+	7356117,7358241,7360367,7362493,7364620,7366747,7368875,7371003,
+	7373132,7375262,7377393,7379524,7381655,7383787,7385920,7388054,
+	7390188,7392322,7394458,7396594,7398730,7400867,7403005,7405143,
+	7407282,7409422,7411562,7413703,7415845,7417987,7420129,7422273,
+	7424417,7426561,7428706,7430852,7432999,7435146,7437293,7439442,
+	7441591,7443740,7445890,7448041,7450192,7452344,7454497,7456650,
+	7458804,7460959,7463114,7465269,7467426,7469583,7471740,7473899,
+	7476058,7478217,7480377,7482538,7484699,7486861,7489024,7491187,
+	7493351,7495515,7497680,7499846,7502013,7504180,7506347,7508515,
+	7510684,7512854,7515024,7517195,7519366,7521538,7523711,7525884,
+	7528058,7530232,7532407,7534583,7536759,7538936,7541114,7543292,
+	7545471,7547651,7549831,7552012,7554193,7556375,7558558,7560741,
+	7562925,7565110,7567295,7569481,7571667,7573854,7576042,7578230,
+	7580419,7582609,7584799,7586990,7589182,7591374,7593567,7595760,
+	7597954,7600149,7602344,7604540,7606737,7608934,7611132,7613330,
+	7615529,7617729,7619930,7622131,7624332,7626535,7628738,7630941,
+	7633145,7635350,7637556,7639762,7641969,7644176,7646384,7648593,
+	7650802,7653012,7655223,7657434,7659646,7661858,7664071,7666285,
+	7668500,7670715,7672930,7675147,7677364,7679581,7681800,7684019,
+	7686238,7688458,7690679,7692901,7695123,7697346,7699569,7701793,
+	7704018,7706243,7708469,7710696,7712923,7715151,7717379,7719608,
+	7721838,7724069,7726300,7728532,7730764,7732997,7735231,7737465,
+	7739700,7741936,7744172,7746409,7748647,7750885,7753124,7755363,
+	7757603,7759844,7762086,7764328,7766570,7768814,7771058,7773303,
+	7775548,7777794,7780041,7782288,7784536,7786784,7789034,7791283,
+	7793534,7795785,7798037,7800290,7802543,7804796,7807051,7809306,
+	7811562,7813818,7816075,7818333,7820591,7822850,7825110,7827370,
+	7829631,7831893,7834155,7836418,7838681,7840946,7843211,7845476,
+	7847742,7850009,7852277,7854545,7856814,7859083,7861353,7863624,
+	7865895,7868167,7870440,7872714,7874988,7877262,7879538,7881814,
+	7884090,7886368,7888646,7890925,7893204,7895484,7897764,7900046,
+	7902328,7904610,7906894,7909177,7911462,7913747,7916033,7918320,
+	7920607,7922895,7925183,7927473,7929763,7932053,7934344,7936636,
+	7938929,7941222,7943516,7945810,7948105,7950401,7952698,7954995,
+	7957293,7959591,7961890,7964190,7966491,7968792,7971094,7973396,
+	7975699,7978003,7980307,7982613,7984918,7987225,7989532,7991840,
+	7994148,7996457,7998767,8001078,8003389,8005701,8008013,8010326,
+	8012640,8014955,8017270,8019585,8021902,8024219,8026537,8028855,
+	8031175,8033494,8035815,8038136,8040458,8042780,8045104,8047427,
+	8049752,8052077,8054403,8056730,8059057,8061385,8063713,8066042,
+	8068372,8070703,8073034,8075366,8077699,8080032,8082366,8084701,
+	8087036,8089372,8091708,8094046,8096384,8098722,8101062,8103402,
+	8105742,8108084,8110426,8112769,8115112,8117456,8119801,8122146,
+	8124492,8126839,8129187,8131535,8133884,8136233,8138583,8140934,
+	8143286,8145638,8147991,8150344,8152699,8155053,8157409,8159765,
+	8162122,8164480,8166838,8169197,8171557,8173917,8176278,8178640,
+	8181003,8183366,8185730,8188094,8190459,8192825,8195192,8197559,
+	8199927,8202295,8204664,8207034,8209405,8211776,8214148,8216521,
+	8218894,8221268,8223643,8226019,8228395,8230771,8233149,8235527,
+	8237906,8240286,8242666,8245047,8247428,8249811,8252194,8254577,
+	8256962,8259347,8261732,8264119,8266506,8268894,8271282,8273671,
+	8276061,8278452,8280843,8283235,8285628,8288021,8290415,8292810,
+	8295205,8297601,8299998,8302396,8304794,8307193,8309592,8311992,
+	8314393,8316795,8319197,8321600,8324004,8326408,8328814,8331219,
+	8333626,8336033,8338441,8340850,8343259,8345669,8348079,8350491,
+	8352903,8355316,8357729,8360143,8362558,8364974,8367390,8369807,
+	8372224,8374643,8377062,8379482,8381902,8384323,8386745,8389168,
+	8391591,8394015,8396439,8398865,8401291,8403717,8406145,8408573,
+	8411002,8413431,8415862,8418293,8420724,8423157,8425590,8428023,
+	8430458,8432893,8435329,8437766,8440203,8442641,8445079,8447519,
+	8449959,8452400,8454841,8457283,8459726,8462170,8464614,8467059,
+	8469505,8471951,8474399,8476847,8479295,8481744,8484194,8486645,
+	8489096,8491548,8494001,8496455,8498909,8501364,8503820,8506276,
+	8508733,8511191,8513649,8516108,8518568,8521029,8523490,8525952,
+	8528415,8530879,8533343,8535808,8538273,8540740,8543207,8545674,
+	8548143,8550612,8553082,8555552,8558024,8560496,8562968,8565442,
+	8567916,8570391,8572866,8575343,8577820,8580297,8582776,8585255,
+	8587735,8590216,8592697,8595179,8597662,8600145,8602629,8605114,
+	8607600,8610086,8612573,8615061,8617549,8620039,8622529,8625019,
+	8627511,8630003,8632495,8634989,8637483,8639978,8642474,8644970,
+	8647467,8649965,8652464,8654963,8657463,8659964,8662465,8664967,
+	8667470,8669974,8672478,8674983,8677489,8679996,8682503,8685011,
+	8687520,8690029,8692539,8695050,8697562,8700074,8702587,8705101,
+	8707615,8710130,8712646,8715163,8717680,8720199,8722717,8725237,
+	8727757,8730278,8732800,8735323,8737846,8740370,8742895,8745420,
+	8747946,8750473,8753001,8755529,8758058,8760588,8763118,8765650,
+	8768181,8770714,8773248,8775782,8778317,8780852,8783389,8785926,
+	8788464,8791002,8793542,8796082,8798622,8801164,8803706,8806249,
+	8808793,8811337,8813882,8816428,8818975,8821522,8824071,8826619,
+	8829169,8831719,8834270,8836822,8839375,8841928,8844482,8847037,
+	8849592,8852149,8854706,8857263,8859822,8862381,8864941,8867501,
+	8870063,8872625,8875188,8877751,8880316,8882881,8885447,8888013,
+	8890581,8893149,8895718,8898287,8900857,8903429,8906000,8908573,
+	8911146,8913720,8916295,8918870,8921447,8924024,8926601,8929180,
+	8931759,8934339,8936920,8939501,8942083,8944666,8947250,8949834,
+	8952420,8955006,8957592,8960180,8962768,8965357,8967946,8970537,
+	8973128,8975720,8978313,8980906,8983500,8986095,8988691,8991287,
+	8993884,8996482,8999081,9001680,9004280,9006881,9009483,9012085,
+	9014689,9017293,9019897,9022503,9025109,9027716,9030323,9032932,
+	9035541,9038151,9040762,9043373,9045985,9048598,9051212,9053826,
+	9056442,9059058,9061674,9064292,9066910,9069529,9072149,9074769,
+	9077391,9080013,9082636,9085259,9087883,9090508,9093134,9095761,
+	9098388,9101016,9103645,9106275,9108905,9111536,9114168,9116801,
+	9119434,9122068,9124703,9127339,9129976,9132613,9135251,9137889,
+	9140529,9143169,9145810,9148452,9151095,9153738,9156382,9159027,
+	9161672,9164319,9166966,9169614,9172263,9174912,9177562,9180213,
+	9182865,9185517,9188171,9190825,9193480,9196135,9198791,9201449,
+	9204106,9206765,9209424,9212085,9214746,9217407,9220070,9222733,
+	9225397,9228062,9230727,9233394,9236061,9238729,9241397,9244067,
+	9246737,9249408,9252079,9254752,9257425,9260099,9262774,9265450,
+	9268126,9270803,9273481,9276160,9278839,9281519,9284200,9286882,
+	9289565,9292248,9294932,9297617,9300303,9302989,9305676,9308364,
+	9311053,9313742,9316433,9319124,9321816,9324508,9327202,9329896,
+	9332591,9335287,9337983,9340680,9343379,9346077,9348777,9351477,
+	9354179,9356881,9359583,9362287,9364991,9367696,9370402,9373109,
+	9375816,9378525,9381234,9383943,9386654,9389365,9392078,9394790,
+	9397504,9400219,9402934,9405650,9408367,9411085,9413803,9416522,
+	9419242,9421963,9424684,9427407,9430130,9432854,9435579,9438304,
+	9441030,9443757,9446485,9449214,9451943,9454674,9457405,9460136,
+	9462869,9465602,9468337,9471072,9473807,9476544,9479281,9482019,
+	9484758,9487498,9490238,9492980,9495722,9498465,9501208,9503953,
+	9506698,9509444,9512191,9514938,9517687,9520436,9523186,9525937,
+	9528688,9531441,9534194,9536948,9539703,9542458,9545215,9547972,
+	9550730,9553489,9556248,9559009,9561770,9564532,9567294,9570058,
+	9572822,9575587,9578353,9581120,9583888,9586656,9589425,9592195,
+	9594966,9597737,9600510,9603283,9606057,9608831,9611607,9614383,
+	9617160,9619938,9622717,9625497,9628277,9631058,9633840,9636623,
+	9639406,9642191,9644976,9647762,9650549,9653336,9656125,9658914,
+	9661704,9664495,9667286,9670079,9672872,9675666,9678461,9681257,
+	9684053,9686850,9689648,9692447,9695247,9698047,9700849,9703651,
+	9706454,9709258,9712062,9714868,9717674,9720481,9723288,9726097,
+	9728906,9731717,9734528,9737340,9740152,9742966,9745780,9748595,
+	9751411,9754228,9757045,9759864,9762683,9765503,9768324,9771145,
+	9773968,9776791,9779615,9782440,9785265,9788092,9790919,9793747,
+	9796576,9799406,9802237,9805068,9807900,9810733,9813567,9816402,
+	9819237,9822074,9824911,9827749,9830588,9833427,9836268,9839109,
+	9841951,9844794,9847637,9850482,9853327,9856173,9859020,9861868,
+	9864717,9867566,9870417,9873268,9876120,9878972,9881826,9884680,
+	9887536,9890392,9893249,9896106,9898965,9901824,9904684,9907545,
+	9910407,9913270,9916133,9918998,9921863,9924729,9927595,9930463,
+	9933331,9936201,9939071,9941942,9944814,9947686,9950560,9953434,
+	9956309,9959185,9962061,9964939,9967817,9970697,9973577,9976458,
+	9979339,9982222,9985105,9987990,9990875,9993761,9996647,9999535,
+	10002423,10005312,10008203,10011093,10013985,10016878,10019771,10022665,
+	10025560,10028456,10031353,10034251,10037149,10040048,10042948,10045849,
+	10048751,10051654,10054557,10057462,10060367,10063273,10066179,10069087,
+	10071996,10074905,10077815,10080726,10083638,10086551,10089464,10092379,
+	10095294,10098210,10101127,10104044,10106963,10109882,10112803,10115724,
+	10118646,10121569,10124492,10127417,10130342,10133268,10136195,10139123,
+	10142052,10144981,10147912,10150843,10153775,10156708,10159642,10162577,
+	10165512,10168448,10171386,10174324,10177262,10180202,10183143,10186084,
+	10189027,10191970,10194914,10197858,10200804,10203751,10206698,10209646,
+	10212595,10215545,10218496,10221448,10224400,10227354,10230308,10233263,
+	10236219,10239176,10242133,10245092,10248051,10251011,10253972,10256934,
+	10259897,10262860,10265825,10268790,10271756,10274723,10277691,10280660,
+	10283630,10286600,10289571,10292544,10295517,10298490,10301465,10304441,
+	10307417,10310395,10313373,10316352,10319332,10322313,10325294,10328277,
+	10331260,10334244,10337229,10340215,10343202,10346190,10349178,10352168,
+	10355158,10358149,10361141,10364134,10367128,10370122,10373118,10376114,
+	10379111,10382109,10385108,10388108,10391108,10394110,10397112,10400116,
+	10403120,10406125,10409130,10412137,10415145,10418153,10421162,10424173,
+	10427184,10430196,10433208,10436222,10439237,10442252,10445268,10448285,
+	10451303,10454322,10457342,10460363,10463384,10466407,10469430,10472454,
+	10475479,10478505,10481532,10484559,10487588,10490617,10493647,10496679,
+	10499711,10502743,10505777,10508812,10511847,10514884,10517921,10520959,
+	10523998,10527038,10530079,10533120,10536163,10539206,10542251,10545296,
+	10548342,10551389,10554436,10557485,10560535,10563585,10566636,10569689,
+	10572742,10575796,10578851,10581906,10584963,10588020,10591079,10594138,
+	10597198,10600259,10603321,10606384,10609448,10612512,10615578,10618644,
+	10621711,10624779,10627848,10630918,10633989,10637061,10640133,10643207,
+	10646281,10649356,10652432,10655509,10658587,10661666,10664746,10667826,
+	10670908,10673990,10677073,10680157,10683242,10686328,10689415,10692503,
+	10695591,10698681,10701771,10704862,10707954,10711047,10714141,10717236,
+	10720332,10723428,10726526,10729624,10732724,10735824,10738925,10742027,
+	10745130,10748233,10751338,10754444,10757550,10760657,10763766,10766875,
+	10769985,10773096,10776208,10779320,10782434,10785549,10788664,10791780,
+	10794898,10798016,10801135,10804255,10807376,10810497,10813620,10816743,
+	10819868,10822993,10826119,10829247,10832375,10835504,10838634,10841764,
+	10844896,10848029,10851162,10854296,10857432,10860568,10863705,10866843,
+	10869982,10873122,10876263,10879404,10882547,10885690,10888835,10891980,
+	10895126,10898273,10901421,10904570,10907720,10910871,10914022,10917175,
+	10920328,10923483,10926638,10929794,10932951,10936109,10939268,10942428,
+	10945589,10948750,10951913,10955076,10958241,10961406,10964572,10967740,
+	10970908,10974077,10977246,10980417,10983589,10986762,10989935,10993110,
+	10996285,10999461,11002639,11005817,11008996,11012176,11015357,11018539,
+	11021721,11024905,11028090,11031275,11034461,11037649,11040837,11044026,
+	11047216,11050407,11053599,11056792,11059986,11063181,11066376,11069573,
+	11072770,11075969,11079168,11082368,11085569,11088772,11091975,11095179,
+	11098383,11101589,11104796,11108004,11111212,11114422,11117632,11120843,
+	11124056,11127269,11130483,11133698,11136914,11140131,11143349,11146568,
+	11149788,11153008,11156230,11159452,11162676,11165900,11169125,11172352,
+	11175579,11178807,11182036,11185266,11188497,11191729,11194961,11198195,
+	11201430,11204665,11207902,11211139,11214378,11217617,11220857,11224098,
+	11227340,11230583,11233827,11237072,11240318,11243565,11246813,11250061,
+	11253311,11256562,11259813,11263066,11266319,11269573,11272828,11276085,
+	11279342,11282600,11285859,11289119,11292380,11295642,11298904,11302168,
+	11305433,11308698,11311965,11315232,11318501,11321770,11325041,11328312,
+	11331584,11334857,11338131,11341406,11344682,11347959,11351237,11354516,
+	11357796,11361077,11364358,11367641,11370924,11374209,11377494,11380781,
+	11384068,11387357,11390646,11393936,11397227,11400519,11403812,11407106,
+	11410401,11413697,11416994,11420292,11423591,11426891,11430191,11433493,
+	11436796,11440099,11443404,11446709,11450015,11453323,11456631,11459940,
+	11463251,11466562,11469874,11473187,11476501,11479816,11483132,11486449,
+	11489767,11493086,11496406,11499726,11503048,11506371,11509695,11513019,
+	11516345,11519671,11522999,11526327,11529657,11532987,11536318,11539651,
+	11542984,11546318,11549653,11552989,11556327,11559665,11563004,11566344,
+	11569685,11573027,11576370,11579713,11583058,11586404,11589751,11593099,
+	11596447,11599797,11603148,11606499,11609852,11613205,11616560,11619915,
+	11623272,11626629,11629987,11633347,11636707,11640068,11643431,11646794,
+	11650158,11653523,11656890,11660257,11663625,11666994,11670364,11673735,
+	11677107,11680480,11683854,11687229,11690605,11693981,11697359,11700738,
+	11704118,11707499,11710880,11714263,11717647,11721032,11724417,11727804,
+	11731191,11734580,11737970,11741360,11744752,11748144,11751538,11754932,
+	11758328,11761724,11765121,11768520,11771919,11775320,11778721,11782123,
+	11785527,11788931,11792336,11795742,11799150,11802558,11805967,11809377,
+	11812788,11816200,11819614,11823028,11826443,11829859,11833276,11836694,
+	11840113,11843533,11846954,11850376,11853799,11857223,11860648,11864074,
+	11867501,11870929,11874358,11877788,11881219,11884651,11888084,11891518,
+	11894953,11898389,11901826,11905263,11908702,11912142,11915583,11919025,
+	11922468,11925912,11929356,11932802,11936249,11939697,11943146,11946596,
+	11950046,11953498,11956951,11960405,11963860,11967315,11970772,11974230,
+	11977689,11981149,11984609,11988071,11991534,11994998,11998462,12001928,
+	12005395,12008863,12012332,12015801,12019272,12022744,12026217,12029691,
+	12033165,12036641,12040118,12043596,12047075,12050555,12054035,12057517,
+	12061000,12064484,12067969,12071455,12074942,12078429,12081918,12085408,
+	12088899,12092391,12095884,12099378,12102873,12106369,12109866,12113364,
+	12116863,12120363,12123864,12127366,12130869,12134373,12137878,12141384,
+	12144891,12148399,12151908,12155418,12158929,12162442,12165955,12169469,
+	12172984,12176500,12180018,12183536,12187055,12190575,12194097,12197619,
+	12201142,12204667,12208192,12211718,12215246,12218774,12222303,12225834,
+	12229365,12232898,12236431,12239966,12243501,12247038,12250576,12254114,
+	12257654,12261195,12264736,12268279,12271823,12275367,12278913,12282460,
+	12286008,12289557,12293107,12296657,12300209,12303762,12307316,12310871,
+	12314427,12317984,12321543,12325102,12328662,12332223,12335785,12339348,
+	12342913,12346478,12350044,12353612,12357180,12360749,12364320,12367891,
+	12371464,12375037,12378612,12382187,12385764,12389342,12392920,12396500,
+	12400081,12403663,12407246,12410829,12414414,12418000,12421587,12425175,
+	12428764,12432354,12435946,12439538,12443131,12446725,12450320,12453917,
+	12457514,12461112,12464712,12468312,12471914,12475516,12479120,12482725,
+	12486330,12489937,12493545,12497154,12500763,12504374,12507986,12511599,
+	12515213,12518828,12522444,12526062,12529680,12533299,12536919,12540541,
+	12544163,12547786,12551411,12555036,12558663,12562291,12565919,12569549,
+	12573180,12576811,12580444,12584078,12587713,12591349,12594986,12598624,
+	12602263,12605904,12609545,12613187,12616831,12620475,12624120,12627767,
+	12631415,12635063,12638713,12642364,12646015,12649668,12653322,12656977,
+	12660633,12664290,12667948,12671607,12675268,12678929,12682591,12686255,
+	12689919,12693585,12697251,12700919,12704588,12708257,12711928,12715600,
+	12719273,12722947,12726622,12730298,12733975,12737654,12741333,12745013,
+	12748695,12752377,12756061,12759745,12763431,12767118,12770806,12774495,
+	12778184,12781875,12785568,12789261,12792955,12796650,12800347,12804044,
+	12807742,12811442,12815143,12818844,12822547,12826251,12829956,12833662,
+	12837369,12841077,12844786,12848496,12852208,12855920,12859634,12863348,
+	12867064,12870780,12874498,12878217,12881937,12885658,12889380,12893103,
+	12896827,12900553,12904279,12908006,12911735,12915465,12919195,12922927,
+	12926660,12930394,12934129,12937865,12941602,12945340,12949079,12952820,
+	12956561,12960304,12964047,12967792,12971538,12975285,12979033,12982782,
+	12986532,12990283,12994035,12997789,13001543,13005299,13009055,13012813,
+	13016572,13020332,13024093,13027855,13031618,13035382,13039147,13042914,
+	13046681,13050450,13054220,13057990,13061762,13065535,13069309,13073084,
+	13076860,13080638,13084416,13088196,13091976,13095758,13099540,13103324,
+	13107109,13110895,13114682,13118471,13122260,13126050,13129842,13133634,
+	13137428,13141223,13145019,13148816,13152614,13156413,13160213,13164015,
+	13167817,13171621,13175425,13179231,13183038,13186846,13190655,13194465,
+	13198276,13202089,13205902,13209717,13213532,13217349,13221167,13224986,
+	13228806,13232627,13236450,13240273,13244098,13247923,13251750,13255578,
+	13259407,13263237,13267068,13270900,13274733,13278568,13282403,13286240,
+	13290078,
+};
+
+/* half cent at the lowest mHz of each index */
+static const unsigned short freq_index[6144] = {
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,3,
+	6,13,20,26,33,40,47,53,
+	60,67,73,80,86,93,100,106,
+	113,119,126,132,139,145,152,158,
+	165,171,178,184,191,197,203,210,
+	216,223,229,235,242,248,254,260,
+	267,273,279,285,292,298,304,310,
+	317,323,329,335,341,347,353,360,
+	366,372,378,384,390,396,402,408,
+	414,420,426,432,438,444,450,456,
+	462,468,474,480,485,491,497,503,
+	509,515,521,526,532,538,544,550,
+	555,561,567,573,578,584,590,596,
+	601,607,613,618,624,630,635,641,
+	647,652,658,663,669,675,680,686,
+	691,697,702,708,713,719,724,730,
+	735,741,746,752,757,763,768,773,
+	779,784,790,795,800,806,811,817,
+	822,827,833,838,843,849,854,859,
+	864,870,875,880,885,891,896,901,
+	906,912,917,922,927,932,938,943,
+	948,953,958,963,968,973,979,984,
+	989,994,999,1004,1009,1014,1019,1024,
+	1029,1034,1039,1044,1049,1054,1059,1064,
+	1069,1074,1079,1084,1089,1094,1099,1104,
+	1109,1114,1119,1124,1129,1133,1138,1143,
+	1148,1153,1158,1163,1167,1172,1177,1182,
+	1187,1192,1196,1201,1206,1211,1215,1220,
+	1225,1230,1234,1239,1244,1249,1253,1258,
+	1263,1268,1272,1277,1282,1286,1291,1296,
+	1300,1305,1310,1314,1319,1323,1328,1333,
+	1337,1342,1346,1351,1356,1360,1365,1369,
+	1374,1378,1383,1388,1392,1397,1401,1406,
+	1410,1415,1419,1424,1428,1433,1437,1442,
+	1446,1451,1455,1459,1464,1468,1473,1477,
+	1482,1486,1490,1495,1499,1504,1508,1512,
+	1517,1521,1525,1530,1534,1539,1543,1547,
+	1552,1556,1560,1564,1569,1573,1577,1582,
+	1586,1590,1595,1599,1603,1607,1612,1616,
+	1620,1624,1629,1633,1637,1641,1645,1650,
+	1654,1658,1662,1666,1671,1675,1679,1683,
+	1687,1691,1696,1700,1704,1708,1712,1716,
+	1720,1725,1729,1733,1737,1741,1745,1749,
+	1753,1757,1761,1766,1770,1774,1778,1782,
+	1786,1790,1794,1798,1802,1806,1810,1814,
+	1818,1822,1826,1830,1834,1838,1842,1846,
+	1850,1854,1858,1862,1866,1870,1874,1878,
+	1882,1885,1889,1893,1897,1901,1905,1909,
+	1913,1917,1921,1925,1928,1932,1936,1940,
+	1944,1948,1952,1955,1959,1963,1967,1971,
+	1975,1979,1982,1986,1990,1994,1998,2001,
+	2005,2009,2013,2017,2020,2024,2028,2032,
+	2035,2039,2043,2047,2050,2054,2058,2062,
+	2065,2069,2073,2077,2080,2084,2088,2091,
+	2095,2099,2103,2106,2110,2114,2117,2121,
+	2125,2128,2132,2136,2139,2143,2147,2150,
+	2154,2157,2161,2165,2168,2172,2176,2179,
+	2183,2186,2190,2194,2197,2201,2204,2208,
+	2212,2215,2219,2222,2226,2229,2233,2236,
+	2240,2244,2247,2251,2254,2258,2261,2265,
+	2268,2272,2275,2279,2282,2286,2289,2293,
+	2296,2300,2303,2307,2310,2314,2317,2321,
+	2324,2328,2331,2335,2338,2341,2345,2348,
+	2352,2355,2359,2362,2365,2369,2372,2376,
+	2379,2383,2386,2389,2393,2396,2400,2403,
+	2406,2413,2420,2426,2433,2440,2447,2453,
+	2460,2467,2473,2480,2486,2493,2500,2506,
+	2513,2519,2526,2532,2539,2545,2552,2558,
+	2565,2571,2578,2584,2591,2597,2603,2610,
+	2616,2623,2629,2635,2642,2648,2654,2660,
+	2667,2673,2679,2685,2692,2698,2704,2710,
+	2717,2723,2729,2735,2741,2747,2753,2760,
+	2766,2772,2778,2784,2790,2796,2802,2808,
+	2814,2820,2826,2832,2838,2844,2850,2856,
+	2862,2868,2874,2880,2885,2891,2897,2903,
+	2909,2915,2921,2926,2932,2938,2944,2950,
+	2955,2961,2967,2973,2978,2984,2990,2996,
+	3001,3007,3013,3018,3024,3030,3035,3041,
+	3047,3052,3058,3063,3069,3075,3080,3086,
+	3091,3097,3102,3108,3113,3119,3124,3130,
+	3135,3141,3146,3152,3157,3163,3168,3173,
+	3179,3184,3190,3195,3200,3206,3211,3217,
+	3222,3227,3233,3238,3243,3249,3254,3259,
+	3264,3270,3275,3280,3285,3291,3296,3301,
+	3306,3312,3317,3322,3327,3332,3338,3343,
+	3348,3353,3358,3363,3368,3373,3379,3384,
+	3389,3394,3399,3404,3409,3414,3419,3424,
+	3429,3434,3439,3444,3449,3454,3459,3464,
+	3469,3474,3479,3484,3489,3494,3499,3504,
+	3509,3514,3519,3524,3529,3533,3538,3543,
+	3548,3553,3558,3563,3567,3572,3577,3582,
+	3587,3592,3596,3601,3606,3611,3615,3620,
+	3625,3630,3634,3639,3644,3649,3653,3658,
+	3663,3668,3672,3677,3682,3686,3691,3696,
+	3700,3705,3710,3714,3719,3723,3728,3733,
+	3737,3742,3746,3751,3756,3760,3765,3769,
+	3774,3778,3783,3788,3792,3797,3801,3806,
+	3810,3815,3819,3824,3828,3833,3837,3842,
+	3846,3851,3855,3859,3864,3868,3873,3877,
+	3882,3886,3890,3895,3899,3904,3908,3912,
+	3917,3921,3925,3930,3934,3939,3943,3947,
+	3952,3956,3960,3964,3969,3973,3977,3982,
+	3986,3990,3995,3999,4003,4007,4012,4016,
+	4020,4024,4029,4033,4037,4041,4045,4050,
+	4054,4058,4062,4066,4071,4075,4079,4083,
+	4087,4091,4096,4100,4104,4108,4112,4116,
+	4120,4125,4129,4133,4137,4141,4145,4149,
+	4153,4157,4161,4166,4170,4174,4178,4182,
+	4186,4190,4194,4198,4202,4206,4210,4214,
+	4218,4222,4226,4230,4234,4238,4242,4246,
+	4250,4254,4258,4262,4266,4270,4274,4278,
+	4282,4285,4289,4293,4297,4301,4305,4309,
+	4313,4317,4321,4325,4328,4332,4336,4340,
+	4344,4348,4352,4355,4359,4363,4367,4371,
+	4375,4379,4382,4386,4390,4394,4398,4401,
+	4405,4409,4413,4417,4420,4424,4428,4432,
+	4435,4439,4443,4447,4450,4454,4458,4462,
+	4465,4469,4473,4477,4480,4484,4488,4491,
+	4495,4499,4503,4506,4510,4514,4517,4521,
+	4525,4528,4532,4536,4539,4543,4547,4550,
+	4554,4557,4561,4565,4568,4572,4576,4579,
+	4583,4586,4590,4594,4597,4601,4604,4608,
+	4612,4615,4619,4622,4626,4629,4633,4636,
+	4640,4644,4647,4651,4654,4658,4661,4665,
+	4668,4672,4675,4679,4682,4686,4689,4693,
+	4696,4700,4703,4707,4710,4714,4717,4721,
+	4724,4728,4731,4735,4738,4741,4745,4748,
+	4752,4755,4759,4762,4765,4769,4772,4776,
+	4779,4783,4786,4789,4793,4796,4800,4803,
+	4806,4813,4820,4826,4833,4840,4847,4853,
+	4860,4867,4873,4880,4886,4893,4900,4906,
+	4913,4919,4926,4932,4939,4945,4952,4958,
+	4965,4971,4978,4984,4991,4997,5003,5010,
+	5016,5023,5029,5035,5042,5048,5054,5060,
+	5067,5073,5079,5085,5092,5098,5104,5110,
+	5117,5123,5129,5135,5141,5147,5153,5160,
+	5166,5172,5178,5184,5190,5196,5202,5208,
+	5214,5220,5226,5232,5238,5244,5250,5256,
+	5262,5268,5274,5280,5285,5291,5297,5303,
+	5309,5315,5321,5326,5332,5338,5344,5350,
+	5355,5361,5367,5373,5378,5384,5390,5396,
+	5401,5407,5413,5418,5424,5430,5435,5441,
+	5447,5452,5458,5463,5469,5475,5480,5486,
+	5491,5497,5502,5508,5513,5519,5524,5530,
+	5535,5541,5546,5552,5557,5563,5568,5573,
+	5579,5584,5590,5595,5600,5606,5611,5617,
+	5622,5627,5633,5638,5643,5649,5654,5659,
+	5664,5670,5675,5680,5685,5691,5696,5701,
+	5706,5712,5717,5722,5727,5732,5738,5743,
+	5748,5753,5758,5763,5768,5773,5779,5784,
+	5789,5794,5799,5804,5809,5814,5819,5824,
+	5829,5834,5839,5844,5849,5854,5859,5864,
+	5869,5874,5879,5884,5889,5894,5899,5904,
+	5909,5914,5919,5924,5929,5933,5938,5943,
+	5948,5953,5958,5963,5967,5972,5977,5982,
+	5987,5992,5996,6001,6006,6011,6015,6020,
+	6025,6030,6034,6039,6044,6049,6053,6058,
+	6063,6068,6072,6077,6082,6086,6091,6096,
+	6100,6105,6110,6114,6119,6123,6128,6133,
+	6137,6142,6146,6151,6156,6160,6165,6169,
+	6174,6178,6183,6188,6192,6197,6201,6206,
+	6210,6215,6219,6224,6228,6233,6237,6242,
+	6246,6251,6255,6259,6264,6268,6273,6277,
+	6282,6286,6290,6295,6299,6304,6308,6312,
+	6317,6321,6325,6330,6334,6339,6343,6347,
+	6352,6356,6360,6364,6369,6373,6377,6382,
+	6386,6390,6395,6399,6403,6407,6412,6416,
+	6420,6424,6429,6433,6437,6441,6445,6450,
+	6454,6458,6462,6466,6471,6475,6479,6483,
+	6487,6491,6496,6500,6504,6508,6512,6516,
+	6520,6525,6529,6533,6537,6541,6545,6549,
+	6553,6557,6561,6566,6570,6574,6578,6582,
+	6586,6590,6594,6598,6602,6606,6610,6614,
+	6618,6622,6626,6630,6634,6638,6642,6646,
+	6650,6654,6658,6662,6666,6670,6674,6678,
+	6682,6685,6689,6693,6697,6701,6705,6709,
+	6713,6717,6721,6725,6728,6732,6736,6740,
+	6744,6748,6752,6755,6759,6763,6767,6771,
+	6775,6779,6782,6786,6790,6794,6798,6801,
+	6805,6809,6813,6817,6820,6824,6828,6832,
+	6835,6839,6843,6847,6850,6854,6858,6862,
+	6865,6869,6873,6877,6880,6884,6888,6891,
+	6895,6899,6903,6906,6910,6914,6917,6921,
+	6925,6928,6932,6936,6939,6943,6947,6950,
+	6954,6957,6961,6965,6968,6972,6976,6979,
+	6983,6986,6990,6994,6997,7001,7004,7008,
+	7012,7015,7019,7022,7026,7029,7033,7036,
+	7040,7044,7047,7051,7054,7058,7061,7065,
+	7068,7072,7075,7079,7082,7086,7089,7093,
+	7096,7100,7103,7107,7110,7114,7117,7121,
+	7124,7128,7131,7135,7138,7141,7145,7148,
+	7152,7155,7159,7162,7165,7169,7172,7176,
+	7179,7183,7186,7189,7193,7196,7200,7203,
+	7206,7213,7220,7226,7233,7240,7247,7253,
+	7260,7267,7273,7280,7286,7293,7300,7306,
+	7313,7319,7326,7332,7339,7345,7352,7358,
+	7365,7371,7378,7384,7391,7397,7403,7410,
+	7416,7423,7429,7435,7442,7448,7454,7460,
+	7467,7473,7479,7485,7492,7498,7504,7510,
+	7517,7523,7529,7535,7541,7547,7553,7560,
+	7566,7572,7578,7584,7590,7596,7602,7608,
+	7614,7620,7626,7632,7638,7644,7650,7656,
+	7662,7668,7674,7680,7685,7691,7697,7703,
+	7709,7715,7721,7726,7732,7738,7744,7750,
+	7755,7761,7767,7773,7778,7784,7790,7796,
+	7801,7807,7813,7818,7824,7830,7835,7841,
+	7847,7852,7858,7863,7869,7875,7880,7886,
+	7891,7897,7902,7908,7913,7919,7924,7930,
+	7935,7941,7946,7952,7957,7963,7968,7973,
+	7979,7984,7990,7995,8000,8006,8011,8017,
+	8022,8027,8033,8038,8043,8049,8054,8059,
+	8064,8070,8075,8080,8085,8091,8096,8101,
+	8106,8112,8117,8122,8127,8132,8138,8143,
+	8148,8153,8158,8163,8168,8173,8179,8184,
+	8189,8194,8199,8204,8209,8214,8219,8224,
+	8229,8234,8239,8244,8249,8254,8259,8264,
+	8269,8274,8279,8284,8289,8294,8299,8304,
+	8309,8314,8319,8324,8329,8333,8338,8343,
+	8348,8353,8358,8363,8367,8372,8377,8382,
+	8387,8392,8396,8401,8406,8411,8415,8420,
+	8425,8430,8434,8439,8444,8449,8453,8458,
+	8463,8468,8472,8477,8482,8486,8491,8496,
+	8500,8505,8510,8514,8519,8523,8528,8533,
+	8537,8542,8546,8551,8556,8560,8565,8569,
+	8574,8578,8583,8588,8592,8597,8601,8606,
+	8610,8615,8619,8624,8628,8633,8637,8642,
+	8646,8651,8655,8659,8664,8668,8673,8677,
+	8682,8686,8690,8695,8699,8704,8708,8712,
+	8717,8721,8725,8730,8734,8739,8743,8747,
+	8752,8756,8760,8764,8769,8773,8777,8782,
+	8786,8790,8795,8799,8803,8807,8812,8816,
+	8820,8824,8829,8833,8837,8841,8845,8850,
+	8854,8858,8862,8866,8871,8875,8879,8883,
+	8887,8891,8896,8900,8904,8908,8912,8916,
+	8920,8925,8929,8933,8937,8941,8945,8949,
+	8953,8957,8961,8966,8970,8974,8978,8982,
+	8986,8990,8994,8998,9002,9006,9010,9014,
+	9018,9022,9026,9030,9034,9038,9042,9046,
+	9050,9054,9058,9062,9066,9070,9074,9078,
+	9082,9085,9089,9093,9097,9101,9105,9109,
+	9113,9117,9121,9125,9128,9132,9136,9140,
+	9144,9148,9152,9155,9159,9163,9167,9171,
+	9175,9179,9182,9186,9190,9194,9198,9201,
+	9205,9209,9213,9217,9220,9224,9228,9232,
+	9235,9239,9243,9247,9250,9254,9258,9262,
+	9265,9269,9273,9277,9280,9284,9288,9291,
+	9295,9299,9303,9306,9310,9314,9317,9321,
+	9325,9328,9332,9336,9339,9343,9347,9350,
+	9354,9357,9361,9365,9368,9372,9376,9379,
+	9383,9386,9390,9394,9397,9401,9404,9408,
+	9412,9415,9419,9422,9426,9429,9433,9436,
+	9440,9444,9447,9451,9454,9458,9461,9465,
+	9468,9472,9475,9479,9482,9486,9489,9493,
+	9496,9500,9503,9507,9510,9514,9517,9521,
+	9524,9528,9531,9535,9538,9541,9545,9548,
+	9552,9555,9559,9562,9565,9569,9572,9576,
+	9579,9583,9586,9589,9593,9596,9600,9603,
+	9606,9613,9620,9626,9633,9640,9647,9653,
+	9660,9667,9673,9680,9686,9693,9700,9706,
+	9713,9719,9726,9732,9739,9745,9752,9758,
+	9765,9771,9778,9784,9791,9797,9803,9810,
+	9816,9823,9829,9835,9842,9848,9854,9860,
+	9867,9873,9879,9885,9892,9898,9904,9910,
+	9917,9923,9929,9935,9941,9947,9953,9960,
+	9966,9972,9978,9984,9990,9996,10002,10008,
+	10014,10020,10026,10032,10038,10044,10050,10056,
+	10062,10068,10074,10080,10085,10091,10097,10103,
+	10109,10115,10121,10126,10132,10138,10144,10150,
+	10155,10161,10167,10173,10178,10184,10190,10196,
+	10201,10207,10213,10218,10224,10230,10235,10241,
+	10247,10252,10258,10263,10269,10275,10280,10286,
+	10291,10297,10302,10308,10313,10319,10324,10330,
+	10335,10341,10346,10352,10357,10363,10368,10373,
+	10379,10384,10390,10395,10400,10406,10411,10417,
+	10422,10427,10433,10438,10443,10449,10454,10459,
+	10464,10470,10475,10480,10485,10491,10496,10501,
+	10506,10512,10517,10522,10527,10532,10538,10543,
+	10548,10553,10558,10563,10568,10573,10579,10584,
+	10589,10594,10599,10604,10609,10614,10619,10624,
+	10629,10634,10639,10644,10649,10654,10659,10664,
+	10669,10674,10679,10684,10689,10694,10699,10704,
+	10709,10714,10719,10724,10729,10733,10738,10743,
+	10748,10753,10758,10763,10767,10772,10777,10782,
+	10787,10792,10796,10801,10806,10811,10815,10820,
+	10825,10830,10834,10839,10844,10849,10853,10858,
+	10863,10868,10872,10877,10882,10886,10891,10896,
+	10900,10905,10910,10914,10919,10923,10928,10933,
+	10937,10942,10946,10951,10956,10960,10965,10969,
+	10974,10978,10983,10988,10992,10997,11001,11006,
+	11010,11015,11019,11024,11028,11033,11037,11042,
+	11046,11051,11055,11059,11064,11068,11073,11077,
+	11082,11086,11090,11095,11099,11104,11108,11112,
+	11117,11121,11125,11130,11134,11139,11143,11147,
+	11152,11156,11160,11164,11169,11173,11177,11182,
+	11186,11190,11195,11199,11203,11207,11212,11216,
+	11220,11224,11229,11233,11237,11241,11245,11250,
+	11254,11258,11262,11266,11271,11275,11279,11283,
+	11287,11291,11296,11300,11304,11308,11312,11316,
+	11320,11325,11329,11333,11337,11341,11345,11349,
+	11353,11357,11361,11366,11370,11374,11378,11382,
+	11386,11390,11394,11398,11402,11406,11410,11414,
+	11418,11422,11426,11430,11434,11438,11442,11446,
+	11450,11454,11458,11462,11466,11470,11474,11478,
+	11482,11485,11489,11493,11497,11501,11505,11509,
+	11513,11517,11521,11525,11528,11532,11536,11540,
+	11544,11548,11552,11555,11559,11563,11567,11571,
+	11575,11579,11582,11586,11590,11594,11598,11601,
+	11605,11609,11613,11617,11620,11624,11628,11632,
+	11635,11639,11643,11647,11650,11654,11658,11662,
+	11665,11669,11673,11677,11680,11684,11688,11691,
+	11695,11699,11703,11706,11710,11714,11717,11721,
+	11725,11728,11732,11736,11739,11743,11747,11750,
+	11754,11757,11761,11765,11768,11772,11776,11779,
+	11783,11786,11790,11794,11797,11801,11804,11808,
+	11812,11815,11819,11822,11826,11829,11833,11836,
+	11840,11844,11847,11851,11854,11858,11861,11865,
+	11868,11872,11875,11879,11882,11886,11889,11893,
+	11896,11900,11903,11907,11910,11914,11917,11921,
+	11924,11928,11931,11935,11938,11941,11945,11948,
+	11952,11955,11959,11962,11965,11969,11972,11976,
+	11979,11983,11986,11989,11993,11996,12000,12003,
+	12006,12013,12020,12026,12033,12040,12047,12053,
+	12060,12067,12073,12080,12086,12093,12100,12106,
+	12113,12119,12126,12132,12139,12145,12152,12158,
+	12165,12171,12178,12184,12191,12197,12203,12210,
+	12216,12223,12229,12235,12242,12248,12254,12260,
+	12267,12273,12279,12285,12292,12298,12304,12310,
+	12317,12323,12329,12335,12341,12347,12353,12360,
+	12366,12372,12378,12384,12390,12396,12402,12408,
+	12414,12420,12426,12432,12438,12444,12450,12456,
+	12462,12468,12474,12480,12485,12491,12497,12503,
+	12509,12515,12521,12526,12532,12538,12544,12550,
+	12555,12561,12567,12573,12578,12584,12590,12596,
+	12601,12607,12613,12618,12624,12630,12635,12641,
+	12647,12652,12658,12663,12669,12675,12680,12686,
+	12691,12697,12702,12708,12713,12719,12724,12730,
+	12735,12741,12746,12752,12757,12763,12768,12773,
+	12779,12784,12790,12795,12800,12806,12811,12817,
+	12822,12827,12833,12838,12843,12849,12854,12859,
+	12864,12870,12875,12880,12885,12891,12896,12901,
+	12906,12912,12917,12922,12927,12932,12938,12943,
+	12948,12953,12958,12963,12968,12973,12979,12984,
+	12989,12994,12999,13004,13009,13014,13019,13024,
+	13029,13034,13039,13044,13049,13054,13059,13064,
+	13069,13074,13079,13084,13089,13094,13099,13104,
+	13109,13114,13119,13124,13129,13133,13138,13143,
+	13148,13153,13158,13163,13167,13172,13177,13182,
+	13187,13192,13196,13201,13206,13211,13215,13220,
+	13225,13230,13234,13239,13244,13249,13253,13258,
+	13263,13268,13272,13277,13282,13286,13291,13296,
+	13300,13305,13310,13314,13319,13323,13328,13333,
+	13337,13342,13346,13351,13356,13360,13365,13369,
+	13374,13378,13383,13388,13392,13397,13401,13406,
+	13410,13415,13419,13424,13428,13433,13437,13442,
+	13446,13451,13455,13459,13464,13468,13473,13477,
+	13482,13486,13490,13495,13499,13504,13508,13512,
+	13517,13521,13525,13530,13534,13539,13543,13547,
+	13552,13556,13560,13564,13569,13573,13577,13582,
+	13586,13590,13595,13599,13603,13607,13612,13616,
+	13620,13624,13629,13633,13637,13641,13645,13650,
+	13654,13658,13662,13666,13671,13675,13679,13683,
+	13687,13691,13696,13700,13704,13708,13712,13716,
+	13720,13725,13729,13733,13737,13741,13745,13749,
+	13753,13757,13761,13766,13770,13774,13778,13782,
+	13786,13790,13794,13798,13802,13806,13810,13814,
+	13818,13822,13826,13830,13834,13838,13842,13846,
+	13850,13854,13858,13862,13866,13870,13874,13878,
+	13882,13885,13889,13893,13897,13901,13905,13909,
+	13913,13917,13921,13925,13928,13932,13936,13940,
+	13944,13948,13952,13955,13959,13963,13967,13971,
+	13975,13979,13982,13986,13990,13994,13998,14001,
+	14005,14009,14013,14017,14020,14024,14028,14032,
+	14035,14039,14043,14047,14050,14054,14058,14062,
+	14065,14069,14073,14077,14080,14084,14088,14091,
+	14095,14099,14103,14106,14110,14114,14117,14121,
+	14125,14128,14132,14136,14139,14143,14147,14150,
+	14154,14157,14161,14165,14168,14172,14176,14179,
+	14183,14186,14190,14194,14197,14201,14204,14208,
+	14212,14215,14219,14222,14226,14229,14233,14236,
+	14240,14244,14247,14251,14254,14258,14261,14265,
+	14268,14272,14275,14279,14282,14286,14289,14293,
+	14296,14300,14303,14307,14310,14314,14317,14321,
+	14324,14328,14331,14335,14338,14341,14345,14348,
+	14352,14355,14359,14362,14365,14369,14372,14376,
+	14379,14383,14386,14389,14393,14396,14400,14403,
+	14406,14413,14420,14426,14433,14440,14447,14453,
+	14460,14467,14473,14480,14486,14493,14500,14506,
+	14513,14519,14526,14532,14539,14545,14552,14558,
+	14565,14571,14578,14584,14591,14597,14603,14610,
+	14616,14623,14629,14635,14642,14648,14654,14660,
+	14667,14673,14679,14685,14692,14698,14704,14710,
+	14717,14723,14729,14735,14741,14747,14753,14760,
+	14766,14772,14778,14784,14790,14796,14802,14808,
+	14814,14820,14826,14832,14838,14844,14850,14856,
+	14862,14868,14874,14880,14885,14891,14897,14903,
+	14909,14915,14921,14926,14932,14938,14944,14950,
+	14955,14961,14967,14973,14978,14984,14990,14996,
+	15001,15007,15013,15018,15024,15030,15035,15041,
+	15047,15052,15058,15063,15069,15075,15080,15086,
+	15091,15097,15102,15108,15113,15119,15124,15130,
+	15135,15141,15146,15152,15157,15163,15168,15173,
+	15179,15184,15190,15195,15200,15206,15211,15217,
+	15222,15227,15233,15238,15243,15249,15254,15259,
+	15264,15270,15275,15280,15285,15291,15296,15301,
+	15306,15312,15317,15322,15327,15332,15338,15343,
+	15348,15353,15358,15363,15368,15373,15379,15384,
+	15389,15394,15399,15404,15409,15414,15419,15424,
+	15429,15434,15439,15444,15449,15454,15459,15464,
+	15469,15474,15479,15484,15489,15494,15499,15504,
+	15509,15514,15519,15524,15529,15533,15538,15543,
+	15548,15553,15558,15563,15567,15572,15577,15582,
+	15587,15592,15596,15601,15606,15611,15615,15620,
+	15625,15630,15634,15639,15644,15649,15653,15658,
+	15663,15668,15672,15677,15682,15686,15691,15696,
+	15700,15705,15710,15714,15719,15723,15728,15733,
+	15737,15742,15746,15751,15756,15760,15765,15769,
+	15774,15778,15783,15788,15792,15797,15801,15806,
+	15810,15815,15819,15824,15828,15833,15837,15842,
+	15846,15851,15855,15859,15864,15868,15873,15877,
+	15882,15886,15890,15895,15899,15904,15908,15912,
+	15917,15921,15925,15930,15934,15939,15943,15947,
+	15952,15956,15960,15964,15969,15973,15977,15982,
+	15986,15990,15995,15999,16003,16007,16012,16016,
+	16020,16024,16029,16033,16037,16041,16045,16050,
+	16054,16058,16062,16066,16071,16075,16079,16083,
+	16087,16091,16096,16100,16104,16108,16112,16116,
+	16120,16125,16129,16133,16137,16141,16145,16149,
+	16153,16157,16161,16166,16170,16174,16178,16182,
+	16186,16190,16194,16198,16202,16206,16210,16214,
+	16218,16222,16226,16230,16234,16238,16242,16246,
+	16250,16254,16258,16262,16266,16270,16274,16278,
+	16282,16285,16289,16293,16297,16301,16305,16309,
+	16313,16317,16321,16325,16328,16332,16336,16340,
+	16344,16348,16352,16355,16359,16363,16367,16371,
+	16375,16379,16382,16386,16390,16394,16398,16401,
+	16405,16409,16413,16417,16420,16424,16428,16432,
+	16435,16439,16443,16447,16450,16454,16458,16462,
+	16465,16469,16473,16477,16480,16484,16488,16491,
+	16495,16499,16503,16506,16510,16514,16517,16521,
+	16525,16528,16532,16536,16539,16543,16547,16550,
+	16554,16557,16561,16565,16568,16572,16576,16579,
+	16583,16586,16590,16594,16597,16601,16604,16608,
+	16612,16615,16619,16622,16626,16629,16633,16636,
+	16640,16644,16647,16651,16654,16658,16661,16665,
+	16668,16672,16675,16679,16682,16686,16689,16693,
+	16696,16700,16703,16707,16710,16714,16717,16721,
+	16724,16728,16731,16735,16738,16741,16745,16748,
+	16752,16755,16759,16762,16765,16769,16772,16776,
+	16779,16783,16786,16789,16793,16796,16800,16803,
+	16806,16813,16820,16826,16833,16840,16847,16853,
+	16860,16867,16873,16880,16886,16893,16900,16906,
+	16913,16919,16926,16932,16939,16945,16952,16958,
+	16965,16971,16978,16984,16991,16997,17003,17010,
+	17016,17023,17029,17035,17042,17048,17054,17060,
+	17067,17073,17079,17085,17092,17098,17104,17110,
+	17117,17123,17129,17135,17141,17147,17153,17160,
+	17166,17172,17178,17184,17190,17196,17202,17208,
+	17214,17220,17226,17232,17238,17244,17250,17256,
+	17262,17268,17274,17280,17285,17291,17297,17303,
+	17309,17315,17321,17326,17332,17338,17344,17350,
+	17355,17361,17367,17373,17378,17384,17390,17396,
+	17401,17407,17413,17418,17424,17430,17435,17441,
+	17447,17452,17458,17463,17469,17475,17480,17486,
+	17491,17497,17502,17508,17513,17519,17524,17530,
+	17535,17541,17546,17552,17557,17563,17568,17573,
+	17579,17584,17590,17595,17600,17606,17611,17617,
+	17622,17627,17633,17638,17643,17649,17654,17659,
+	17664,17670,17675,17680,17685,17691,17696,17701,
+	17706,17712,17717,17722,17727,17732,17738,17743,
+	17748,17753,17758,17763,17768,17773,17779,17784,
+	17789,17794,17799,17804,17809,17814,17819,17824,
+	17829,17834,17839,17844,17849,17854,17859,17864,
+	17869,17874,17879,17884,17889,17894,17899,17904,
+	17909,17914,17919,17924,17929,17933,17938,17943,
+	17948,17953,17958,17963,17967,17972,17977,17982,
+	17987,17992,17996,18001,18006,18011,18015,18020,
+	18025,18030,18034,18039,18044,18049,18053,18058,
+	18063,18068,18072,18077,18082,18086,18091,18096,
+	18100,18105,18110,18114,18119,18123,18128,18133,
+	18137,18142,18146,18151,18156,18160,18165,18169,
+	18174,18178,18183,18188,18192,18197,18201,18206,
+	18210,18215,18219,18224,18228,18233,18237,18242,
+	18246,18251,18255,18259,18264,18268,18273,18277,
+	18282,18286,18290,18295,18299,18304,18308,18312,
+	18317,18321,18325,18330,18334,18339,18343,18347,
+	18352,18356,18360,18364,18369,18373,18377,18382,
+	18386,18390,18395,18399,18403,18407,18412,18416,
+	18420,18424,18429,18433,18437,18441,18445,18450,
+	18454,18458,18462,18466,18471,18475,18479,18483,
+	18487,18491,18496,18500,18504,18508,18512,18516,
+	18520,18525,18529,18533,18537,18541,18545,18549,
+	18553,18557,18561,18566,18570,18574,18578,18582,
+	18586,18590,18594,18598,18602,18606,18610,18614,
+	18618,18622,18626,18630,18634,18638,18642,18646,
+	18650,18654,18658,18662,18666,18670,18674,18678,
+	18682,18685,18689,18693,18697,18701,18705,18709,
+	18713,18717,18721,18725,18728,18732,18736,18740,
+	18744,18748,18752,18755,18759,18763,18767,18771,
+	18775,18779,18782,18786,18790,18794,18798,18801,
+	18805,18809,18813,18817,18820,18824,18828,18832,
+	18835,18839,18843,18847,18850,18854,18858,18862,
+	18865,18869,18873,18877,18880,18884,18888,18891,
+	18895,18899,18903,18906,18910,18914,18917,18921,
+	18925,18928,18932,18936,18939,18943,18947,18950,
+	18954,18957,18961,18965,18968,18972,18976,18979,
+	18983,18986,18990,18994,18997,19001,19004,19008,
+	19012,19015,19019,19022,19026,19029,19033,19036,
+	19040,19044,19047,19051,19054,19058,19061,19065,
+	19068,19072,19075,19079,19082,19086,19089,19093,
+	19096,19100,19103,19107,19110,19114,19117,19121,
+	19124,19128,19131,19135,19138,19141,19145,19148,
+	19152,19155,19159,19162,19165,19169,19172,19176,
+	19179,19183,19186,19189,19193,19196,19200,19203,
+	19206,19213,19220,19226,19233,19240,19247,19253,
+	19260,19267,19273,19280,19286,19293,19300,19306,
+	19313,19319,19326,19332,19339,19345,19352,19358,
+	19365,19371,19378,19384,19391,19397,19403,19410,
+	19416,19423,19429,19435,19442,19448,19454,19460,
+	19467,19473,19479,19485,19492,19498,19504,19510,
+	19517,19523,19529,19535,19541,19547,19553,19560,
+	19566,19572,19578,19584,19590,19596,19602,19608,
+	19614,19620,19626,19632,19638,19644,19650,19656,
+	19662,19668,19674,19680,19685,19691,19697,19703,
+	19709,19715,19721,19726,19732,19738,19744,19750,
+	19755,19761,19767,19773,19778,19784,19790,19796,
+	19801,19807,19813,19818,19824,19830,19835,19841,
+	19847,19852,19858,19863,19869,19875,19880,19886,
+	19891,19897,19902,19908,19913,19919,19924,19930,
+	19935,19941,19946,19952,19957,19963,19968,19973,
+	19979,19984,19990,19995,20000,20006,20011,20017,
+	20022,20027,20033,20038,20043,20049,20054,20059,
+	20064,20070,20075,20080,20085,20091,20096,20101,
+	20106,20112,20117,20122,20127,20132,20138,20143,
+	20148,20153,20158,20163,20168,20173,20179,20184,
+	20189,20194,20199,20204,20209,20214,20219,20224,
+	20229,20234,20239,20244,20249,20254,20259,20264,
+	20269,20274,20279,20284,20289,20294,20299,20304,
+	20309,20314,20319,20324,20329,20333,20338,20343,
+	20348,20353,20358,20363,20367,20372,20377,20382,
+	20387,20392,20396,20401,20406,20411,20415,20420,
+	20425,20430,20434,20439,20444,20449,20453,20458,
+	20463,20468,20472,20477,20482,20486,20491,20496,
+	20500,20505,20510,20514,20519,20523,20528,20533,
+	20537,20542,20546,20551,20556,20560,20565,20569,
+	20574,20578,20583,20588,20592,20597,20601,20606,
+	20610,20615,20619,20624,20628,20633,20637,20642,
+	20646,20651,20655,20659,20664,20668,20673,20677,
+	20682,20686,20690,20695,20699,20704,20708,20712,
+	20717,20721,20725,20730,20734,20739,20743,20747,
+	20752,20756,20760,20764,20769,20773,20777,20782,
+	20786,20790,20795,20799,20803,20807,20812,20816,
+	20820,20824,20829,20833,20837,20841,20845,20850,
+	20854,20858,20862,20866,20871,20875,20879,20883,
+	20887,20891,20896,20900,20904,20908,20912,20916,
+	20920,20925,20929,20933,20937,20941,20945,20949,
+	20953,20957,20961,20966,20970,20974,20978,20982,
+	20986,20990,20994,20998,21002,21006,21010,21014,
+	21018,21022,21026,21030,21034,21038,21042,21046,
+	21050,21054,21058,21062,21066,21070,21074,21078,
+	21082,21085,21089,21093,21097,21101,21105,21109,
+	21113,21117,21121,21125,21128,21132,21136,21140,
+	21144,21148,21152,21155,21159,21163,21167,21171,
+	21175,21179,21182,21186,21190,21194,21198,21201,
+	21205,21209,21213,21217,21220,21224,21228,21232,
+	21235,21239,21243,21247,21250,21254,21258,21262,
+	21265,21269,21273,21277,21280,21284,21288,21291,
+	21295,21299,21303,21306,21310,21314,21317,21321,
+	21325,21328,21332,21336,21339,21343,21347,21350,
+	21354,21357,21361,21365,21368,21372,21376,21379,
+	21383,21386,21390,21394,21397,21401,21404,21408,
+	21412,21415,21419,21422,21426,21429,21433,21436,
+	21440,21444,21447,21451,21454,21458,21461,21465,
+	21468,21472,21475,21479,21482,21486,21489,21493,
+	21496,21500,21503,21507,21510,21514,21517,21521,
+	21524,21528,21531,21535,21538,21541,21545,21548,
+	21552,21555,21559,21562,21565,21569,21572,21576,
+	21579,21583,21586,21589,21593,21596,21600,21603,
+	21606,21613,21620,21626,21633,21640,21647,21653,
+	21660,21667,21673,21680,21686,21693,21700,21706,
+	21713,21719,21726,21732,21739,21745,21752,21758,
+	21765,21771,21778,21784,21791,21797,21803,21810,
+	21816,21823,21829,21835,21842,21848,21854,21860,
+	21867,21873,21879,21885,21892,21898,21904,21910,
+	21917,21923,21929,21935,21941,21947,21953,21960,
+	21966,21972,21978,21984,21990,21996,22002,22008,
+	22014,22020,22026,22032,22038,22044,22050,22056,
+	22062,22068,22074,22080,22085,22091,22097,22103,
+	22109,22115,22121,22126,22132,22138,22144,22150,
+	22155,22161,22167,22173,22178,22184,22190,22196,
+	22201,22207,22213,22218,22224,22230,22235,22241,
+	22247,22252,22258,22263,22269,22275,22280,22286,
+	22291,22297,22302,22308,22313,22319,22324,22330,
+	22335,22341,22346,22352,22357,22363,22368,22373,
+	22379,22384,22390,22395,22400,22406,22411,22417,
+	22422,22427,22433,22438,22443,22449,22454,22459,
+	22464,22470,22475,22480,22485,22491,22496,22501,
+	22506,22512,22517,22522,22527,22532,22538,22543,
+	22548,22553,22558,22563,22568,22573,22579,22584,
+	22589,22594,22599,22604,22609,22614,22619,22624,
+	22629,22634,22639,22644,22649,22654,22659,22664,
+	22669,22674,22679,22684,22689,22694,22699,22704,
+	22709,22714,22719,22724,22729,22733,22738,22743,
+	22748,22753,22758,22763,22767,22772,22777,22782,
+	22787,22792,22796,22801,22806,22811,22815,22820,
+	22825,22830,22834,22839,22844,22849,22853,22858,
+	22863,22868,22872,22877,22882,22886,22891,22896,
+	22900,22905,22910,22914,22919,22923,22928,22933,
+	22937,22942,22946,22951,22956,22960,22965,22969,
+	22974,22978,22983,22988,22992,22997,23001,23006,
+	23010,23015,23019,23024,23028,23033,23037,23042,
+	23046,23051,23055,23059,23064,23068,23073,23077,
+	23082,23086,23090,23095,23099,23104,23108,23112,
+	23117,23121,23125,23130,23134,23139,23143,23147,
+	23152,23156,23160,23164,23169,23173,23177,23182,
+	23186,23190,23195,23199,23203,23207,23212,23216,
+	23220,23224,23229,23233,23237,23241,23245,23250,
+	23254,23258,23262,23266,23271,23275,23279,23283,
+	23287,23291,23296,23300,23304,23308,23312,23316,
+	23320,23325,23329,23333,23337,23341,23345,23349,
+	23353,23357,23361,23366,23370,23374,23378,23382,
+	23386,23390,23394,23398,23402,23406,23410,23414,
+	23418,23422,23426,23430,23434,23438,23442,23446,
+	23450,23454,23458,23462,23466,23470,23474,23478,
+	23482,23485,23489,23493,23497,23501,23505,23509,
+	23513,23517,23521,23525,23528,23532,23536,23540,
+	23544,23548,23552,23555,23559,23563,23567,23571,
+	23575,23579,23582,23586,23590,23594,23598,23601,
+	23605,23609,23613,23617,23620,23624,23628,23632,
+	23635,23639,23643,23647,23650,23654,23658,23662,
+	23665,23669,23673,23677,23680,23684,23688,23691,
+	23695,23699,23703,23706,23710,23714,23717,23721,
+	23725,23728,23732,23736,23739,23743,23747,23750,
+	23754,23757,23761,23765,23768,23772,23776,23779,
+	23783,23786,23790,23794,23797,23801,23804,23808,
+	23812,23815,23819,23822,23826,23829,23833,23836,
+	23840,23844,23847,23851,23854,23858,23861,23865,
+	23868,23872,23875,23879,23882,23886,23889,23893,
+	23896,23900,23903,23907,23910,23914,23917,23921,
+	23924,23928,23931,23935,23938,23941,23945,23948,
+	23952,23955,23959,23962,23965,23969,23972,23976,
+	23979,23983,23986,23989,23993,23996,24000,24003,
+	24006,24013,24020,24026,24033,24040,24047,24053,
+	24060,24067,24073,24080,24086,24093,24100,24106,
+	24113,24119,24126,24132,24139,24145,24152,24158,
+	24165,24171,24178,24184,24191,24197,24203,24210,
+	24216,24223,24229,24235,24242,24248,24254,24260,
+	24267,24273,24279,24285,24292,24298,24304,24310,
+	24317,24323,24329,24335,24341,24347,24353,24360,
+	24366,24372,24378,24384,24390,24396,24402,24408,
+	24414,24420,24426,24432,24438,24444,24450,24456,
+	24462,24468,24474,24480,24485,24491,24497,24503,
+	24509,24515,24521,24526,24532,24538,24544,24550,
+	24555,24561,24567,24573,24578,24584,24590,24596,
+	24601,24607,24613,24618,24624,24630,24635,24641,
+	24647,24652,24658,24663,24669,24675,24680,24686,
+	24691,24697,24702,24708,24713,24719,24724,24730,
+	24735,24741,24746,24752,24757,24763,24768,24773,
+	24779,24784,24790,24795,24800,24806,24811,24817,
+	24822,24827,24833,24838,24843,24849,24854,24859,
+	24864,24870,24875,24880,24885,24891,24896,24901,
+	24906,24912,24917,24922,24927,24932,24938,24943,
+	24948,24953,24958,24963,24968,24973,24979,24984,
+	24989,24994,24999,25004,25009,25014,25019,25024,
+	25029,25034,25039,25044,25049,25054,25059,25064,
+	25069,25074,25079,25084,25089,25094,25099,25104,
+	25109,25114,25119,25124,25129,25133,25138,25143,
+	25148,25153,25158,25163,25167,25172,25177,25182,
+	25187,25192,25196,25201,25206,25211,25215,25220,
+	25225,25230,25234,25239,25244,25249,25253,25258,
+	25263,25268,25272,25277,25282,25286,25291,25296,
+	25300,25305,25310,25314,25319,25323,25328,25333,
+	25337,25342,25346,25351,25356,25360,25365,25369,
+	25374,25378,25383,25388,25392,25397,25401,25406,
+	25410,25415,25419,25424,25428,25433,25437,25442,
+	25446,25451,25455,25459,25464,25468,25473,25477,
+	25482,25486,25490,25495,25499,25504,25508,25512,
+	25517,25521,25525,25530,25534,25539,25543,25547,
+	25552,25556,25560,25564,25569,25573,25577,25582,
+	25586,25590,25595,25599,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+	25600,25600,25600,25600,25600,25600,25600,25600,
+};
+
+/* frequency ratio of -SEMITONE_MAX to SEMITONE_MAX semitones */
+static const double semitone_tab[SEMITONE_MAX * 2 + 1] = {
+	0.00061519582514398127,0.00065177727254396188,0.00069053396600248786,0.00073159525238119247,
+	0.00077509816990634713,0.00082118790552120557,0.00087001827943392551,0.0009217522584782159,
+	0.0009765625,0.0010346319280852498,0.0010961543440521217,0.0011613350732448448,
+	0.0012303916502879625,0.0013035545450879238,0.0013810679320049757,0.0014631905047623849,
+	0.0015501963398126943,0.0016423758110424111,0.001740036558867851,0.0018435045169564318,
+	0.001953125,0.0020692638561704995,0.0021923086881042433,0.0023226701464896895,
+	0.0024607833005759251,0.0026071090901758475,0.0027621358640099515,0.0029263810095247699,
+	0.0031003926796253885,0.0032847516220848223,0.003480073117735702,0.0036870090339128636,
+	0.00390625,0.0041385277123409964,0.0043846173762084892,0.004645340292979379,
+	0.0049215666011518475,0.0052142181803516976,0.0055242717280199029,0.0058527620190495363,
+	0.0062007853592507805,0.0065695032441696445,0.0069601462354713997,0.0073740180678257316,
+	0.0078125,0.0082770554246819929,0.0087692347524169784,0.009290680585958758,
+	0.0098431332023036951,0.010428436360703395,0.011048543456039806,0.011705524038099073,
+	0.012401570718501561,0.013139006488339289,0.013920292470942799,0.014748036135651463,
+	0.015625,0.016554110849363986,0.017538469504833957,0.018581361171917516,
+	0.01968626640460739,0.02085687272140679,0.022097086912079612,0.023411048076198145,
+	0.024803141437003122,0.026278012976678578,0.027840584941885599,0.029496072271302926,
+	0.03125,0.033108221698727971,0.035076939009667914,0.037162722343835032,
+	0.03937253280921478,0.041713745442813581,0.044194173824159223,0.046822096152396291,
+	0.049606282874006244,0.052556025953357156,0.055681169883771198,0.058992144542605852,
+	0.0625,0.066216443397455957,0.0701538780193358,0.074325444687670064,
+	0.078745065618429574,0.083427490885627134,0.088388347648318447,0.093644192304792609,
+	0.09921256574801246,0.10511205190671431,0.11136233976754242,0.11798428908521168,
+	0.125,0.13243288679491191,0.1403077560386716,0.14865088937534013,
+	0.15749013123685915,0.16685498177125427,0.17677669529663689,0.18728838460958522,
+	0.19842513149602492,0.21022410381342863,0.22272467953508485,0.23596857817042335,
+	0.25,0.26486577358982383,0.28061551207734325,0.29730177875068026,
+	0.3149802624737183,0.33370996354250859,0.35355339059327379,0.37457676921917038,
+	0.3968502629920499,0.42044820762685725,0.44544935907016964,0.47193715634084676,
+	0.5,0.52973154717964765,0.56123102415468651,0.59460355750136051,
+	0.6299605249474366,0.66741992708501718,0.70710678118654757,0.74915353843834076,
+	0.79370052598409979,0.8408964152537145,0.89089871814033927,0.94387431268169353,
+	1,1.0594630943592953,1.122462048309373,1.189207115002721,
+	1.2599210498948732,1.3348398541700344,1.4142135623730951,1.4983070768766815,
+	1.5874010519681994,1.681792830507429,1.7817974362806785,1.8877486253633868,
+	2,2.1189261887185906,2.244924096618746,2.3784142300054421,
+	2.5198420997897464,2.6696797083400687,2.8284271247461903,2.996614153753363,
+	3.1748021039363992,3.363585661014858,3.5635948725613571,3.7754972507267741,
+	4,4.2378523774371812,4.4898481932374912,4.7568284600108841,
+	5.0396841995794928,5.3393594166801366,5.6568542494923806,5.993228307506727,
+	6.3496042078727974,6.727171322029716,7.1271897451227151,7.5509945014535473,
+	8,8.4757047548743625,8.9796963864749824,9.5136569200217682,
+	10.079368399158986,10.678718833360273,11.313708498984761,11.986456615013454,
+	12.699208415745595,13.454342644059432,14.25437949024543,15.101989002907095,
+	16,16.951409509748721,17.959392772949972,19.027313840043536,
+	20.158736798317967,21.357437666720553,22.627416997969522,23.972913230026901,
+	25.398416831491197,26.908685288118864,28.508758980490853,30.203978005814196,
+	32,33.902819019497443,35.918785545899944,38.054627680087073,
+	40.317473596635935,42.714875333441107,45.254833995939045,47.945826460053802,
+	50.796833662982394,53.817370576237728,57.017517960981706,60.407956011628393,
+	64,67.805638038994886,71.837571091799887,76.109255360174146,
+	80.63494719327187,85.429750666882214,90.509667991878089,95.891652920107603,
+	101.59366732596479,107.63474115247546,114.03503592196341,120.81591202325679,
+	128,135.61127607798977,143.67514218359977,152.21851072034829,
+	161.26989438654374,170.85950133376443,181.01933598375618,191.78330584021521,
+	203.18733465192958,215.26948230495091,228.07007184392683,241.63182404651357,
+	256,271.22255215597971,287.35028436719938,304.43702144069658,
+	322.53978877308765,341.71900266752868,362.03867196751236,383.56661168043064,
+	406.37466930385892,430.53896460990183,456.14014368785394,483.26364809302686,
+	512,542.44510431195943,574.70056873439876,608.87404288139317,
+	645.0795775461753,683.43800533505737,724.07734393502471,767.13322336086128,
+	812.74933860771785,861.07792921980365,912.28028737570787,966.52729618605372,
+	1024,1084.8902086239189,1149.4011374687975,1217.7480857627863,
+	1290.1591550923506,1366.8760106701147,1448.1546878700494,1534.2664467217226,
+	1625.4986772154357,
+};
@@ -0,0 +1,24 @@
+/* generated by mkgenhash (make update-genhash); do not edit */
+
+#define GENHASH_SEED	0xce14a782U
+#define GENHASH_BITS	8
+
+/* generator id + 1; zero = empty */
+static unsigned char genhash_table[256] = {
+	0,0,0,42,0,0,0,0,0,0,0,0,0,21,0,0,
+	38,0,44,30,0,0,0,3,0,0,7,0,0,0,0,0,
+	0,0,53,0,0,0,0,0,0,37,29,0,0,0,0,0,
+	0,0,0,0,0,0,1,0,0,0,0,17,4,0,0,9,
+	0,0,0,0,0,0,0,0,16,0,0,33,41,0,0,0,
+	0,0,0,0,25,23,0,0,0,0,0,0,0,0,0,36,
+	54,0,28,0,0,0,55,0,0,0,0,0,0,0,0,0,
+	0,0,59,0,0,0,0,0,50,5,0,0,0,22,24,0,
+	0,27,0,0,35,20,0,0,0,0,0,0,0,0,8,40,
+	32,0,0,6,10,39,0,0,31,11,19,56,0,46,0,0,
+	0,57,15,0,0,0,0,0,0,2,0,0,0,0,0,0,
+	0,0,43,0,0,0,0,12,0,0,49,0,45,0,0,26,
+	34,0,0,0,13,0,0,0,0,0,58,0,0,0,0,0,
+	0,0,0,0,48,18,51,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,52,47,0,0,0,0,0,0,0,
+};
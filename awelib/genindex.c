@@ -0,0 +1,39 @@
+/*================================================================
+ * genindex.c:
+ *	convert generator name to id number
+ *
+ * Copyright (C) 1996-1999 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *================================================================*/
+
+#include <string.h>
+#include "sflayer.h"
+#include "sfgenhash.h"
+#include "genhash.h"	/* generated by mkgenhash */
+
+/*----------------------------------------------------------------
+ * convert string to SF id number; return SF_EOF if not found
+ *----------------------------------------------------------------*/
+
+int sf_gen_index(char *str)
+{
+	int id;
+
+	id = genhash_table[sf_gen_hash(str, GENHASH_SEED, GENHASH_BITS)] - 1;
+	if (id < 0 || strcmp(sf_gen_text[id], str) != 0)
+		return SF_EOF;
+	return id;
+}
@@ -0,0 +1,652 @@
+/*================================================================
+ * GUS patch --> SoundFont conversion
+ *
+ * Copyright (C) 1996-2003 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *================================================================*/
+
+/*
+ * The GUS patches are converted to an SF2 soundfont on memory, so
+ * that they are loaded via awe_open_font() and awe_load_all_fonts()
+ * like SoundFont files, or saved via awe_save_soundfont().
+ *
+ * The INFO chunks and the sample data in 16bit words are written to
+ * the given file, which is used as the source file of the soundfont.
+ * Its time stamp is set to the newest one of the patch files, so the
+ * same patch set gets the same unique name for sample sharing.
+ *
+ * The voice parameters are calculated in the same way as the GUS
+ * patch loader of the sound driver, and stored as SF2 generators.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include "util.h"
+#include "guspatch.h"
+#include "sflayer.h"
+#include "awe_parm.h"
+#include "freqnote.h"
+
+
+/*----------------------------------------------------------------
+ * prototypes
+ *----------------------------------------------------------------*/
+
+/* converted instrument of a patch file */
+typedef struct _GusInstRec {
+	char *path;
+	int keynote;
+	int instrument;		/* GUS instrument number */
+	int inst;		/* index in SFInfo */
+	struct _GusInstRec *next;
+} GusInstRec;
+
+/* conversion context of a patch file */
+typedef struct _GusConv {
+	SFInfo *sf;
+	FILE *fout;
+	char *path;
+	char name[20];
+	int bank, preset, keynote;
+	int inst;		/* current instrument; -1 = not created yet */
+	int instrument;		/* GUS instrument number of inst */
+} GusConv;
+
+static void parse_header(GusPatchHeader *hp, byte *p);
+static void parse_instrument(GusInstrument *ip, byte *p);
+static void parse_layer(GusLayerData *lp, byte *p);
+static void parse_sample(GusPatchData *sp, byte *p);
+
+static int convert_sample(void *private, GusPatchHeader *hp, GusInstrument *ip,
+			  GusLayerData *lp, GusPatchData *gp, byte *data);
+static int add_inst(GusConv *conv, GusInstrument *ip);
+static void add_preset_layer(GusConv *conv, int instr);
+static int add_sample(GusConv *conv, GusPatchData *gp, byte *data);
+static SFGenLayer *new_layer(SFHeader *hdr);
+static int freq_to_cents(int mhz);
+static int envelope_time(int rate, int start, int end);
+static void set_name(char *dst, char *src, int len);
+static void put_word(FILE *fp, int val);
+static void put_dword(FILE *fp, int32 val);
+
+/* little endian values in the file */
+#define WORD(p)		((p)[0] | ((p)[1] << 8))
+#define DWORD(p)	((int32)((p)[0] | ((p)[1] << 8) | ((p)[2] << 16) | \
+				 ((uint32)(p)[3] << 24)))
+
+/* zero words after each sample (SF2 spec) */
+#define SAMPLE_PAD	46
+
+/* attenuation in cB of the GF1 volume offset; 16 steps = 6dB */
+#define offset_to_cB(ofs)	((255 - (ofs)) * 376 / 100)
+
+static GusInstRec *inst_list;	/* converted instruments */
+static long latest_mtime;	/* newest time stamp of the patch files */
+
+
+/*================================================================
+ * parse the patch file on memory
+ *----------------------------------------------------------------
+ * the loader is called for each sample in all instruments and
+ * layers.  return 0 if finished, or negative on error.
+ *================================================================*/
+
+int awe_gus_parse(byte *buf, long size, GusLoader loader, void *private)
+{
+	GusPatchHeader header;
+	GusInstrument ins;
+	GusLayerData layer;
+	GusPatchData sample;
+	byte *p, *end;
+	int i, k, j, ninsts, nlayers, rc;
+
+	DEBUG(1,fprintf(stderr, "reading header\n"));
+	if (size < GUS_PATCH_HEADER_LEN) {
+		fprintf(stderr, "awe: not a GUS patch file\n");
+		return -1;
+	}
+	parse_header(&header, buf);
+	if (memcmp(header.gravis_id, "ID#000002", GUS_ID_SIZE) != 0) {
+		fprintf(stderr, "awe: not a GUS patch file\n");
+		return -1;
+	}
+	DEBUG(0,fprintf(stderr, "data size = %d\n", (int)header.data_size));
+
+	end = buf + size;
+	p = buf + GUS_PATCH_HEADER_LEN;
+	/* zero means a single instrument or layer in old files */
+	ninsts = header.instruments ? header.instruments : 1;
+	for (i = 0; i < ninsts; i++) {
+		DEBUG(1,fprintf(stderr, "reading instrument(%d)\n", i));
+		if (end - p < GUS_INSTRUMENT_LEN)
+			goto broken;
+		parse_instrument(&ins, p);
+		p += GUS_INSTRUMENT_LEN;
+		nlayers = (byte)ins.layers ? (byte)ins.layers : 1;
+		for (k = 0; k < nlayers; k++) {
+			DEBUG(1,fprintf(stderr, "reading layer(%d)\n", k));
+			if (end - p < GUS_LAYER_LEN)
+				goto broken;
+			parse_layer(&layer, p);
+			p += GUS_LAYER_LEN;
+			for (j = 0; j < (byte)layer.samples; j++) {
+				DEBUG(1,fprintf(stderr, "reading sample(%d)\n", j));
+				if (end - p < GUS_PATCH_DATA_LEN)
+					goto broken;
+				parse_sample(&sample, p);
+				p += GUS_PATCH_DATA_LEN;
+				if (sample.wave_size < 0 ||
+				    end - p < sample.wave_size)
+					goto broken;
+				rc = loader(private, &header, &ins, &layer,
+					    &sample, p);
+				if (rc < 0)
+					return rc;
+				if (rc > 0)
+					return 0;
+				p += sample.wave_size;
+			}
+		}
+	}
+	return 0;
+
+ broken:
+	fprintf(stderr, "awe: broken GUS patch file\n");
+	return -1;
+}
+
+static void parse_header(GusPatchHeader *hp, byte *p)
+{
+	memcpy(hp->header, p, GUS_HEADER_SIZE); p += GUS_HEADER_SIZE;
+	memcpy(hp->gravis_id, p, GUS_ID_SIZE); p += GUS_ID_SIZE;
+	memcpy(hp->description, p, GUS_DESC_SIZE); p += GUS_DESC_SIZE;
+	hp->instruments = p[0];
+	hp->voices = p[1];
+	hp->channels = p[2];
+	hp->wave_forms = WORD(p + 3);
+	hp->master_volume = WORD(p + 5);
+	hp->data_size = DWORD(p + 7);
+}
+
+static void parse_instrument(GusInstrument *ip, byte *p)
+{
+	ip->instrument = WORD(p);
+	memcpy(ip->instrument_name, p + 2, 16);
+	ip->instrument_size = DWORD(p + 18);
+	ip->layers = p[22];
+}
+
+static void parse_layer(GusLayerData *lp, byte *p)
+{
+	lp->layer_duplicate = p[0];
+	lp->layer = p[1];
+	lp->layer_size = DWORD(p + 2);
+	lp->samples = p[6];
+}
+
+static void parse_sample(GusPatchData *sp, byte *p)
+{
+	memcpy(sp->wave_name, p, 7);
+	sp->fractions = p[7];
+	sp->wave_size = DWORD(p + 8);
+	sp->start_loop = DWORD(p + 12);
+	sp->end_loop = DWORD(p + 16);
+	sp->sample_rate = WORD(p + 20);
+	sp->low_frequency = DWORD(p + 22);
+	sp->high_frequency = DWORD(p + 26);
+	sp->root_frequency = DWORD(p + 30);
+	sp->tune = WORD(p + 34);
+	sp->balance = p[36];
+	memcpy(sp->envelope_rate, p + 37, GUS_ENVELOPES);
+	memcpy(sp->envelope_offset, p + 43, GUS_ENVELOPES);
+	sp->tremolo_sweep = p[49];
+	sp->tremolo_rate = p[50];
+	sp->tremolo_depth = p[51];
+	sp->vibrato_sweep = p[52];
+	sp->vibrato_rate = p[53];
+	sp->vibrato_depth = p[54];
+	sp->modes = p[55];
+	sp->scale_frequency = WORD(p + 56);
+	sp->scale_factor = WORD(p + 58);
+}
+
+
+/*================================================================
+ * build a soundfont
+ *================================================================*/
+
+/* initialize the soundfont and write the INFO chunks */
+int awe_gus_begin_soundfont(SFInfo *sf, char *name, FILE *fout)
+{
+	int i, len, size;
+
+	memset(sf, 0, sizeof(*sf));
+	sf->version = 2;
+	sf->minorversion = 1;
+	sf->sf_name = safe_strdup(name);
+	latest_mtime = 0;
+
+	/* zero terminated and padded to even bytes */
+	len = strlen(name);
+	if (len > 255)
+		len = 255;
+	size = (len + 2) & ~1;
+	fwrite("ifil", 4, 1, fout);
+	put_dword(fout, 4);
+	put_word(fout, sf->version);
+	put_word(fout, sf->minorversion);
+	fwrite("isng", 4, 1, fout);
+	put_dword(fout, 8);
+	fwrite("EMU8000\0", 8, 1, fout);
+	fwrite("INAM", 4, 1, fout);
+	put_dword(fout, size);
+	fwrite(name, len, 1, fout);
+	for (i = len; i < size; i++)
+		fputc(0, fout);
+
+	sf->infopos = 0;
+	sf->infosize = ftell(fout);
+	sf->samplepos = sf->infosize;
+	sf->samplesize = 0;
+	return ferror(fout) ? -1 : 0;
+}
+
+/*
+ * convert the patch file; the voices are put on the preset bank/preset.
+ * if keynote is given, only the sample for the key is converted on
+ * the key, as the drum sets of timidity.
+ * return 0 if successful, or -1 on error.
+ */
+int awe_gus_add_patch(SFInfo *sf, FILE *fout, FILE *fp, char *path,
+		      int bank, int preset, int keynote)
+{
+	GusConv conv;
+	GusInstRec *rec;
+	struct stat st;
+	byte *buf;
+	char *p;
+	int rc;
+
+	/* the same patch is converted only once */
+	for (rec = inst_list; rec; rec = rec->next) {
+		if (rec->keynote == keynote && strcmp(rec->path, path) == 0)
+			break;
+	}
+
+	memset(&conv, 0, sizeof(conv));
+	conv.sf = sf;
+	conv.fout = fout;
+	conv.path = path;
+	conv.bank = bank >= 0 ? bank : 0;
+	conv.preset = preset;
+	conv.keynote = keynote;
+	conv.inst = -1;
+	if ((p = strrchr(path, '/')) != NULL)
+		p++;
+	else
+		p = path;
+	set_name(conv.name, p, 20);
+	if ((p = strchr(conv.name, '.')) != NULL)
+		memset(p, 0, conv.name + 20 - p);
+
+	if (rec) {
+		DEBUG(0,fprintf(stderr, "reuse %s\n", path));
+		for (; rec; rec = rec->next) {
+			if (rec->keynote == keynote &&
+			    strcmp(rec->path, path) == 0) {
+				conv.inst = rec->inst;
+				add_preset_layer(&conv, preset >= 0 ? preset : rec->instrument);
+			}
+		}
+		return 0;
+	}
+
+	if (fstat(fileno(fp), &st) < 0) {
+		fprintf(stderr, "awe: can't get stat of %s\n", path);
+		return -1;
+	}
+	if ((long)st.st_mtime > latest_mtime)
+		latest_mtime = (long)st.st_mtime;
+	buf = (byte*)safe_malloc(st.st_size > 0 ? st.st_size : 1);
+	if (fread(buf, 1, st.st_size, fp) != st.st_size) {
+		fprintf(stderr, "awe: can't read %s\n", path);
+		safe_free(buf);
+		return -1;
+	}
+	rc = awe_gus_parse(buf, st.st_size, convert_sample, &conv);
+	safe_free(buf);
+	if (rc == 0 && ferror(fout)) {
+		fprintf(stderr, "awe: can't write sample data\n");
+		rc = -1;
+	}
+	return rc;
+}
+
+/* add the terminators and fix the time stamp of the sample file */
+int awe_gus_end_soundfont(SFInfo *sf, FILE *fout)
+{
+	GusInstRec *rec, *next;
+	struct timespec ts[2];
+
+	sf->preset = (SFPresetHdr*)safe_realloc(sf->preset, sizeof(SFPresetHdr) * (sf->npresets + 1));
+	memset(&sf->preset[sf->npresets], 0, sizeof(SFPresetHdr));
+	set_name(sf->preset[sf->npresets].hdr.name, "EOP", 20);
+	sf->npresets++;
+	sf->inst = (SFInstHdr*)safe_realloc(sf->inst, sizeof(SFInstHdr) * (sf->ninsts + 1));
+	memset(&sf->inst[sf->ninsts], 0, sizeof(SFInstHdr));
+	set_name(sf->inst[sf->ninsts].hdr.name, "EOI", 20);
+	sf->ninsts++;
+	sf->sample = (SFSampleInfo*)safe_realloc(sf->sample, sizeof(SFSampleInfo) * (sf->nsamples + 1));
+	memset(&sf->sample[sf->nsamples], 0, sizeof(SFSampleInfo));
+	set_name(sf->sample[sf->nsamples].name, "EOS", 20);
+	sf->nsamples++;
+
+	for (rec = inst_list; rec; rec = next) {
+		next = rec->next;
+		safe_free(rec->path);
+		safe_free(rec);
+	}
+	inst_list = NULL;
+
+	if (fflush(fout) != 0 || ferror(fout)) {
+		fprintf(stderr, "awe: can't write sample data\n");
+		return -1;
+	}
+	ts[0].tv_sec = ts[1].tv_sec = latest_mtime;
+	ts[0].tv_nsec = ts[1].tv_nsec = 0;
+	futimens(fileno(fout), ts);
+	return 0;
+}
+
+
+/*----------------------------------------------------------------
+ * convert a sample to an instrument layer
+ *----------------------------------------------------------------*/
+
+static int convert_sample(void *private, GusPatchHeader *hp, GusInstrument *ip,
+			  GusLayerData *lp, GusPatchData *gp, byte *data)
+{
+	GusConv *conv = (GusConv*)private;
+	SFGenLayer *lay;
+	int low, high, coarse, sample, val;
+	int attack, decay, release;
+
+	low = freq_to_cents(gp->low_frequency);
+	high = freq_to_cents(gp->high_frequency);
+	coarse = 0;
+	if (conv->keynote >= 0) {
+		/* fixed key; played in the pitch of the lowest key */
+		if (conv->keynote < low / 100 || high / 100 < conv->keynote)
+			return 0;
+		coarse = low / 100 - conv->keynote;
+		low = high = conv->keynote;
+	} else {
+		low = (low + 99) / 100;
+		high = high / 100;
+		if (low > high)
+			low = high;
+	}
+
+	if (conv->inst < 0 || conv->instrument != ip->instrument) {
+		if (add_inst(conv, ip) < 0)
+			return -1;
+	}
+	if ((sample = add_sample(conv, gp, data)) < 0)
+		return -1;
+
+	lay = new_layer(&conv->sf->inst[conv->inst].hdr);
+	awe_sf_set_gen(lay, SF_keyRange, (high << 8) | low);
+	if (coarse)
+		awe_sf_set_gen(lay, SF_coarseTune, coarse);
+	/* balance 0-15 to -500 - 500 */
+	awe_sf_set_gen(lay, SF_panEffectsSend, ((int)gp->balance * 8 - 60) * 500 / 64);
+
+	if (gp->modes & GUS_MODE_ENVELOPE) {
+		byte *rate = gp->envelope_rate;
+		byte *ofs = gp->envelope_offset;
+		attack = envelope_time(rate[0], 0, ofs[0]);
+		decay = envelope_time(rate[1], ofs[0], ofs[1]);
+		release = envelope_time(rate[2], ofs[1], ofs[2]) +
+			envelope_time(rate[3], ofs[1], ofs[2]) +
+			envelope_time(rate[4], ofs[3], ofs[4]) +
+			envelope_time(rate[5], ofs[4], ofs[5]);
+		awe_sf_set_gen(lay, SF_attackEnv2, awe_msec_to_timecent(attack));
+		awe_sf_set_gen(lay, SF_decayEnv2, awe_msec_to_timecent(decay));
+		awe_sf_set_gen(lay, SF_releaseEnv2, awe_msec_to_timecent(release));
+		val = ofs[0] > ofs[2] ? offset_to_cB(ofs[2]) - offset_to_cB(ofs[0]) : 0;
+		awe_sf_set_gen(lay, SF_sustainEnv2, val);
+		awe_sf_set_gen(lay, SF_initAtten, offset_to_cB(ofs[0]));
+	}
+	/* the LFO depths are the register values of the driver */
+	if (gp->tremolo_rate > 0 && gp->tremolo_depth > 0) {
+		awe_sf_set_gen(lay, SF_freqLfo1,
+			       awe_mHz_to_abscent(gp->tremolo_rate * 1000 / 38));
+		awe_sf_set_gen(lay, SF_lfo1ToVolume,
+			       (gp->tremolo_depth / 2) * 120 / 128);
+	}
+	if (gp->vibrato_rate > 0 && gp->vibrato_depth > 0) {
+		awe_sf_set_gen(lay, SF_freqLfo2,
+			       awe_mHz_to_abscent(gp->vibrato_rate * 1000 / 38));
+		awe_sf_set_gen(lay, SF_lfo2ToPitch,
+			       (gp->vibrato_depth / 6) * 1200 / 128);
+	}
+	/* scale_frequency and scale_factor are ignored as the driver */
+	if (gp->modes & GUS_MODE_LOOP)
+		awe_sf_set_gen(lay, SF_sampleFlags, 1);
+	awe_sf_set_gen(lay, SF_sampleId, sample);
+
+	/* only one sample for the fixed key */
+	return conv->keynote >= 0 ? 1 : 0;
+}
+
+/* add an instrument and its preset layer */
+static int add_inst(GusConv *conv, GusInstrument *ip)
+{
+	SFInfo *sf = conv->sf;
+	GusInstRec *rec;
+
+	sf->inst = (SFInstHdr*)safe_realloc(sf->inst, sizeof(SFInstHdr) * (sf->ninsts + 1));
+	memset(&sf->inst[sf->ninsts], 0, sizeof(SFInstHdr));
+	set_name(sf->inst[sf->ninsts].hdr.name, conv->name, 20);
+	conv->inst = sf->ninsts++;
+	conv->instrument = ip->instrument;
+
+	rec = (GusInstRec*)safe_malloc(sizeof(*rec));
+	rec->path = safe_strdup(conv->path);
+	rec->keynote = conv->keynote;
+	rec->instrument = ip->instrument;
+	rec->inst = conv->inst;
+	rec->next = inst_list;
+	inst_list = rec;
+
+	add_preset_layer(conv, conv->preset >= 0 ? conv->preset : ip->instrument);
+	return 0;
+}
+
+/* add a layer to the current instrument on the preset;
+ * the preset is created if not exist
+ */
+static void add_preset_layer(GusConv *conv, int instr)
+{
+	SFInfo *sf = conv->sf;
+	SFGenLayer *lay;
+	char name[32];
+	int i;
+
+	for (i = 0; i < sf->npresets; i++) {
+		if (sf->preset[i].bank == conv->bank &&
+		    sf->preset[i].preset == instr)
+			break;
+	}
+	if (i >= sf->npresets) {
+		sf->preset = (SFPresetHdr*)safe_realloc(sf->preset, sizeof(SFPresetHdr) * (sf->npresets + 1));
+		memset(&sf->preset[i], 0, sizeof(SFPresetHdr));
+		if (conv->keynote >= 0) {
+			sprintf(name, "Drum %d", instr);
+			set_name(sf->preset[i].hdr.name, name, 20);
+		} else
+			set_name(sf->preset[i].hdr.name, conv->name, 20);
+		sf->preset[i].bank = conv->bank;
+		sf->preset[i].preset = instr;
+		sf->npresets++;
+	}
+
+	lay = new_layer(&sf->preset[i].hdr);
+	if (conv->keynote >= 0)
+		awe_sf_set_gen(lay, SF_keyRange, (conv->keynote << 8) | conv->keynote);
+	awe_sf_set_gen(lay, SF_instrument, conv->inst);
+}
+
+/*
+ * convert the wave to 16bit signed words and append to the file.
+ * a bi-directional loop is unrolled, since the chip can't play it.
+ * return the sample index, or -1 on error.
+ */
+static int add_sample(GusConv *conv, GusPatchData *gp, byte *data)
+{
+	static byte *buf;
+	static long bufsize;
+	SFInfo *sf = conv->sf;
+	SFSampleInfo *sp;
+	long i, n, width, lstart, lend, loopsize, total, start;
+	int val, note;
+
+	width = (gp->modes & GUS_MODE_16BIT) ? 2 : 1;
+	n = gp->wave_size / width;
+	lstart = gp->start_loop / width;
+	lend = gp->end_loop / width;
+	if (lend > n)
+		lend = n;
+	if (lstart < 0 || lstart > lend)
+		lstart = lend;
+	loopsize = 0;
+	if ((gp->modes & GUS_MODE_LOOP) && (gp->modes & GUS_MODE_LOOP_BIDIR))
+		loopsize = lend - lstart;
+
+	total = (n + loopsize + SAMPLE_PAD) * 2;
+	if (total > bufsize) {
+		safe_free(buf);
+		buf = (byte*)safe_malloc(total);
+		bufsize = total;
+	}
+	for (i = 0; i < n; i++) {
+		if (width == 2)
+			val = WORD(data + i * 2);
+		else
+			val = data[i] << 8;
+		if (gp->modes & GUS_MODE_UNSIGNED)
+			val ^= 0x8000;
+		buf[i * 2] = val & 0xff;
+		buf[i * 2 + 1] = (val >> 8) & 0xff;
+	}
+	if (loopsize > 0) {
+		/* insert the reversed loop after the loop end */
+		memmove(buf + (lend + loopsize) * 2, buf + lend * 2, (n - lend) * 2);
+		for (i = 0; i < loopsize; i++) {
+			buf[(lend + i) * 2] = buf[(lend - 1 - i) * 2];
+			buf[(lend + i) * 2 + 1] = buf[(lend - 1 - i) * 2 + 1];
+		}
+	}
+	memset(buf + (n + loopsize) * 2, 0, SAMPLE_PAD * 2);
+	if (fwrite(buf, total, 1, conv->fout) != 1)
+		return -1;
+
+	sf->sample = (SFSampleInfo*)safe_realloc(sf->sample, sizeof(SFSampleInfo) * (sf->nsamples + 1));
+	sp = &sf->sample[sf->nsamples];
+	memset(sp, 0, sizeof(*sp));
+	if (gp->wave_name[0])
+		set_name(sp->name, gp->wave_name, 7);
+	else
+		set_name(sp->name, conv->name, 20);
+	start = sf->samplesize / 2;
+	sp->startsample = start;
+	sp->endsample = start + n + loopsize;
+	sp->startloop = start + lstart;
+	sp->endloop = start + lend + loopsize;
+	sp->samplerate = gp->sample_rate;
+	note = freq_to_cents(gp->root_frequency);
+	sp->originalPitch = note / 100;
+	sp->pitchCorrection = -(note % 100);
+	sp->sampletype = 1;
+	sf->samplesize += total;
+	return sf->nsamples++;
+}
+
+
+/*----------------------------------------------------------------
+ * misc
+ *----------------------------------------------------------------*/
+
+/* add an empty layer */
+static SFGenLayer *new_layer(SFHeader *hdr)
+{
+	hdr->layer = (SFGenLayer*)safe_realloc(hdr->layer, sizeof(SFGenLayer) * (hdr->nlayers + 1));
+	memset(&hdr->layer[hdr->nlayers], 0, sizeof(SFGenLayer));
+	return &hdr->layer[hdr->nlayers++];
+}
+
+/* frequency in mHz to cents of key number (0-12700) */
+static int freq_to_cents(int mhz)
+{
+	int cents;
+	if (mhz <= 8176)
+		return 0;
+	/* rounded; the key frequencies in the files are truncated */
+	cents = awe_freq_to_cent_round(mhz);
+	return cents > 12700 ? 12700 : cents;
+}
+
+/* envelope time in msec from the GUS ramp rate and volume offsets */
+static int envelope_time(int rate, int start, int end)
+{
+	int r, p, t;
+
+	r = (3 - ((rate >> 6) & 3)) * 3;
+	p = rate & 0x3f;
+	if (p == 0)
+		p = 1;
+	t = end - start;
+	if (t < 0)
+		t = -t;
+	t <<= 13 - r;
+	return (t * 10) / (p * 441);
+}
+
+/* copy the name of up to len letters; padded with zero */
+static void set_name(char *dst, char *src, int len)
+{
+	int i;
+	for (i = 0; i < len && src[i]; i++)
+		dst[i] = src[i];
+	for (; i < 20; i++)
+		dst[i] = 0;
+}
+
+static void put_word(FILE *fp, int val)
+{
+	fputc(val & 0xff, fp);
+	fputc((val >> 8) & 0xff, fp);
+}
+
+static void put_dword(FILE *fp, int32 val)
+{
+	put_word(fp, val & 0xffff);
+	put_word(fp, (val >> 16) & 0xffff);
+}
@@ -22,6 +22,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
 #ifdef linux
 #include <linux/soundcard.h>
 #else
@@ -42,26 +45,76 @@
 /* virtual bank record */
 typedef struct _VBank {
 	char *name;
+	int resolved;		/* name is the path found in search path */
 	LoadList *list;
+	LoadHash *hash;		/* index of list */
 	struct _VBank *next;
+	struct _VBank *hnext;	/* next in name hash chain */
 } VBank;
 
+/* source file of virtual bank */
+typedef struct _BankSrc {
+	char *name;
+	int mtime, size;	/* file stamp when read; -1 = unknown */
+	struct _BankSrc *next;
+} BankSrc;
+
+/* resident soundfont */
+typedef struct _FontCache {
+	char *path;
+	int mtime, size;
+	FILE *fd;
+	SFInfo sfinfo;
+	struct _FontCache *next;
+} FontCache;
+
+/* resident bank table */
+typedef struct _BankCache {
+	char *path;
+	char *search_path;
+	VBank *vbanks, *vmap, *vmapkey;
+	char *default_font;
+	int default_resolved;
+	int map_loaded;
+	BankSrc *srcs;
+	struct _BankCache *next;
+} BankCache;
+
+static void set_search_path(void);
 static int is_virtual_bank(char *path);
+static int is_compiled_bank(char *path);
 static int load_virtual_bank(AWEOps *ops, char *path, LoadList *part_list, int locked);
 static int load_patch(AWEOps *ops, char *path, LoadList *lp, LoadList *exlp, int locked, int load_alt);
 static int load_map(AWEOps *ops, LoadList *lp, int locked);
+static int load_bank_map(AWEOps *ops, char *path, int locked);
 
 static LoadList *make_virtual_list(VBank *v, LoadList *part_list);
+static void init_bank_table(void);
+static int read_bank_table(char *path);
 static void make_bank_table(FILE *fp);
 static void include_bank_table(char *name);
+static void add_bank_source(char *path);
+static VBank *find_vbank(char *name);
+static void make_bank_index(void);
 static void free_bank_table(void);
 
 static int do_load_all_banks(AWEOps *ops, int locked);
 static int do_load_banks(AWEOps *ops, int locked);
 static void mark_loaded_presets(LoadList *pat, LoadList *list);
-static LoadList *find_list(LoadList *list, SFPatchRec *pat);
 static int find_matching_map(SFPatchRec *pat, int level);
-static int find_matching_in_list(SFPatchRec *pat, LoadList *vlist, int level);
+static int find_matching_in_list(SFPatchRec *pat, VBank *v, int level);
+
+static int compiled_bank_name(char *dst, int maxlen, char *path);
+static void resolve_font_names(void);
+static int read_compiled_bank(FILE *fp, char *srcpath, int maxlen);
+static int write_compiled_bank(FILE *fp);
+
+static SFInfo *get_font_cache(char *path, FILE **fdp);
+static int read_font(SFInfo *sf, FILE *fd, char *path);
+static int restore_bank_cache(char *path);
+static void store_bank_cache(char *path);
+static void free_bank_cache(BankCache *bc);
+static int check_bank_source(char *path, int mtime, int size);
 
 
 
@@ -90,15 +143,7 @@ int awe_load_bank(AWEOps *ops, char *name, LoadList *list, int locked)
 	int rc;
 	char sfpath[256];
 
-	/* set default search path */
-	if (awe_option.search_path)
-		search_path = safe_strdup(awe_option.search_path);
-	else {
-		char *p = getenv("SFBANKDIR");
-		if (p == NULL || *p == 0)
-			p = DEFAULT_SF_PATH;
-		search_path = safe_strdup(p);
-	}
+	set_search_path();
 
 	if (awe_search_file_name(sfpath, sizeof(sfpath), name, search_path, path_ext_all)) {
 		if (is_virtual_bank(sfpath))
@@ -113,13 +158,63 @@ int awe_load_bank(AWEOps *ops, char *name, LoadList *list, int locked)
 	return rc;
 }
 
+/*----------------------------------------------------------------
+ * load only the preset mapping of a virtual bank
+ *----------------------------------------------------------------*/
+
+int awe_load_bank_map(AWEOps *ops, char *name, int locked)
+{
+	int rc;
+	char sfpath[256];
+
+	set_search_path();
+
+	if (awe_search_file_name(sfpath, sizeof(sfpath), name, search_path, path_ext_all)) {
+		if (is_virtual_bank(sfpath))
+			rc = load_bank_map(ops, sfpath, locked);
+		else
+			rc = AWE_RET_OK; /* soundfont has no mapping */
+	} else
+		rc = AWE_RET_NOT_FOUND;
+
+	free(search_path);
+	return rc;
+}
+
+/* set default search path */
+static void set_search_path(void)
+{
+	if (awe_option.search_path)
+		search_path = safe_strdup(awe_option.search_path);
+	else {
+		char *p = getenv("SFBANKDIR");
+		if (p == NULL || *p == 0)
+			p = DEFAULT_SF_PATH;
+		search_path = safe_strdup(p);
+	}
+}
+
 /*----------------------------------------------------------------
  * virtual bank record handlers
  *----------------------------------------------------------------*/
 
 static VBank *vbanks, *vmap, *vmapkey;
 static char *default_font;
+static int default_resolved;
+static int map_loaded;		/* mapping was sent by awe_load_bank_map() */
 static LoadList *bank_list, *excl_list;
+static LoadHash *bank_hash;
+static BankSrc *bank_srcs;
+
+/* resident soundfonts and bank tables */
+static int bank_cache_enabled;
+static FontCache *font_cache;
+static BankCache *bank_cache;
+static BankCache *cur_bank_cache;	/* entry restored in this load */
+
+/* font name hash of vbanks */
+#define VBANK_HASH_SIZE	256
+static VBank *vbank_hash[VBANK_HASH_SIZE];
 
 
 /* check the extension */
@@ -130,6 +225,17 @@ static int is_virtual_bank(char *path)
 		return FALSE;
 	if (strcmp(p + 1, "bnk") == 0)
 		return TRUE;
+	return is_compiled_bank(path);
+}
+
+/* check the extension of compiled bank */
+static int is_compiled_bank(char *path)
+{
+	char *p;
+	if ((p = strrchr(path, '.')) == NULL)
+		return FALSE;
+	if (strcmp(p + 1, "bnc") == 0)
+		return TRUE;
 	return FALSE;
 }
 
@@ -137,34 +243,63 @@ static int is_virtual_bank(char *path)
 static int load_virtual_bank(AWEOps *ops, char *path, LoadList *part_list, int locked)
 {
 	int rc;
-	FILE *fp;
 
-	if ((fp = fopen(path, "r")) == NULL) {
-		fprintf(stderr, "awe: can't open virtual bank %s\n", path);
+	init_bank_table();
+	if (! restore_bank_cache(path) && ! read_bank_table(path)) {
+		free_bank_table();
 		return AWE_RET_ERR;
 	}
-	vbanks = NULL;
-	vmap = vmapkey = NULL;
-	default_font = NULL;
 	bank_list = awe_merge_loadlist(NULL, part_list); /* copy the list */
 	excl_list = NULL;
 
-	make_bank_table(fp);
-	fclose(fp);
+	make_bank_index();
 
 	if (bank_list)
 		rc = do_load_banks(ops, locked);  /* loading partial fonts */
 	else
 		rc = do_load_all_banks(ops, locked); /* loading all fonts */
 
-	if (default_font)
-		free(default_font);
+	if (bank_hash)
+		awe_free_loadhash(bank_hash);
+	bank_hash = NULL;
 	if (bank_list)
 		awe_free_loadlist(bank_list);
 	if (excl_list)
 		awe_free_loadlist(excl_list);
 
-	free_bank_table();
+	if (bank_cache_enabled)
+		store_bank_cache(path);
+	else
+		free_bank_table();
+
+	return rc;
+}
+
+/* read a virtual bank config file and load its preset mapping;
+ * the bank cache remembers it, so that awe_load_bank() doesn't
+ * send the mapping again
+ */
+static int load_bank_map(AWEOps *ops, char *path, int locked)
+{
+	int rc = AWE_RET_OK;
+
+	init_bank_table();
+	if (! restore_bank_cache(path) && ! read_bank_table(path)) {
+		free_bank_table();
+		return AWE_RET_ERR;
+	}
+
+	if (vmap)
+		rc = load_map(ops, vmap->list, locked);
+	if (vmapkey && rc == AWE_RET_OK)
+		rc = load_map(ops, vmapkey->list, locked);
+	if (rc == AWE_RET_OK)
+		map_loaded = TRUE;
+
+	if (bank_cache_enabled)
+		store_bank_cache(path);
+	else
+		free_bank_table();
 
 	return rc;
 }
@@ -178,16 +313,20 @@ static int do_load_all_banks(AWEOps *ops, int locked)
 	if (vmap || vmapkey) {
 		/* load preset mapping to the driver */
 		if (vmap) {
-			rc = load_map(ops, vmap->list, locked);
-			if (rc == AWE_RET_ERR || rc == AWE_RET_NOMEM)
-				return rc;
+			if (! map_loaded) {
+				rc = load_map(ops, vmap->list, locked);
+				if (rc == AWE_RET_ERR || rc == AWE_RET_NOMEM)
+					return rc;
+			}
 			/* add the loaded presets to exclusive list */
 			excl_list = awe_merge_loadlist(excl_list, vmap->list);
 		}
 		if (vmapkey) {
-			rc = load_map(ops, vmapkey->list, locked);
-			if (rc == AWE_RET_ERR || rc == AWE_RET_NOMEM)
-				return rc;
+			if (! map_loaded) {
+				rc = load_map(ops, vmapkey->list, locked);
+				if (rc == AWE_RET_ERR || rc == AWE_RET_NOMEM)
+					return rc;
+			}
 			/* add the loaded presets to exclusive list */
 			excl_list = awe_merge_loadlist(excl_list, vmapkey->list);
 		}
@@ -220,12 +359,12 @@ static int do_load_banks(AWEOps *ops, int locked)
 	VBank *v;
 
 	/* load preset mapping if any.. */
-	if (vmap) {
+	if (vmap && ! map_loaded) {
 		rc = load_map(ops, vmap->list, locked);
 		if (rc == AWE_RET_ERR || rc == AWE_RET_NOMEM)
 			return rc;
 	}
-	if (vmapkey) {
+	if (vmapkey && ! map_loaded) {
 		rc = load_map(ops, vmapkey->list, locked);
 		if (rc == AWE_RET_ERR || rc == AWE_RET_NOMEM)
 			return rc;
@@ -246,11 +385,13 @@ static int do_load_banks(AWEOps *ops, int locked)
 			continue;
 
 		rc = load_patch(ops, v->name, vlist, NULL, locked, TRUE);
-		awe_free_loadlist(vlist);
-		if (rc == AWE_RET_ERR || rc == AWE_RET_NOMEM)
+		if (rc == AWE_RET_ERR || rc == AWE_RET_NOMEM) {
+			awe_free_loadlist(vlist);
 			return rc;
+		}
 
 		mark_loaded_presets(vlist, bank_list);
+		awe_free_loadlist(vlist);
 	}
 
 	if (default_font) {
@@ -292,42 +433,28 @@ static void mark_loaded_presets(LoadList *pat, LoadList *list)
 }
 
 
-/* search the matching element with pat */
-static LoadList *find_list(LoadList *list, SFPatchRec *pat)
-{
-	LoadList *p;
-	for (p = list; p; p = p->next) {
-		if (awe_match_preset(&p->map, pat))
-			return p;
-	}
-	return NULL;
-}
-
-/* if the given pattern matches to an element in the given list,
- * reutrn TRUE.  the mapped pattern is recursively searched.
- * if additional instrument is necessary to be loaded, prepend it
- * to the loading list.
+/* if the given pattern matches to a loaded element in the list of
+ * the given bank, reutrn TRUE.  the mapped pattern is recursively
+ * searched.  if additional instrument is necessary to be loaded,
+ * prepend it to the loading list.
  */
-static int find_matching_in_list(SFPatchRec *pat, LoadList *vlist, int level)
+static int find_matching_in_list(SFPatchRec *pat, VBank *v, int level)
 {
 	LoadList *p, *curp;
 	SFPatchRec tmp;
-	for (p = vlist; p; p = p->next) {
-		if (! p->loaded)
-			continue;
-		if (awe_match_preset(&p->map, pat)) {
-			if (find_list(bank_list, &p->pat))
-				return TRUE;
-			tmp = p->pat;
-			if (tmp.keynote == -1)
-				tmp.keynote = pat->keynote;
-			bank_list = curp = awe_add_loadlist(bank_list, &tmp, NULL);
-			if (find_matching_map(&curp->map, level+1))
-				curp->loaded = TRUE;
-			return TRUE;
-		}
-	}
-	return FALSE;
+
+	if ((p = awe_loadhash_find(v->hash, pat, TRUE)) == NULL)
+		return FALSE;
+	if (awe_loadhash_find(bank_hash, &p->pat, FALSE))
+		return TRUE;
+	tmp = p->pat;
+	if (tmp.keynote == -1)
+		tmp.keynote = pat->keynote;
+	bank_list = curp = awe_add_loadlist(bank_list, &tmp, NULL);
+	awe_loadhash_add(bank_hash, curp);
+	if (find_matching_map(&curp->map, level+1))
+		curp->loaded = TRUE;
+	return TRUE;
 }
 
 
@@ -343,11 +470,11 @@ static int find_matching_map(SFPatchRec *pat, int level)
 		return TRUE;
 
 	if (vmapkey) {
-		if (find_matching_in_list(pat, vmapkey->list, level))
+		if (find_matching_in_list(pat, vmapkey, level))
 			return TRUE;
 	}
 	if (vmap) {
-		if (find_matching_in_list(pat, vmap->list, level))
+		if (find_matching_in_list(pat, vmap, level))
 			return TRUE;
 	}
 	return FALSE;
@@ -375,6 +502,59 @@ static LoadList *make_virtual_list(VBank *v, LoadList *part_list)
 }
 
 
+/* reset bank record table */
+static void init_bank_table(void)
+{
+	vbanks = NULL;
+	vmap = vmapkey = NULL;
+	default_font = NULL;
+	default_resolved = FALSE;
+	map_loaded = FALSE;
+	bank_srcs = NULL;
+}
+
+
+/* build bank table from the compiled bank if it's up to date,
+ * otherwise from the bank config file
+ */
+static int read_bank_table(char *path)
+{
+	char cpath[256], srcpath[256];
+	FILE *fp;
+	int ok;
+
+	*srcpath = 0;
+	if (compiled_bank_name(cpath, sizeof(cpath), path) &&
+	    (fp = fopen(cpath, "r")) != NULL) {
+		ok = read_compiled_bank(fp, srcpath, sizeof(srcpath));
+		fclose(fp);
+		if (ok) {
+			DEBUG(1,fprintf(stderr, "use compiled bank %s\n", cpath));
+			return TRUE;
+		}
+		DEBUG(1,fprintf(stderr, "compiled bank %s is obsolete\n", cpath));
+	}
+
+	if (is_compiled_bank(path)) {
+		/* read the original config file instead */
+		if (! *srcpath) {
+			fprintf(stderr, "awe: illegal compiled bank %s\n", path);
+			return FALSE;
+		}
+		path = srcpath;
+	}
+
+	if ((fp = fopen(path, "r")) == NULL) {
+		fprintf(stderr, "awe: can't open virtual bank %s\n", path);
+		return FALSE;
+	}
+	add_bank_source(path);
+	make_bank_table(fp);
+	fclose(fp);
+	return TRUE;
+}
+
+
 /* read a virtual bank config file and build bank table */
 static void make_bank_table(FILE *fp)
 {
@@ -414,6 +594,7 @@ static void make_bank_table(FILE *fp)
 				/* set default font file */
 				if (default_font) free(default_font);
 				default_font = safe_strdup(arg);
+				default_resolved = FALSE;
 				break;
 			default:
 				fprintf(stderr, "awe: illegal bank command %s", line);
@@ -441,8 +622,6 @@ static void make_bank_table(FILE *fp)
 			if (v == NULL) {
 				/* the list is not created.. */
 				v = (VBank*)safe_malloc(sizeof(VBank));
-				v->list = NULL;
-				v->name = NULL;
 				if (map.keynote != -1)
 					vmapkey = v;
 				else
@@ -451,18 +630,7 @@ static void make_bank_table(FILE *fp)
 
 		} else {
 			/* search the list matching the font name */
-			for (v = vbanks; v; v = v->next) {
-				if (strcmp(v->name, name) == 0)
-					break;
-			}
-			if (v == NULL) {
-				/* not found -- create a new list */
-				v = (VBank*)safe_malloc(sizeof(VBank));
-				v->list = NULL;
-				v->name = safe_strdup(name);
-				v->next = vbanks;
-				vbanks = v;
-			}
+			v = find_vbank(name);
 		}
 
 		/* append the current record */
@@ -478,6 +646,7 @@ static void include_bank_table(char *name)
 	FILE *fp;
 	if (awe_search_file_name(path, sizeof(path), name, search_path, path_ext_bank) &&
 	    (fp = fopen(path, "r")) != NULL) {
+		add_bank_source(path);
 		make_bank_table(fp);
 		fclose(fp);
 	} else {
@@ -486,10 +655,71 @@ static void include_bank_table(char *name)
 }
 
 
+/* remember the bank file read for the table */
+static void add_bank_source(char *path)
+{
+	BankSrc *src, **p;
+	struct stat st;
+
+	src = (BankSrc*)safe_malloc(sizeof(BankSrc));
+	src->name = safe_strdup(path);
+	if (stat(path, &st) == 0) {
+		src->mtime = (int)st.st_mtime;
+		src->size = (int)st.st_size;
+	} else
+		src->mtime = src->size = -1;
+	for (p = &bank_srcs; *p; p = &(*p)->next)
+		;
+	*p = src;
+}
+
+
+/* search the bank record with the font name; create if not found */
+static VBank *find_vbank(char *name)
+{
+	VBank *v;
+	unsigned int key;
+	char *p;
+
+	key = 0;
+	for (p = name; *p; p++)
+		key = key * 31 + (unsigned char)*p;
+	key %= VBANK_HASH_SIZE;
+
+	for (v = vbank_hash[key]; v; v = v->hnext) {
+		if (strcmp(v->name, name) == 0)
+			return v;
+	}
+
+	/* not found -- create a new list */
+	v = (VBank*)safe_malloc(sizeof(VBank));
+	v->name = safe_strdup(name);
+	v->next = vbanks;
+	vbanks = v;
+	v->hnext = vbank_hash[key];
+	vbank_hash[key] = v;
+	return v;
+}
+
+
+/* create the indices of preset mappings and the loading list */
+static void make_bank_index(void)
+{
+	/* the cached table has the indices already */
+	if (vmap && ! vmap->hash)
+		vmap->hash = awe_make_loadhash(vmap->list);
+	if (vmapkey && ! vmapkey->hash)
+		vmapkey->hash = awe_make_loadhash(vmapkey->list);
+	bank_hash = awe_make_loadhash(bank_list);
+}
+
+
 /* free bank record table */
 static void free_bank_table(void)
 {
 	VBank *v, *next;
+	BankSrc *src, *snext;
+
 	for (v = vbanks; v; v = next) {
 		next = v->next;
 		if (v->name)
@@ -498,16 +728,590 @@ static void free_bank_table(void)
 		safe_free(v);
 	}
 	vbanks = NULL;
+	memset(vbank_hash, 0, sizeof(vbank_hash));
 	if (vmap) {
 		/* this has no name */
+		awe_free_loadhash(vmap->hash);
 		awe_free_loadlist(vmap->list);
 		safe_free(vmap);
 	}
 	if (vmapkey) {
 		/* this has no name */
+		awe_free_loadhash(vmapkey->hash);
 		awe_free_loadlist(vmapkey->list);
 		safe_free(vmapkey);
 	}
+	vmap = vmapkey = NULL;
+	if (default_font)
+		safe_free(default_font);
+	default_font = NULL;
+	for (src = bank_srcs; src; src = snext) {
+		snext = src->next;
+		safe_free(src->name);
+		safe_free(src);
+	}
+	bank_srcs = NULL;
+}
+
+
+/*----------------------------------------------------------------
+ * compiled virtual bank
+ *----------------------------------------------------------------
+ * A compiled bank (.bnc) keeps the bank table with all included
+ * files expanded and all font names resolved along the search path.
+ * It's used in place of the bank file of the same name as long as
+ * the search path and the recorded source files are unchanged.
+ *
+ * Each value is stored as a 32bit little endian integer, and each
+ * string as its length followed by the letters:
+ *
+ *	magic, version, search path,
+ *	number of sources, (path, mtime, size) of each source,
+ *	default font, resolved flag,
+ *	number of fonts, (path, resolved flag, list) of each font,
+ *	preset mapping list, keynote mapping list
+ *
+ * The fonts not found at compile time are searched again when loaded.
+ *
+ * A list is the number of records followed by pat/map presets of
+ * each record, in the same order as the table in memory, so that the
+ * first matching record is identical with the original bank.
+ *----------------------------------------------------------------*/
+
+#define BNC_MAGIC	"AWEBNC"
+#define BNC_VERSION	1
+#define BNC_MAX_RECORDS	0x100000
+
+/* compile a virtual bank file */
+int awe_compile_bank(char *name, char *outfile)
+{
+	char path[256], cpath[256];
+	FILE *fp;
+	int rc;
+
+	set_search_path();
+	if (! awe_search_file_name(path, sizeof(path), name, search_path, path_ext_bank)) {
+		free(search_path);
+		return AWE_RET_NOT_FOUND;
+	}
+	if (outfile == NULL) {
+		if (is_compiled_bank(path) ||
+		    ! compiled_bank_name(cpath, sizeof(cpath), path)) {
+			fprintf(stderr, "awe: can't make compiled bank name for %s\n", path);
+			free(search_path);
+			return AWE_RET_ERR;
+		}
+		outfile = cpath;
+	}
+	if ((fp = fopen(path, "r")) == NULL) {
+		fprintf(stderr, "awe: can't open virtual bank %s\n", path);
+		free(search_path);
+		return AWE_RET_ERR;
+	}
+
+	init_bank_table();
+	add_bank_source(path);
+	make_bank_table(fp);
+	fclose(fp);
+	resolve_font_names();
+
+	rc = AWE_RET_ERR;
+	if ((fp = fopen(outfile, "w")) == NULL)
+		fprintf(stderr, "awe: can't create compiled bank %s\n", outfile);
+	else {
+		rc = write_compiled_bank(fp);
+		if (fclose(fp) != 0)
+			rc = AWE_RET_ERR;
+		if (rc != AWE_RET_OK) {
+			fprintf(stderr, "awe: can't write compiled bank %s\n", outfile);
+			unlink(outfile);
+		}
+	}
+
+	free_bank_table();
+	free(search_path);
+	return rc;
+}
+
+
+/* make the name of compiled bank from the bank file name */
+static int compiled_bank_name(char *dst, int maxlen, char *path)
+{
+	char *p;
+	int len;
+
+	if ((p = strrchr(path, '.')) == NULL || strchr(p, '/') != NULL)
+		return FALSE;
+	if (strcmp(p + 1, "bnk") != 0 && strcmp(p + 1, "bnc") != 0)
+		return FALSE;
+	len = p - path;
+	if (len + 5 > maxlen)
+		return FALSE;
+	memcpy(dst, path, len);
+	strcpy(dst + len, ".bnc");
+	return TRUE;
+}
+
+
+/* replace font names with the paths found in the search path */
+static void resolve_font_names(void)
+{
+	VBank *v;
+	char path[256];
+
+	for (v = vbanks; v; v = v->next) {
+		if (awe_search_file_name(path, sizeof(path), v->name, search_path, path_ext)) {
+			safe_free(v->name);
+			v->name = safe_strdup(path);
+			v->resolved = TRUE;
+		} else
+			fprintf(stderr, "awe: can't find font file %s\n", v->name);
+	}
+	if (default_font) {
+		if (awe_search_file_name(path, sizeof(path), default_font, search_path, path_ext)) {
+			safe_free(default_font);
+			default_font = safe_strdup(path);
+			default_resolved = TRUE;
+		} else
+			fprintf(stderr, "awe: can't find font file %s\n", default_font);
+	}
+}
+
+
+/*
+ * write compiled bank
+ */
+
+static void put_int(FILE *fp, int val)
+{
+	putc(val & 0xff, fp);
+	putc((val >> 8) & 0xff, fp);
+	putc((val >> 16) & 0xff, fp);
+	putc((val >> 24) & 0xff, fp);
+}
+
+static void put_string(FILE *fp, char *str)
+{
+	int len = str ? strlen(str) : 0;
+	put_int(fp, len);
+	if (len > 0)
+		fwrite(str, 1, len, fp);
+}
+
+static void put_list(FILE *fp, LoadList *list)
+{
+	LoadList *p;
+	int n;
+
+	for (n = 0, p = list; p; p = p->next)
+		n++;
+	put_int(fp, n);
+	for (p = list; p; p = p->next) {
+		put_int(fp, p->pat.preset);
+		put_int(fp, p->pat.bank);
+		put_int(fp, p->pat.keynote);
+		put_int(fp, p->map.preset);
+		put_int(fp, p->map.bank);
+		put_int(fp, p->map.keynote);
+	}
+}
+
+static int write_compiled_bank(FILE *fp)
+{
+	BankSrc *src;
+	VBank *v;
+	int n;
+
+	fwrite(BNC_MAGIC, 1, strlen(BNC_MAGIC), fp);
+	put_int(fp, BNC_VERSION);
+	put_string(fp, search_path);
+
+	for (n = 0, src = bank_srcs; src; src = src->next)
+		n++;
+	put_int(fp, n);
+	for (src = bank_srcs; src; src = src->next) {
+		if (src->mtime == -1) {
+			fprintf(stderr, "awe: can't stat bank file %s\n", src->name);
+			return AWE_RET_ERR;
+		}
+		put_string(fp, src->name);
+		put_int(fp, src->mtime);
+		put_int(fp, src->size);
+	}
+
+	put_string(fp, default_font);
+	put_int(fp, default_resolved);
+
+	for (n = 0, v = vbanks; v; v = v->next)
+		n++;
+	put_int(fp, n);
+	for (v = vbanks; v; v = v->next) {
+		put_string(fp, v->name);
+		put_int(fp, v->resolved);
+		put_list(fp, v->list);
+	}
+
+	put_list(fp, vmap ? vmap->list : NULL);
+	put_list(fp, vmapkey ? vmapkey->list : NULL);
+
+	if (ferror(fp))
+		return AWE_RET_ERR;
+	return AWE_RET_OK;
+}
+
+
+/*
+ * read compiled bank
+ */
+
+static int get_int(FILE *fp)
+{
+	unsigned int val;
+	val = getc(fp) & 0xff;
+	val |= (getc(fp) & 0xff) << 8;
+	val |= (getc(fp) & 0xff) << 16;
+	val |= (getc(fp) & 0xff) << 24;
+	return (int)val;
+}
+
+/* read a string into the buffer; return FALSE if too long */
+static int get_string(FILE *fp, char *buf, int maxlen)
+{
+	int len = get_int(fp);
+	if (len < 0 || len >= maxlen)
+		return FALSE;
+	if (len > 0 && fread(buf, 1, len, fp) != len)
+		return FALSE;
+	buf[len] = 0;
+	return TRUE;
+}
+
+/* read a list in the stored order */
+static int get_list(FILE *fp, LoadList **listp)
+{
+	LoadList *list, *p, *prev, *next;
+	SFPatchRec pat, map;
+	int i, n;
+
+	*listp = NULL;
+	n = get_int(fp);
+	if (n < 0 || n > BNC_MAX_RECORDS)
+		return FALSE;
+	list = NULL;
+	for (i = 0; i < n; i++) {
+		pat.preset = get_int(fp);
+		pat.bank = get_int(fp);
+		pat.keynote = get_int(fp);
+		map.preset = get_int(fp);
+		map.bank = get_int(fp);
+		map.keynote = get_int(fp);
+		list = awe_add_loadlist(list, &pat, &map);
+	}
+	/* reverse the prepended list */
+	for (prev = NULL, p = list; p; prev = p, p = next) {
+		next = p->next;
+		p->next = prev;
+	}
+	*listp = prev;
+	return ! feof(fp);
+}
+
+/* check whether the recorded bank file is unchanged */
+static int check_bank_source(char *path, int mtime, int size)
+{
+	struct stat st;
+	if (stat(path, &st) < 0)
+		return FALSE;
+	return (int)st.st_mtime == mtime && (int)st.st_size == size;
+}
+
+/* read the bank table from the compiled bank;
+ * the path of the original bank file is stored in srcpath.
+ * return FALSE if the file is invalid or obsolete.
+ */
+static int read_compiled_bank(FILE *fp, char *srcpath, int maxlen)
+{
+	char buf[256];
+	int i, n, mtime, size, ok;
+	VBank *v, *prev, *next;
+	LoadList *list;
+
+	if (fread(buf, 1, strlen(BNC_MAGIC), fp) != strlen(BNC_MAGIC) ||
+	    memcmp(buf, BNC_MAGIC, strlen(BNC_MAGIC)) != 0 ||
+	    get_int(fp) != BNC_VERSION)
+		return FALSE;
+
+	/* check the search path and the source files */
+	ok = get_string(fp, buf, sizeof(buf)) && strcmp(buf, search_path) == 0;
+	n = get_int(fp);
+	if (n <= 0 || n > BNC_MAX_RECORDS)
+		return FALSE;
+	for (i = 0; i < n; i++) {
+		if (! get_string(fp, buf, sizeof(buf)))
+			goto error;
+		mtime = get_int(fp);
+		size = get_int(fp);
+		if (i == 0 && (int)strlen(buf) < maxlen)
+			strcpy(srcpath, buf);
+		if (ok && ! check_bank_source(buf, mtime, size))
+			ok = FALSE;
+		if (ok)
+			add_bank_source(buf);
+	}
+	if (! ok)
+		goto error;
+
+	/* read the bank table */
+	if (! get_string(fp, buf, sizeof(buf)))
+		goto error;
+	if (*buf)
+		default_font = safe_strdup(buf);
+	default_resolved = get_int(fp);
+	if (default_font && default_resolved && access(default_font, R_OK) != 0)
+		goto error;
+	n = get_int(fp);
+	if (n < 0 || n > BNC_MAX_RECORDS)
+		goto error;
+	for (i = 0; i < n; i++) {
+		if (! get_string(fp, buf, sizeof(buf)))
+			goto error;
+		v = (VBank*)safe_malloc(sizeof(VBank));
+		v->name = safe_strdup(buf);
+		v->next = vbanks;
+		vbanks = v;
+		v->resolved = get_int(fp);
+		if (! get_list(fp, &v->list))
+			goto error;
+		/* the font may be removed after compiled */
+		if (v->resolved && access(v->name, R_OK) != 0)
+			goto error;
+	}
+	/* reverse the prepended list */
+	for (prev = NULL, v = vbanks; v; prev = v, v = next) {
+		next = v->next;
+		v->next = prev;
+	}
+	vbanks = prev;
+
+	if (! get_list(fp, &list))
+		goto error;
+	if (list) {
+		vmap = (VBank*)safe_malloc(sizeof(VBank));
+		vmap->list = list;
+	}
+	if (! get_list(fp, &list))
+		goto error;
+	if (list) {
+		vmapkey = (VBank*)safe_malloc(sizeof(VBank));
+		vmapkey->list = list;
+	}
+	return TRUE;
+
+ error:
+	free_bank_table();
+	return FALSE;
+}
+
+
+/*----------------------------------------------------------------
+ * resident soundfonts and bank tables
+ *----------------------------------------------------------------
+ * When the cache is enabled, the parsed soundfonts are kept open
+ * and the bank tables are kept in memory after loading, so that
+ * the next awe_load_bank() call can reuse them.  Each entry is
+ * checked with the time stamp and the size of its files, and is
+ * read again if changed.
+ *----------------------------------------------------------------*/
+
+void awe_set_bank_cache(int on)
+{
+	if (! on)
+		awe_free_bank_cache();
+	bank_cache_enabled = on;
+}
+
+void awe_free_bank_cache(void)
+{
+	FontCache *fc, *fnext;
+	BankCache *bc, *bnext;
+
+	for (fc = font_cache; fc; fc = fnext) {
+		fnext = fc->next;
+		awe_free_soundfont(&fc->sfinfo);
+		fclose(fc->fd);
+		safe_free(fc->path);
+		safe_free(fc);
+	}
+	font_cache = NULL;
+	for (bc = bank_cache; bc; bc = bnext) {
+		bnext = bc->next;
+		free_bank_cache(bc);
+	}
+	bank_cache = NULL;
+}
+
+/* get the parsed soundfont; read the file if not cached yet */
+static SFInfo *get_font_cache(char *path, FILE **fdp)
+{
+	FontCache *fc, **prevp;
+	struct stat st;
+
+	if (stat(path, &st) < 0) {
+		fprintf(stderr, "awe: can't open SoundFont file %s\n", path);
+		return NULL;
+	}
+	for (prevp = &font_cache; (fc = *prevp) != NULL; prevp = &fc->next) {
+		if (strcmp(fc->path, path) == 0)
+			break;
+	}
+	if (fc) {
+		if (fc->mtime == (int)st.st_mtime && fc->size == (int)st.st_size) {
+			*fdp = fc->fd;
+			return &fc->sfinfo;
+		}
+		/* changed -- read it again */
+		*prevp = fc->next;
+		awe_free_soundfont(&fc->sfinfo);
+		fclose(fc->fd);
+		safe_free(fc->path);
+		safe_free(fc);
+	}
+
+	fc = (FontCache*)safe_malloc(sizeof(FontCache));
+	if ((fc->fd = fopen(path, "r")) == NULL) {
+		fprintf(stderr, "awe: can't open SoundFont file %s\n", path);
+		safe_free(fc);
+		return NULL;
+	}
+	if (read_font(&fc->sfinfo, fc->fd, path) < 0) {
+		fclose(fc->fd);
+		safe_free(fc);
+		return NULL;
+	}
+	fc->path = safe_strdup(path);
+	fc->mtime = (int)st.st_mtime;
+	fc->size = (int)st.st_size;
+	fc->next = font_cache;
+	font_cache = fc;
+	*fdp = fc->fd;
+	return &fc->sfinfo;
+}
+
+static void clear_loaded_flags(LoadList *p)
+{
+	for (; p; p = p->next)
+		p->loaded = FALSE;
+}
+
+/* restore the bank table of the given bank file if it's unchanged */
+static int restore_bank_cache(char *path)
+{
+	BankCache *bc, **prevp;
+	BankSrc *src;
+	VBank *v;
+
+	cur_bank_cache = NULL;
+	if (! bank_cache_enabled)
+		return FALSE;
+	for (prevp = &bank_cache; (bc = *prevp) != NULL; prevp = &bc->next) {
+		if (strcmp(bc->path, path) == 0)
+			break;
+	}
+	if (bc == NULL)
+		return FALSE;
+
+	for (src = bc->srcs; src; src = src->next) {
+		if (! check_bank_source(src->name, src->mtime, src->size))
+			break;
+	}
+	if (src || strcmp(bc->search_path, search_path) != 0) {
+		/* changed -- read it again */
+		*prevp = bc->next;
+		free_bank_cache(bc);
+		return FALSE;
+	}
+
+	vbanks = bc->vbanks;
+	vmap = bc->vmap;
+	vmapkey = bc->vmapkey;
+	default_font = bc->default_font;
+	default_resolved = bc->default_resolved;
+	map_loaded = bc->map_loaded;
+	bank_srcs = bc->srcs;
+	/* the flags were set in the last load; the mapping sent by
+	 * awe_load_bank_map() stays loaded, since do_load_banks()
+	 * looks up only the loaded map entries
+	 */
+	for (v = vbanks; v; v = v->next)
+		clear_loaded_flags(v->list);
+	if (vmap && ! map_loaded)
+		clear_loaded_flags(vmap->list);
+	if (vmapkey && ! map_loaded)
+		clear_loaded_flags(vmapkey->list);
+	cur_bank_cache = bc;
+	return TRUE;
+}
+
+/* keep the current bank table for later loads */
+static void store_bank_cache(char *path)
+{
+	BankCache *bc;
+
+	if (cur_bank_cache == NULL) {
+		bc = (BankCache*)safe_malloc(sizeof(BankCache));
+		bc->path = safe_strdup(path);
+		bc->search_path = safe_strdup(search_path);
+		bc->vbanks = vbanks;
+		bc->vmap = vmap;
+		bc->vmapkey = vmapkey;
+		bc->default_font = default_font;
+		bc->default_resolved = default_resolved;
+		bc->map_loaded = map_loaded;
+		bc->srcs = bank_srcs;
+		bc->next = bank_cache;
+		bank_cache = bc;
+		/* the name hash refers to the stored table */
+		memset(vbank_hash, 0, sizeof(vbank_hash));
+	} else
+		cur_bank_cache->map_loaded = map_loaded;
+	cur_bank_cache = NULL;
+	init_bank_table();
+}
+
+static void free_bank_cache(BankCache *bc)
+{
+	vbanks = bc->vbanks;
+	vmap = bc->vmap;
+	vmapkey = bc->vmapkey;
+	default_font = bc->default_font;
+	bank_srcs = bc->srcs;
+	free_bank_table();
+	safe_free(bc->path);
+	safe_free(bc->search_path);
+	safe_free(bc);
+}
+
+
+/*----------------------------------------------------------------
+ * check and read a soundfont file
+ *----------------------------------------------------------------
+ * The broken file is rejected before parsing, since the parser
+ * trusts the sizes and indices in the file.
+ *----------------------------------------------------------------*/
+
+static int read_font(SFInfo *sf, FILE *fd, char *path)
+{
+	if (awe_check_soundfont(fd, awe_verbose) > 0) {
+		fprintf(stderr, "awe: broken SoundFont %s\n", path);
+		return -1;
+	}
+	rewind(fd);
+	if (awe_load_soundfont(sf, fd, TRUE) < 0) {
+		fprintf(stderr, "awe: can't load SoundFont %s\n", path);
+		return -1;
+	}
+	awe_correct_samples(sf);
+	return 0;
 }
 
 
@@ -527,32 +1331,40 @@ static int load_patch(AWEOps *ops, char *name, LoadList *lp, LoadList *exlp, int
 	char path[256];
 	int rc;
 	static SFInfo sfinfo;
+	SFInfo *sf;
 
 	if (! awe_search_file_name(path, sizeof(path), name, search_path, path_ext)) {
 		fprintf(stderr, "awe: can't find font file %s\n", name);
 		return AWE_RET_SKIP;
 	}
-	if ((fd = fopen(path, "r")) == NULL) {
-		fprintf(stderr, "awe: can't open SoundFont file %s\n", path);
-		return AWE_RET_SKIP;
-	}
-	if (awe_load_soundfont(&sfinfo, fd, TRUE) < 0) {
-		fprintf(stderr, "awe: can't load SoundFont %s\n", path);
-		return AWE_RET_SKIP;
+	if (bank_cache_enabled) {
+		if ((sf = get_font_cache(path, &fd)) == NULL)
+			return AWE_RET_SKIP;
+	} else {
+		if ((fd = fopen(path, "r")) == NULL) {
+			fprintf(stderr, "awe: can't open SoundFont file %s\n", path);
+			return AWE_RET_SKIP;
+		}
+		if (read_font(&sfinfo, fd, path) < 0) {
+			fclose(fd);
+			return AWE_RET_SKIP;
+		}
+		sf = &sfinfo;
 	}
-	awe_correct_samples(&sfinfo);
 
-	awe_open_font(ops, &sfinfo, fd, locked);
+	awe_open_font(ops, sf, fd, locked);
 	/*rc = awe_load_font_buffered(&sfinfo, lp, exlp, load_alt);*/
 	if (lp)
-		rc = awe_load_font_list(ops, &sfinfo, lp, load_alt);
+		rc = awe_load_font_list(ops, sf, lp, load_alt);
 	else
-		rc = awe_load_all_fonts(ops, &sfinfo, exlp);
+		rc = awe_load_all_fonts(ops, sf, exlp);
 
-	awe_close_font(ops, &sfinfo);
-	awe_free_soundfont(&sfinfo);
-	if (fd)
-		fclose(fd);
+	awe_close_font(ops, sf);
+	if (! bank_cache_enabled) {
+		awe_free_soundfont(sf);
+		if (fd)
+			fclose(fd);
+	}
 
 	return rc;
 }
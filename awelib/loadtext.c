@@ -21,22 +21,94 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
 #include "slist.h"
 #include "util.h"
 #include "sffile.h"
 #include "sflayer.h"
 
+/*
+ * The text is parsed token by token, and SFInfo is filled directly
+ * without building the whole s-list tree.  The generators and layers
+ * of each header are collected in the work buffers, and copied to
+ * the exactly sized arrays at the end of the header.
+ */
+
 /*----------------------------------------------------------------
  * prototypes
  *----------------------------------------------------------------*/
 
-static void load_sflist(SFInfo *sf, SList list);
-static void load_preset(SFInfo *sf, SList at);
-static void load_inst(SFInfo *lp, SList at);
-static void load_layers(SFHeader *hdr, SList at);
-static void load_lists(SFGenLayer *lay, SList at);
-static int sf_index(char *str);
-static void load_sample(SFInfo *sf, SList at);
+static void load_sflist(SFInfo *sf, FILE *fp);
+static void load_preset(SFInfo *sf, FILE *fp);
+static void load_inst(SFInfo *sf, FILE *fp);
+static void load_layers(SFHeader *hdr, FILE *fp);
+static void load_lists(SFGenLayer *lay, FILE *fp);
+static void load_sample(SFInfo *sf, FILE *fp);
+static int open_entries(FILE *fp);
+static int next_token(FILE *fp);
+static int read_int(FILE *fp, int *val);
+static void skip_list(FILE *fp);
+static void *grow_array(void *ptr, int *size, int nums, int unit);
+
+
+/*----------------------------------------------------------------
+ * token reader with one token push-back
+ *----------------------------------------------------------------*/
+
+static int cur_token, token_saved;
+static SAtomVal cur_val;
+
+static int next_token(FILE *fp)
+{
+	if (token_saved)
+		token_saved = FALSE;
+	else
+		cur_token = SReadToken(fp, &cur_val);
+	return cur_token;
+}
+
+#define unget_token()	(token_saved = TRUE)
+
+/* read an integer if exists */
+static int read_int(FILE *fp, int *val)
+{
+	if (next_token(fp) == S_TOKEN_INT) {
+		*val = cur_val.i;
+		return TRUE;
+	}
+	unget_token();
+	return FALSE;
+}
+
+/* skip the rest of the current list including the close parenthesis */
+static void skip_list(FILE *fp)
+{
+	int depth = 1;
+	while (depth > 0) {
+		switch (next_token(fp)) {
+		case S_TOKEN_OPEN:
+			depth++;
+			break;
+		case S_TOKEN_CLOSE:
+			depth--;
+			break;
+		case S_TOKEN_EOF:
+			fprintf(stderr, "SList: non-closed list\n");
+			return;
+		}
+	}
+}
+
+/* make room for nums + 1 elements */
+static void *grow_array(void *ptr, int *size, int nums, int unit)
+{
+	if (nums < *size)
+		return ptr;
+	*size = *size ? *size * 2 : 16;
+	if (*size <= nums)
+		*size = nums + 1;
+	return safe_realloc(ptr, *size * unit);
+}
 
 
 /*----------------------------------------------------------------
@@ -45,47 +117,75 @@ static void load_sample(SFInfo *sf, SList at);
 
 void awe_load_textinfo(SFInfo *sf, FILE *fp)
 {
-	SList list;
-	while ((list = SReadFile(fp)) != NIL) {
-		/*print_list(list);*/
-		load_sflist(sf, list);
-		SFree(list);
+	int tok;
+
+	token_saved = FALSE;
+	while ((tok = next_token(fp)) != S_TOKEN_EOF) {
+		if (tok == S_TOKEN_OPEN)
+			load_sflist(sf, fp);
+		else if (tok == S_TOKEN_CLOSE) {
+			fprintf(stderr, "SList: non-matched parenthesis\n");
+			break;
+		}
 	}
+	SReadDone(fp);
 }
 
 /*----------------------------------------------------------------
  * parse a list
  *----------------------------------------------------------------*/
 
-static void load_sflist(SFInfo *sf, SList list)
+static void load_sflist(SFInfo *sf, FILE *fp)
 {
-	if (! SListP(list))
-		return;
+	char *tag;
+	int val;
 
-	list = SCar(list);
-	if (! SFunP(list))
+	if (next_token(fp) != S_TOKEN_FUN) {
+		unget_token();
+		skip_list(fp);
 		return;
+	}
 
-	if (SFunIs(list, "Name")) {
-		sf->sf_name = safe_strdup(SStr(SCdr(list)));
-	} else if (SFunIs(list, "SamplePos")) {
-		sf->samplepos = SInt(SCdr(list));
-		sf->samplesize = SInt(SCdr(SCdr(list)));
-	} else if (SFunIs(list, "SoundFont")) {
-		sf->version = SInt(SCdr(list));
-		sf->minorversion = SInt(SCdr(SCdr(list)));
-	} else if (SFunIs(list, "InfoPos")) {
-		sf->infopos = SInt(SCdr(list));
-		sf->infosize = SInt(SCdr(SCdr(list)));
-	} else if (SFunIs(list, "Presets")) {
-		load_preset(sf, SCdr(list));
-	} else if (SFunIs(list, "Instruments")) {
-		load_inst(sf, SCdr(list));
-	} else if (SFunIs(list, "SampleInfo")) {
-		load_sample(sf, SCdr(list));
+	tag = cur_val.f;
+	if (strcmp(tag, "Name") == 0) {
+		if (next_token(fp) == S_TOKEN_STR)
+			sf->sf_name = safe_strdup(cur_val.s);
+		else
+			unget_token();
+	} else if (strcmp(tag, "SamplePos") == 0) {
+		if (read_int(fp, &val)) sf->samplepos = val;
+		if (read_int(fp, &val)) sf->samplesize = val;
+	} else if (strcmp(tag, "SoundFont") == 0) {
+		if (read_int(fp, &val)) sf->version = val;
+		if (read_int(fp, &val)) sf->minorversion = val;
+	} else if (strcmp(tag, "InfoPos") == 0) {
+		if (read_int(fp, &val)) sf->infopos = val;
+		if (read_int(fp, &val)) sf->infosize = val;
+	} else if (strcmp(tag, "Presets") == 0) {
+		load_preset(sf, fp);
+	} else if (strcmp(tag, "Instruments") == 0) {
+		load_inst(sf, fp);
+	} else if (strcmp(tag, "SampleInfo") == 0) {
+		load_sample(sf, fp);
 	} else {
-		fprintf(stderr, "unknown tag %s\n", SFun(list));
+		fprintf(stderr, "unknown tag %s\n", tag);
 	}
+	skip_list(fp);
+}
+
+/* skip to the list of entries; return TRUE if found.
+ * the number given before the list is ignored.
+ */
+static int open_entries(FILE *fp)
+{
+	int tok;
+	while ((tok = next_token(fp)) != S_TOKEN_OPEN) {
+		if (tok == S_TOKEN_CLOSE || tok == S_TOKEN_EOF) {
+			unget_token();
+			return FALSE;
+		}
+	}
+	return TRUE;
 }
 
 
@@ -93,31 +193,42 @@ static void load_sflist(SFInfo *sf, SList list)
  * parse preset list
  *----------------------------------------------------------------*/
 
-static void load_preset(SFInfo *sf, SList at)
+static void load_preset(SFInfo *sf, FILE *fp)
 {
-	int i;
 	SFPresetHdr *p;
+	int tok, size, val;
 
-	for (; at != NIL && !SListP(at); at = SCdr(at))
-		;
-	if (at == NIL) return;
-	if ((sf->npresets = SIndex(at)) <= 0) {
-		sf->npresets = 0;
+	if (! open_entries(fp))
 		return;
-	}
-	sf->preset = (SFPresetHdr*)safe_malloc
-		(sizeof(SFPresetHdr) * sf->npresets);
-
-	at = SCar(at);
-	p = sf->preset;
-	for (i = 0; i < sf->npresets && at != NIL; i++) {
-		SList list = SCar(at);
-		list = SCdr(list); /* skip index */
-		strncpy(p->hdr.name, SStr(list), 20); list = SCdr(list);
-		p->preset = SInt(SCdr(SCar(list))); list = SCdr(list);
-		p->bank = SInt(SCdr(SCar(list))); list = SCdr(list);
-		load_layers(&p->hdr, list);
-		at = SCdr(at); p++;
+	sf->npresets = size = 0;
+	sf->preset = NULL;
+	while ((tok = next_token(fp)) != S_TOKEN_CLOSE && tok != S_TOKEN_EOF) {
+		if (tok != S_TOKEN_OPEN)
+			continue;
+		sf->preset = (SFPresetHdr*)grow_array(sf->preset, &size, sf->npresets, sizeof(SFPresetHdr));
+		p = &sf->preset[sf->npresets++];
+		memset(p, 0, sizeof(*p));
+		next_token(fp); /* skip index */
+		if (next_token(fp) == S_TOKEN_STR)
+			strncpy(p->hdr.name, cur_val.s, 20);
+		else
+			unget_token();
+		/* (preset #) (bank #) (layers...) */
+		while ((tok = next_token(fp)) == S_TOKEN_OPEN) {
+			tok = next_token(fp);
+			if (tok == S_TOKEN_FUN && strcmp(cur_val.f, "preset") == 0) {
+				if (read_int(fp, &val)) p->preset = val;
+			} else if (tok == S_TOKEN_FUN && strcmp(cur_val.f, "bank") == 0) {
+				if (read_int(fp, &val)) p->bank = val;
+			} else {
+				unget_token();
+				load_layers(&p->hdr, fp);
+				continue;
+			}
+			skip_list(fp);
+		}
+		unget_token();
+		skip_list(fp);
 	}
 }
 
@@ -126,28 +237,31 @@ static void load_preset(SFInfo *sf, SList at)
  * parse instrument list
  *----------------------------------------------------------------*/
 
-static void load_inst(SFInfo *sf, SList at)
+static void load_inst(SFInfo *sf, FILE *fp)
 {
-	int i;
 	SFInstHdr *p;
+	int tok, size;
 
-	for (; at != NIL && !SListP(at); at = SCdr(at))
-		;
-	if (at == NIL) return;
-	if ((sf->ninsts = SIndex(at)) <= 0) {
-		sf->ninsts = 0;
+	if (! open_entries(fp))
 		return;
-	}
-	sf->inst = (SFInstHdr*)safe_malloc(sizeof(SFInstHdr) * sf->ninsts);
-
-	at = SCar(at);
-	p = sf->inst;
-	for (i = 0; i < sf->ninsts && at != NIL; i++) {
-		SList list = SCar(at);
-		list = SCdr(list); /* skip index */
-		strncpy(p->hdr.name, SStr(list), 20); list = SCdr(list);
-		load_layers(&p->hdr, list);
-		at = SCdr(at); p++;
+	sf->ninsts = size = 0;
+	sf->inst = NULL;
+	while ((tok = next_token(fp)) != S_TOKEN_CLOSE && tok != S_TOKEN_EOF) {
+		if (tok != S_TOKEN_OPEN)
+			continue;
+		sf->inst = (SFInstHdr*)grow_array(sf->inst, &size, sf->ninsts, sizeof(SFInstHdr));
+		p = &sf->inst[sf->ninsts++];
+		memset(p, 0, sizeof(*p));
+		next_token(fp); /* skip index */
+		if (next_token(fp) == S_TOKEN_STR)
+			strncpy(p->hdr.name, cur_val.s, 20);
+		else
+			unget_token();
+		if (next_token(fp) == S_TOKEN_OPEN)
+			load_layers(&p->hdr, fp);
+		else
+			unget_token();
+		skip_list(fp);
 	}
 }
 
@@ -156,23 +270,27 @@ static void load_inst(SFInfo *sf, SList at)
  * parse preset/inst layer list
  *----------------------------------------------------------------*/
 
-static void load_layers(SFHeader *hdr, SList at)
-{
-	int i;
-	SFGenLayer *p;
+static SFGenLayer *work_layers;
+static int work_layer_size;
 
-	if ((hdr->nlayers = SIndex(at)) <= 0) {
+static void load_layers(SFHeader *hdr, FILE *fp)
+{
+	int tok, n;
+
+	n = 0;
+	while ((tok = next_token(fp)) != S_TOKEN_CLOSE && tok != S_TOKEN_EOF) {
+		if (tok != S_TOKEN_OPEN)
+			continue;
+		work_layers = (SFGenLayer*)grow_array(work_layers, &work_layer_size, n, sizeof(SFGenLayer));
+		load_lists(&work_layers[n], fp);
+		n++;
+	}
+	if ((hdr->nlayers = n) <= 0) {
 		hdr->nlayers = 0;
 		return;
 	}
-	hdr->layer = (SFGenLayer*)safe_malloc(sizeof(SFGenLayer) * hdr->nlayers);
-	p = hdr->layer;
-	at = SCar(at);
-	for (i = 0; i < hdr->nlayers; i++) {
-		load_lists(p, at);
-		p++;
-		at = SCdr(at);
-	}
+	hdr->layer = (SFGenLayer*)safe_malloc(sizeof(SFGenLayer) * n);
+	memcpy(hdr->layer, work_layers, sizeof(SFGenLayer) * n);
 }
 
 
@@ -180,42 +298,35 @@ static void load_layers(SFHeader *hdr, SList at)
  * parse layered elements
  *----------------------------------------------------------------*/
 
-static void load_lists(SFGenLayer *lay, SList at)
-{
-	int i;
-	SFGenRec *p;
+static SFGenRec *work_gens;
+static int work_gen_size;
 
-	lay->nlists = SIndex(at) - 1;
-	if (lay->nlists < 0) {
+static void load_lists(SFGenLayer *lay, FILE *fp)
+{
+	int tok, n, val;
+
+	if (next_token(fp) == S_TOKEN_OPEN)
+		unget_token(); /* no layer tag */
+	n = 0;
+	while ((tok = next_token(fp)) != S_TOKEN_CLOSE && tok != S_TOKEN_EOF) {
+		if (tok != S_TOKEN_OPEN)
+			continue;
+		work_gens = (SFGenRec*)grow_array(work_gens, &work_gen_size, n, sizeof(SFGenRec));
+		if (next_token(fp) == S_TOKEN_FUN)
+			work_gens[n].oper = sf_gen_index(cur_val.f);
+		else
+			work_gens[n].oper = SF_EOF;
+		work_gens[n].amount = read_int(fp, &val) ? val : 0;
+		skip_list(fp);
+		n++;
+	}
+	if ((lay->nlists = n) <= 0) {
 		lay->nlists = 0;
 		lay->list = NULL;
 		return;
 	}
-	lay->list = (SFGenRec*)safe_malloc(sizeof(SFGenRec) * lay->nlists);
-	p = lay->list;
-	at = SCdr(SCar(at));
-	for (i = 0; i < lay->nlists; i++) {
-		SList list = SCar(at);
-		p->oper = sf_index(SFun(list));
-		p->amount = SInt(SCdr(list));
-		p++;
-		at = SCdr(at);
-	}
-}
-
-
-/*----------------------------------------------------------------
- * convert string to SF id number
- *----------------------------------------------------------------*/
-
-static int sf_index(char *str)
-{
-	int i;
-	for (i = 0; i < SF_EOF; i++) {
-		if (strcmp(sf_gen_text[i], str) == 0)
-			return i;
-	}
-	return SF_EOF;
+	lay->list = (SFGenRec*)safe_malloc(sizeof(SFGenRec) * n);
+	memcpy(lay->list, work_gens, sizeof(SFGenRec) * n);
 }
 
 
@@ -223,41 +334,53 @@ static int sf_index(char *str)
  * parse sample info list
  *----------------------------------------------------------------*/
 
-static void load_sample(SFInfo *sf, SList at)
+static void load_sample(SFInfo *sf, FILE *fp)
 {
-	int i;
 	SFSampleInfo *p;
-	int in_rom;
+	int tok, size, in_rom, val;
 
-	for (; at != NIL && !SListP(at); at = SCdr(at))
-		;
-	if (at == NIL) return;
-	if ((sf->nsamples = SIndex(at)) <= 0) {
-		sf->nsamples = 0;
+	if (! open_entries(fp))
 		return;
-	}
-
-	sf->sample = (SFSampleInfo*)safe_malloc
-		(sizeof(SFSampleInfo) * sf->nsamples);
-	at = SCar(at);
-	p = sf->sample;
+	sf->nsamples = size = 0;
+	sf->sample = NULL;
 	in_rom = 1;  /* data may start from ROM samples */
-	for (i = 0; i < sf->nsamples; i++) {
-		SList list = SCar(at);
-		list = SCdr(list); /* skip index */
-		strncpy(p->name, SStr(list), 20); list = SCdr(list);
-		p->startsample = SInt(SCar(list));
-		p->endsample = SInt(SCdr(SCar(list))); list = SCdr(list);
-		p->startloop = SInt(SCar(list));
-		p->endloop = SInt(SCdr(SCar(list))); list = SCdr(list);
-		if (list != NIL && sf->version > 1) {
-			list = SCar(list);
-			p->samplerate = SInt(list); list = SCdr(list);
-			p->originalPitch = SInt(list); list = SCdr(list);
-			p->pitchCorrection = SInt(list); list = SCdr(list);
-			p->samplelink = SInt(list); list = SCdr(list);
-			p->sampletype = SInt(list);
+	while ((tok = next_token(fp)) != S_TOKEN_CLOSE && tok != S_TOKEN_EOF) {
+		if (tok != S_TOKEN_OPEN)
+			continue;
+		sf->sample = (SFSampleInfo*)grow_array(sf->sample, &size, sf->nsamples, sizeof(SFSampleInfo));
+		p = &sf->sample[sf->nsamples++];
+		memset(p, 0, sizeof(*p));
+		next_token(fp); /* skip index */
+		if (next_token(fp) == S_TOKEN_STR)
+			strncpy(p->name, cur_val.s, 20);
+		else
+			unget_token();
+		/* (start end) (startloop endloop) */
+		if (next_token(fp) == S_TOKEN_OPEN) {
+			if (read_int(fp, &val)) p->startsample = val;
+			if (read_int(fp, &val)) p->endsample = val;
+			skip_list(fp);
+		} else
+			unget_token();
+		if (next_token(fp) == S_TOKEN_OPEN) {
+			if (read_int(fp, &val)) p->startloop = val;
+			if (read_int(fp, &val)) p->endloop = val;
+			skip_list(fp);
+		} else
+			unget_token();
+		/* (rate pitch correction link type) */
+		if (next_token(fp) == S_TOKEN_OPEN && sf->version > 1) {
+			if (read_int(fp, &val)) p->samplerate = val;
+			if (read_int(fp, &val)) p->originalPitch = val;
+			if (read_int(fp, &val)) p->pitchCorrection = val;
+			if (read_int(fp, &val)) p->samplelink = val;
+			if (read_int(fp, &val)) p->sampletype = val;
+			skip_list(fp);
 		} else {
+			if (cur_token == S_TOKEN_OPEN)
+				skip_list(fp);
+			else
+				unget_token();
 			p->samplerate = 44100;
 			p->originalPitch = 60;
 			p->pitchCorrection = 0;
@@ -270,8 +393,6 @@ static void load_sample(SFInfo *sf, SList at)
 			else
 				p->sampletype = 1;
 		}
-		p++;
-		at = SCdr(at);
+		skip_list(fp);
 	}
-
 }
@@ -34,6 +34,17 @@ void *safe_malloc(int size)
 	return p;
 }
 
+void *safe_realloc(void *buf, int size)
+{
+	void *p;
+	p = realloc(buf, size);
+	if (p == NULL) {
+		fprintf(stderr, "can't realloc buffer for size %d!!\n", size);
+		exit(1);
+	}
+	return p;
+}
+
 void safe_free(void *buf)
 {
 	if (buf)
@@ -0,0 +1,111 @@
+/*================================================================
+ * mkfreqtab -- generate the frequency/note conversion tables
+ *
+ * Copyright (C) 1996-2003 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *================================================================*/
+
+/*
+ * Prints the tables to stdout as freqtab.h.  The values are
+ * calculated with the formulas in freqnote.h, so that the table
+ * lookup gives exactly the same results.  The output is kept in the
+ * source tree, and checkfreq ("make check") compares the tables
+ * with the formulas on the target.
+ *
+ * freq_tab[h] is the lowest frequency in mHz whose cents are h/2
+ * or more, for every half cent up to FREQ_TAB_CENTS.
+ * freq_index[] gives the half cent at the lowest frequency of each
+ * range divided by the top FREQ_INDEX_BITS bits of the frequency,
+ * from which freq_tab is searched.
+ * semitone_tab[n + SEMITONE_MAX] is the ratio of n semitones.
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include "freqnote.h"
+
+#define FREQ_TAB_CENTS	12800	/* key 128 */
+#define FREQ_TAB_SIZE	(FREQ_TAB_CENTS * 2 + 1)
+#define FREQ_INDEX_BITS	9
+#define SEMITONE_MAX	128
+
+static long freq_tab[FREQ_TAB_SIZE];
+
+/* lowest frequency of FREQ_TO_CENT(mHz) >= h/2 */
+static long lowest_freq(int h)
+{
+	long lo = 1, hi = 1L << 30, mid;
+
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (FREQ_TO_CENT(mid) >= h / 2.0)
+			hi = mid;
+		else
+			lo = mid + 1;
+	}
+	return lo;
+}
+
+int main(void)
+{
+	int i, h, shift, min_shift, nindex;
+	long freq;
+
+	for (i = 0; i < FREQ_TAB_SIZE; i++)
+		freq_tab[i] = lowest_freq(i);
+	/* the range of the top bits covering the table */
+	for (min_shift = 0; (freq_tab[0] >> min_shift) >= (2 << FREQ_INDEX_BITS); min_shift++)
+		;
+	for (shift = min_shift; (freq_tab[FREQ_TAB_SIZE - 1] >> shift) >= (2 << FREQ_INDEX_BITS); shift++)
+		;
+	nindex = (shift - min_shift + 1) << FREQ_INDEX_BITS;
+
+	printf("/* generated by mkfreqtab (make update-freqtab); do not edit */\n\n");
+	printf("#define FREQ_TAB_SIZE\t%d\n", FREQ_TAB_SIZE);
+	printf("#define FREQ_INDEX_BITS\t%d\n", FREQ_INDEX_BITS);
+	printf("#define FREQ_INDEX_SHIFT\t%d\n", min_shift);
+	printf("#define SEMITONE_MAX\t%d\n\n", SEMITONE_MAX);
+	printf("/* lowest mHz of each half cent */\n");
+	printf("static const int freq_tab[FREQ_TAB_SIZE] = {");
+	for (i = 0; i < FREQ_TAB_SIZE; i++) {
+		if (i % 8 == 0)
+			printf("\n\t");
+		printf("%ld,", freq_tab[i]);
+	}
+	printf("\n};\n\n");
+	printf("/* half cent at the lowest mHz of each index */\n");
+	printf("static const unsigned short freq_index[%d] = {", nindex);
+	h = 0;
+	for (i = 0; i < nindex; i++) {
+		shift = min_shift + (i >> FREQ_INDEX_BITS);
+		freq = (long)((1 << FREQ_INDEX_BITS) + (i & ((1 << FREQ_INDEX_BITS) - 1))) << shift;
+		while (h < FREQ_TAB_SIZE - 1 && freq_tab[h + 1] <= freq)
+			h++;
+		if (i % 8 == 0)
+			printf("\n\t");
+		printf("%d,", h);
+	}
+	printf("\n};\n\n");
+	printf("/* frequency ratio of -SEMITONE_MAX to SEMITONE_MAX semitones */\n");
+	printf("static const double semitone_tab[SEMITONE_MAX * 2 + 1] = {");
+	for (i = -SEMITONE_MAX; i <= SEMITONE_MAX; i++) {
+		if ((i + SEMITONE_MAX) % 4 == 0)
+			printf("\n\t");
+		printf("%.17g,", SEMITONE_RATIO(i));
+	}
+	printf("\n};\n");
+	return 0;
+}
@@ -0,0 +1,85 @@
+/*================================================================
+ * mkgenhash -- generate the perfect hash table of generator names
+ *
+ * Copyright (C) 1996-1999 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *================================================================*/
+
+/*
+ * Searches the seed of sf_gen_hash() without collisions among
+ * sf_gen_text, and prints the table to stdout as genhash.h.
+ * The table size starts from the smallest power of two larger
+ * than the number of names, and is doubled if no seed is found.
+ * The output is kept in the source tree; see Makefile.am.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "sflayer.h"
+#include "sfgenhash.h"
+
+#define MAX_BITS	12
+#define MAX_SEEDS	100000
+
+static int table[1 << MAX_BITS];
+
+/* try the seed; return 1 if no collision */
+static int try_seed(unsigned int seed, int bits)
+{
+	int i, key;
+
+	memset(table, 0, sizeof(int) << bits);
+	for (i = 0; i < SF_EOF; i++) {
+		key = sf_gen_hash(sf_gen_text[i], seed, bits);
+		if (table[key])
+			return 0;
+		table[key] = i + 1;
+	}
+	return 1;
+}
+
+int main(void)
+{
+	unsigned int seed;
+	int bits, i;
+
+	for (bits = 1; (1 << bits) <= SF_EOF; bits++)
+		;
+	for (; bits <= MAX_BITS; bits++) {
+		/* FNV offset basis at first */
+		seed = 2166136261U;
+		for (i = 0; i < MAX_SEEDS; i++, seed += 0x9e3779b9U) {
+			if (try_seed(seed, bits))
+				goto found;
+		}
+	}
+	fprintf(stderr, "mkgenhash: no perfect hash found\n");
+	return 1;
+
+ found:
+	printf("/* generated by mkgenhash (make update-genhash); do not edit */\n\n");
+	printf("#define GENHASH_SEED\t0x%08xU\n", seed);
+	printf("#define GENHASH_BITS\t%d\n\n", bits);
+	printf("/* generator id + 1; zero = empty */\n");
+	printf("static unsigned char genhash_table[%d] = {", 1 << bits);
+	for (i = 0; i < (1 << bits); i++) {
+		if (i % 16 == 0)
+			printf("\n\t");
+		printf("%d,", table[i]);
+	}
+	printf("\n};\n");
+	return 0;
+}
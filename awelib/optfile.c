@@ -32,22 +32,140 @@
 
 #define DEFAULT_ID	"default"
 
+#define DEFAULT_OPTION_NUM	10
+
+static struct option long_options[40] = {
+	{"addblank", 2, 0, 'B'},
+	{"bank", 2, 0, 'b'},
+	{"chorus", 1, 0, 'c'},
+	{"reverb", 1, 0, 'r'},
+	{"path", 1, 0, 'P'},
+	{"sense", 1, 0, 'A'},
+	{"atten", 1, 0, 'a'},
+	{"decay", 1, 0, 'd'},
+	{"volume", 1, 0, 'V'},
+	{"compat", 2, 0, 'C'},
+};
+#define OPTION_FLAGS	"b:c:r:P:A:a:d:V:BC"
+
+
+/*
+ * The rc file is read only once.  The options of each line are parsed
+ * at that time, and kept as pairs of the option letter and argument.
+ * The lines are hashed by the id (the first word).
+ */
+
+typedef struct OptionRec {
+	int c;
+	char *arg;
+} OptionRec;
+
 typedef struct OptionFile {
-	int argc;
-	char **argv;
-	struct OptionFile *next;
+	char *id;
+	int nopts;
+	OptionRec *opts;
+	struct OptionFile *next;	/* hash chain */
 } OptionFile;
 
-static OptionFile *optlist = NULL;
+#define OPTHASH_SIZE	256
+static OptionFile *opthash[OPTHASH_SIZE];
+static int optfile_read;
 
 #define MAX_ARGC	100
 
+static int get_option(int argc, char **argv, char *optflags,
+		      struct option *long_opts, int *optidx);
+static int apply_option(int c, char *arg);
+
+
+/*
+ * string pool; the parsed records are never freed
+ */
+
+#define POOL_BLOCK	4096
+#define POOL_ALIGN(x)	(((x) + sizeof(void*) - 1) & ~(sizeof(void*) - 1))
+
+static char *pool_cur;
+static int pool_left;
+
+static void *pool_alloc(int size)
+{
+	void *p;
+
+	size = POOL_ALIGN(size);
+	if (size > pool_left) {
+		int bsize = size > POOL_BLOCK ? size : POOL_BLOCK;
+		pool_cur = (char*)safe_malloc(bsize);
+		pool_left = bsize;
+	}
+	p = pool_cur;
+	pool_cur += size;
+	pool_left -= size;
+	return p;
+}
+
+static char *pool_strdup(char *str)
+{
+	int len = strlen(str);
+	char *p = (char*)pool_alloc(len + 1);
+	memcpy(p, str, len + 1);
+	return p;
+}
+
+static unsigned int opthash_key(char *id)
+{
+	unsigned int key = 0;
+	for (; *id; id++)
+		key = key * 31 + (unsigned char)*id;
+	return key % OPTHASH_SIZE;
+}
+
+/* parse the options of a line, and add to the hash table;
+ * the parse stops at the first unknown option.
+ * a word may bundle many options (e.g. -BBBB), so the temporary
+ * array grows with the number of options, not of the words.
+ */
+static OptionRec *line_opts;
+static int line_maxopts;
+
+static void add_option_line(int argc, char **argv)
+{
+	OptionFile *rec;
+	unsigned int key;
+	int c, n, optind_save;
+
+	optind_save = optind;
+	optind = 0;
+	n = 0;
+	while ((c = get_option(argc, argv, 0, 0, 0)) != -1) {
+		if (c == ':' || c == '?' || strchr(OPTION_FLAGS, c) == NULL)
+			break;
+		if (n >= line_maxopts) {
+			line_maxopts = line_maxopts ? line_maxopts * 2 : MAX_ARGC;
+			line_opts = (OptionRec*)safe_realloc(line_opts, sizeof(OptionRec) * line_maxopts);
+		}
+		line_opts[n].c = c;
+		line_opts[n].arg = optarg ? pool_strdup(optarg) : NULL;
+		n++;
+	}
+	optind = optind_save;
+
+	rec = (OptionFile*)pool_alloc(sizeof(OptionFile));
+	rec->id = pool_strdup(argv[0]);
+	rec->nopts = n;
+	rec->opts = (OptionRec*)pool_alloc(sizeof(OptionRec) * n);
+	memcpy(rec->opts, line_opts, sizeof(OptionRec) * n);
+	/* prepended; the later lines are applied first as before */
+	key = opthash_key(rec->id);
+	rec->next = opthash[key];
+	opthash[key] = rec;
+}
+
 static void read_option_file(void)
 {
 	char *p, rcfile[256];
 	char line[256];
 	FILE *fp;
-	OptionFile *rec;
 
 	*rcfile = 0;
 	if ((p = getenv("HOME")) != NULL && *p) {
@@ -65,14 +183,12 @@ static void read_option_file(void)
 #endif
 	}
 
-	optlist = NULL;
-
 	if ((fp = fopen(rcfile, "r")) == NULL)
 		return;
 
 	while (fgets(line, sizeof(line), fp)) {
 		char *argv[MAX_ARGC];
-		int i, argc;
+		int argc;
 		if ((argv[0] = strtok(line, " \t\n")) == NULL) continue;
 		if (*argv[0] == '#') continue; /* skip comments */
 		for (argc = 1; argc < MAX_ARGC; argc++) {
@@ -80,29 +196,25 @@ static void read_option_file(void)
 			if (argv[argc] == NULL)
 				break;
 		}
-		rec = (OptionFile*)safe_malloc(sizeof(OptionFile));
-		rec->argv = (char**)safe_malloc(sizeof(char*) * argc);
-		rec->argc = argc;
-		for (i = 0; i < argc; i++)
-			rec->argv[i] = safe_strdup(argv[i]);
-		rec->next = optlist;
-		optlist = rec;
+		add_option_line(argc, argv);
 	}
 
 	fclose (fp);
+	safe_free(line_opts);
+	line_opts = NULL;
+	line_maxopts = 0;
 }
 
 static void parse_named_option(char *fname)
 {
 	OptionFile *p;
-	for (p = optlist; p; p = p->next) {
-		int optind_save = optind;
-		optind = 0;
-		if (strcmp(p->argv[0], fname) == 0) {
-			while (awe_parse_options(p->argc, p->argv, 0, 0, 0) == 0)
-				;
+	int i;
+
+	for (p = opthash[opthash_key(fname)]; p; p = p->next) {
+		if (strcmp(p->id, fname) == 0) {
+			for (i = 0; i < p->nopts; i++)
+				apply_option(p->opts[i].c, p->opts[i].arg);
 		}
-		optind = optind_save;
 	}
 }
 
@@ -110,16 +222,15 @@ void awe_read_option_file(char *fname)
 {
 	char tmp[256], *base, *ep;
 
-	if (optlist == NULL) {
+	if (! optfile_read) {
 		read_option_file();
-		if (optlist == NULL)
-			return;
+		optfile_read = TRUE;
 	}
 
 	parse_named_option(DEFAULT_ID);
 	if (fname) {
 		strncpy(tmp, fname, sizeof(tmp));
-		fname[sizeof(tmp) - 1] = 0;
+		tmp[sizeof(tmp) - 1] = 0;
 		if ((base = strrchr(tmp, '/')) == NULL)
 			base = tmp; /* no directory path is attached */
 		else
@@ -132,30 +243,41 @@ void awe_read_option_file(char *fname)
 	}
 }
 
-#define DEFAULT_OPTION_NUM	10
 
-static struct option long_options[40] = {
-	{"addblank", 2, 0, 'B'},
-	{"bank", 2, 0, 'b'},
-	{"chorus", 1, 0, 'c'},
-	{"reverb", 1, 0, 'r'},
-	{"path", 1, 0, 'P'},
-	{"sense", 1, 0, 'A'},
-	{"atten", 1, 0, 'a'},
-	{"decay", 1, 0, 'd'},
-	{"volume", 1, 0, 'V'},
-	{"compat", 2, 0, 'C'},
-};
-#define OPTION_FLAGS	"b:c:r:P:A:a:d:V:BC"
-
-#define set_bool()	(optarg ? bool_val(optarg) : TRUE)
+#define set_bool(arg)	((arg) ? bool_val(arg) : TRUE)
 
 int awe_parse_options(int argc, char **argv, char *optflags,
 		      struct option *long_opts, int *optidx)
 {
 	int c;
-	int ival;
-	double dval;
+
+	if ((c = get_option(argc, argv, optflags, long_opts, optidx)) == -1)
+		return -1;
+	return apply_option(c, optarg);
+}
+
+/* skip the common options and the given options without applying;
+ * return the index of the first non-option argument
+ */
+int awe_skip_options(int argc, char **argv, char *optflags,
+		     struct option *long_opts)
+{
+	int idx, optind_saved;
+
+	optind_saved = optind;
+	optind = 0;
+	while (get_option(argc, argv, optflags, long_opts, &idx) != -1)
+		;
+	idx = optind;
+	optind = optind_saved;
+	return idx;
+}
+
+/* call getopt with the common options and the given options */
+static int get_option(int argc, char **argv, char *optflags,
+		      struct option *long_opts, int *optidx)
+{
+	int c;
 	static char options[100];
 
 	if (optflags) {
@@ -176,39 +298,45 @@ int awe_parse_options(int argc, char **argv, char *optflags,
 	}
 	long_options[c].name = 0;
 
-	if ((c = getopt_long(argc, argv, options, long_options, optidx)) == -1)
-		return -1;
+	return getopt_long(argc, argv, options, long_options, optidx);
+}
+
+/* set the common option; return the letter if not a common option */
+static int apply_option(int c, char *arg)
+{
+	int ival;
+	double dval;
 
 	switch (c) {
 	case 'b':
-		ival = atoi(optarg);
+		ival = atoi(arg);
 		if (ival > 127)
 			fprintf(stderr, "awe: illegal bank number %d\n", ival);
 		else
 			awe_option.default_bank = ival;
 		break;
 	case 'B':
-		awe_option.auto_add_blank = set_bool();
+		awe_option.auto_add_blank = set_bool(arg);
 		break;
 	case 'C':
-		awe_option.compatible = set_bool();
+		awe_option.compatible = set_bool(arg);
 		break;
 	case 'V':
-		ival = atoi(optarg);
+		ival = atoi(arg);
 		if (ival < 0 || ival > 100)
 			fprintf(stderr, "awe: illegal default volume value %d\n", ival);
 		else
 			awe_option.default_volume = ival;
 		break;
 	case 'c':
-		ival = atoi(optarg);
+		ival = atoi(arg);
 		if (ival < 0 || ival > 100)
 			fprintf(stderr, "awe: illegal default chorus value %d\n", ival);
 		else
 			awe_option.default_chorus = ival;
 		break;
 	case 'r':
-		ival = atoi(optarg);
+		ival = atoi(arg);
 		if (ival < 0 || ival > 100)
 			fprintf(stderr, "awe: illegal default reverb value %d\n", ival);
 		else
@@ -218,10 +346,10 @@ int awe_parse_options(int argc, char **argv, char *optflags,
 		if (awe_option.search_path)
 			free(awe_option.search_path);
 
-		awe_option.search_path = safe_strdup(optarg);
+		awe_option.search_path = safe_strdup(arg);
 		break;
 	case 'A':
-		dval = atof(optarg);
+		dval = atof(arg);
 		if (dval <= 0)
 			fprintf(stderr, "awe: illegal atten sense parameter %g\n", dval);
 		else {
@@ -230,14 +358,14 @@ int awe_parse_options(int argc, char **argv, char *optflags,
 		}
 		break;
 	case 'a':
-		ival = atoi(optarg);
+		ival = atoi(arg);
 		if (ival < 0 || ival > 255)
 			fprintf(stderr, "awe: illegal attenuation parameter %d\n", ival);
 		else
 			awe_option.default_atten = ival;
 		break;
 	case 'd':
-		awe_option.decay_sense = atof(optarg);
+		awe_option.decay_sense = atof(arg);
 		break;
 
 	default:
@@ -60,7 +60,7 @@ static int load_samples(AWEOps *ops, SFInfo *sf, int layer, LoadList *request, L
 static int sample_loader(AWEOps *ops, SFInfo *sf, LayerTable *tbl, LoadList *request);
 static int load_infos(AWEOps *ops, SFInfo *sf, int layer, LoadList *request, LoadList *exlist);
 static int info_loader(AWEOps *ops, SFInfo *sf, LayerTable *tbl, LoadList *request);
-static void set_sample_info(SFInfo *sf, awe_voice_info *vp, LayerTable *tbl);
+static int set_sample_info(SFInfo *sf, awe_voice_info *vp, LayerTable *tbl);
 static void set_init_info(SFInfo *sf, awe_voice_info *vp, LayerTable *tbl);
 static void set_rootkey(SFInfo *sf, awe_voice_info *vp, LayerTable *tbl);
 static void set_modenv(SFInfo *sf, awe_voice_info *vp, LayerTable *tbl);
@@ -558,7 +558,11 @@ static int info_loader(AWEOps *ops, SFInfo *sf, LayerTable *tbl, LoadList *reque
 {
 	static awe_voice_rec_patch vrec;
 	awe_voice_info *vp = &vrec.info;
-	
+
+	/* check the sample at first not to count the skipped voice */
+	if (set_sample_info(sf, vp, tbl) < 0)
+		return AWE_RET_SKIP;
+
 	/* set voice header */
 	if (request->map.bank > 0 || awe_option.default_bank < 0)
 		vrec.hdr.bank = request->map.bank;
@@ -572,7 +576,6 @@ static int info_loader(AWEOps *ops, SFInfo *sf, LayerTable *tbl, LoadList *reque
 		vrec.hdr.write_mode = AWE_WR_APPEND;
 
 	/* set voice info parameters */
-	set_sample_info(sf, vp, tbl);
 	set_init_info(sf, vp, tbl);
 	set_rootkey(sf, vp, tbl);
 	set_modenv(sf, vp, tbl);
@@ -608,8 +611,8 @@ static int info_loader(AWEOps *ops, SFInfo *sf, LayerTable *tbl, LoadList *reque
 
 /*----------------------------------------------------------------*/
 
-/* set sample address */
-static void set_sample_info(SFInfo *sf, awe_voice_info *vp, LayerTable *tbl)
+/* set sample address; return -1 if the voice can't be played */
+static int set_sample_info(SFInfo *sf, awe_voice_info *vp, LayerTable *tbl)
 {
 	SFSampleInfo *sp;
 
@@ -641,10 +644,14 @@ static void set_sample_info(SFInfo *sf, awe_voice_info *vp, LayerTable *tbl)
 			vp->loopstart = sp->endsample + 8 - sp->startloop;
 			vp->loopend = sp->endsample + sp->loopshot - 8 - sp->endloop;
 		} else {
-			fprintf(stderr, "loop size is too short: %d\n", sp->loopshot);
-			exit(1);
+			/* skip this voice instead of aborting */
+			if (awe_verbose)
+				fprintf(stderr, "awe: loop size is too short: %d (sample %d)\n",
+					sp->loopshot, vp->sample);
+			return -1;
 		}
 	}
+	return 0;
 }
 
 /*----------------------------------------------------------------*/
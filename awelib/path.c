@@ -19,11 +19,156 @@
  *----------------------------------------------------------------*/
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <unistd.h>
 #include <string.h>
+#include <dirent.h>
 #include <sys/fcntl.h>
 #include "util.h"
 
+/*----------------------------------------------------------------
+ * directory cache
+ *----------------------------------------------------------------
+ * Each directory in the search path is read once via readdir, and
+ * the sorted list of the file names is kept until the cache is
+ * cleared.  The file found in the list is checked by access() once
+ * for its permission.  A name including a directory path, or a
+ * directory which can't be read, is checked by access() as before.
+ *----------------------------------------------------------------*/
+
+typedef struct _DirCache {
+	char *dir;		/* directory name ("" = current directory) */
+	int nfiles;		/* number of files; -1 = not readable */
+	char **files;		/* sorted file names */
+	struct _DirCache *next;
+} DirCache;
+
+static DirCache *dir_cache;
+
+/* parsed search path list */
+static char *path_list;
+static char *path_buf;		/* split strings of path_list */
+static char **path_dirs;
+static int path_ndirs;
+
+static int compare_name(const void *a, const void *b)
+{
+	return strcmp(*(char**)a, *(char**)b);
+}
+
+/* read the file names in the directory */
+static DirCache *read_dir_cache(char *dir)
+{
+	DirCache *dc;
+	DIR *d;
+	struct dirent *ent;
+	int size;
+
+	dc = (DirCache*)safe_malloc(sizeof(DirCache));
+	dc->dir = safe_strdup(dir);
+	dc->next = dir_cache;
+	dir_cache = dc;
+
+	if ((d = opendir(*dir ? dir : ".")) == NULL) {
+		dc->nfiles = -1;
+		return dc;
+	}
+	size = 0;
+	while ((ent = readdir(d)) != NULL) {
+		if (ent->d_name[0] == '.' &&
+		    (! ent->d_name[1] || (ent->d_name[1] == '.' && ! ent->d_name[2])))
+			continue;
+		if (dc->nfiles >= size) {
+			char **files;
+			size = size ? size * 2 : 64;
+			files = (char**)safe_malloc(sizeof(char*) * size);
+			if (dc->files) {
+				memcpy(files, dc->files, sizeof(char*) * dc->nfiles);
+				safe_free(dc->files);
+			}
+			dc->files = files;
+		}
+		dc->files[dc->nfiles++] = safe_strdup(ent->d_name);
+	}
+	closedir(d);
+	if (dc->nfiles > 1)
+		qsort(dc->files, dc->nfiles, sizeof(char*), compare_name);
+	DEBUG(2,fprintf(stderr, "cached %d files in %s\n", dc->nfiles, *dir ? dir : "."));
+	return dc;
+}
+
+static DirCache *get_dir_cache(char *dir)
+{
+	DirCache *dc;
+	for (dc = dir_cache; dc; dc = dc->next) {
+		if (strcmp(dc->dir, dir) == 0)
+			return dc;
+	}
+	return read_dir_cache(dir);
+}
+
+static int find_dir_cache(DirCache *dc, char *name)
+{
+	return bsearch(&name, dc->files, dc->nfiles, sizeof(char*),
+		       compare_name) != NULL;
+}
+
+/* split the search path list */
+static void set_path_list(char *pathlist)
+{
+	char *tok, *path;
+	int size;
+
+	if (path_list && strcmp(path_list, pathlist) == 0)
+		return;
+	if (path_list) {
+		safe_free(path_list);
+		safe_free(path_buf);
+		safe_free(path_dirs);
+	}
+	path_list = safe_strdup(pathlist);
+	path_buf = path = safe_strdup(pathlist);
+	size = 1;
+	for (tok = path; *tok; tok++) {
+		if (*tok == ':')
+			size++;
+	}
+	path_dirs = (char**)safe_malloc(sizeof(char*) * size);
+	path_ndirs = 0;
+	for (tok = strtok(path, ":"); tok; tok = strtok(NULL, ":"))
+		path_dirs[path_ndirs++] = tok;
+}
+
+/* release all cached directories and path list */
+void awe_clear_path_cache(void)
+{
+	DirCache *dc, *next;
+	int i;
+
+	for (dc = dir_cache; dc; dc = next) {
+		next = dc->next;
+		for (i = 0; i < dc->nfiles; i++)
+			safe_free(dc->files[i]);
+		if (dc->files)
+			safe_free(dc->files);
+		safe_free(dc->dir);
+		safe_free(dc);
+	}
+	dir_cache = NULL;
+	if (path_list) {
+		safe_free(path_list);
+		safe_free(path_buf);
+		safe_free(path_dirs);
+		path_list = NULL;
+		path_buf = NULL;
+		path_dirs = NULL;
+		path_ndirs = 0;
+	}
+}
+
+
+/*----------------------------------------------------------------*/
+
 static int file_exists(char *path, char **ext)
 {
 	char *lastp;
@@ -40,32 +185,69 @@ static int file_exists(char *path, char **ext)
 	return 0;
 }
 
+/* search the file in the directory; fresult contains dir + fname */
+static int file_exists_in_dir(char *fresult, int maxlen, char *dir, char *fname, char **ext)
+{
+	DirCache *dc;
+	char name[256];
+	int len;
+
+	if (! *fname || strchr(fname, '/') != NULL)
+		return file_exists(fresult, ext);
+	dc = get_dir_cache(dir);
+	if (dc->nfiles < 0)
+		return file_exists(fresult, ext);
+
+	len = strlen(fname);
+	if (find_dir_cache(dc, fname) && access(fresult, R_OK) == 0)
+		return 1;
+	if (ext == NULL) return 0;
+	strcpy(name, fname);
+	for (; *ext; ext++) {
+		if (len + strlen(*ext) >= sizeof(name) ||
+		    strlen(fresult) + strlen(*ext) >= maxlen)
+			continue;
+		strcpy(name + len, *ext);
+		if (find_dir_cache(dc, name)) {
+			char *lastp = fresult + strlen(fresult);
+			strcpy(lastp, *ext);
+			if (access(fresult, R_OK) == 0)
+				return 1;
+			*lastp = 0;
+		}
+	}
+	return 0;
+}
+
 int awe_search_file_name(char *fresult, int maxlen, char *fname, char *pathlist, char **ext)
 {
-	char *tok;
-	char *path;
+	char *dir;
+	int i;
 
 	if (strlen(fname) >= maxlen)
 		return 0;
 	/* search the current path at first */
 	strcpy(fresult, fname);
-	if (file_exists(fresult, ext))
+	if (fname[0] == '/') {
+		if (file_exists(fresult, ext))
+			return 1;
+		return 0;
+	}
+	if (file_exists_in_dir(fresult, maxlen, "", fname, ext))
 		return 1;
 
 	/* then search along path list */
-	if (fname[0] != '/' && pathlist && *pathlist) {
-		path = safe_strdup(pathlist);
-		for (tok = strtok(path, ":"); tok; tok = strtok(NULL, ":")) {
-			if (*tok && tok[strlen(tok)-1] != '/')
-				snprintf(fresult, maxlen, "%s/%s", tok, fname);
+	if (pathlist && *pathlist) {
+		set_path_list(pathlist);
+		for (i = 0; i < path_ndirs; i++) {
+			dir = path_dirs[i];
+			if (*dir && dir[strlen(dir)-1] != '/')
+				snprintf(fresult, maxlen, "%s/%s", dir, fname);
 			else
-				snprintf(fresult, maxlen, "%s%s", tok, fname);
-			if (file_exists(fresult, ext)) {
-				safe_free(path);
+				snprintf(fresult, maxlen, "%s%s", dir, fname);
+			if (file_exists_in_dir(fresult, maxlen, dir, fname, ext))
 				return 1;
-			}
 		}
 	}
 	return 0;
 }
-
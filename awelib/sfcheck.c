@@ -0,0 +1,489 @@
+/*================================================================
+ * sfcheck.c:
+ *	check the structure of SoundFont file before loading
+ *
+ * Copyright (C) 1996-2003 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *================================================================*/
+
+/*
+ * awe_load_soundfont() trusts the chunk sizes and the indices in the
+ * file.  The checker reads the file once from the head, and verifies
+ * everything the loader and parsesf.c rely on: the chunk sizes within
+ * the parent and the file, the record sizes, the bag and generator
+ * indices, the generator ids, and the instrument and sample indices.
+ * The sample data is skipped.  Since all indices are 16bit in the
+ * file, each table can't exceed 65536 records.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include "sffile.h"
+#include "sflayer.h"
+#include "util.h"
+
+#define MAX_RECORDS	65536
+#define MAX_NAME_LEN	256	/* INAM size limit in SF2 spec */
+
+/* pdta tables */
+enum { T_PHDR, T_PBAG, T_PGEN, T_INST, T_IBAG, T_IGEN, T_SHDR, T_NUMS };
+
+typedef struct _CheckRec {
+	FILE *fp;
+	int verbose;
+	int errors, warnings;
+	long pos;		/* current file position */
+	long fsize;		/* file size; -1 = unknown */
+	int version;		/* 0 = not found yet */
+	int has_name;		/* INAM is found */
+	long smplsize;		/* sample data size in words */
+	int ninsts, nsamples;	/* without terminators */
+	unsigned char *tbl[T_NUMS];
+	int nrecs[T_NUMS];
+} CheckRec;
+
+static char *table_id[T_NUMS] = {
+	"phdr", "pbag", "pgen", "inst", "ibag", "igen", "shdr",
+};
+
+static void error(CheckRec *rec, char *fmt, ...);
+static void warning(CheckRec *rec, char *fmt, ...);
+static int read_data(CheckRec *rec, void *buf, long size);
+static int skip_data(CheckRec *rec, long size);
+static int check_list(CheckRec *rec, unsigned char *id, long size);
+static int check_info(CheckRec *rec, char *id, long size);
+static int check_sdta(CheckRec *rec, char *id, long size);
+static int check_pdta(CheckRec *rec, char *id, long size);
+static void check_tables(CheckRec *rec);
+static void check_hdrs(CheckRec *rec, int hdr, int recsize, int bagofs,
+		       int bag, int gen);
+static void check_samples(CheckRec *rec);
+
+/* sample offsets (in words) must be less than this */
+#define MAX_OFFSET	0x3fffffffL
+
+#define WORD(p)		((p)[0] | ((p)[1] << 8))
+#define DWORD(p)	((long)((p)[0] | ((p)[1] << 8) | ((p)[2] << 16) | \
+				((unsigned long)(p)[3] << 24)))
+
+
+/*================================================================
+ * check the soundfont file from the current position
+ *----------------------------------------------------------------
+ * verbose = 0: quiet, 1: print errors, 2: print warnings, too
+ * return the number of errors; the fonts with errors must not be
+ * passed to awe_load_soundfont().
+ *================================================================*/
+
+int awe_check_soundfont(FILE *fp, int verbose)
+{
+	CheckRec rec;
+	unsigned char hdr[12];
+	struct stat st;
+	long riffend;
+	int i;
+
+	memset(&rec, 0, sizeof(rec));
+	rec.fp = fp;
+	rec.verbose = verbose;
+	rec.fsize = -1;
+	if (fstat(fileno(fp), &st) == 0 && S_ISREG(st.st_mode)) {
+		rec.pos = ftell(fp);
+		rec.fsize = st.st_size;
+	}
+
+	if (read_data(&rec, hdr, 12) < 0)
+		return rec.errors;
+	if (memcmp(hdr, "RIFF", 4) != 0 || memcmp(hdr + 8, "sfbk", 4) != 0) {
+		error(&rec, "not a SoundFont file");
+		return rec.errors;
+	}
+	riffend = rec.pos - 4 + DWORD(hdr + 4);
+	if (DWORD(hdr + 4) < 4 || (rec.fsize >= 0 && riffend > rec.fsize)) {
+		error(&rec, "illegal RIFF size %ld", DWORD(hdr + 4));
+		return rec.errors;
+	}
+
+	while (rec.pos < riffend) {
+		long size;
+		if (riffend - rec.pos < 8) {
+			error(&rec, "broken chunk at %ld", rec.pos);
+			break;
+		}
+		if (read_data(&rec, hdr, 8) < 0)
+			break;
+		size = DWORD(hdr + 4);
+		if (size < 0 || size > riffend - rec.pos) {
+			error(&rec, "illegal size of %4.4s: %ld", hdr, size);
+			break;
+		}
+		if (memcmp(hdr, "LIST", 4) != 0) {
+			/* skipped by the loader */
+			warning(&rec, "unknown chunk %4.4s", hdr);
+			if (skip_data(&rec, size) < 0)
+				break;
+			continue;
+		}
+		if (size < 4) {
+			error(&rec, "illegal size of LIST: %ld", size);
+			break;
+		}
+		if (read_data(&rec, hdr + 8, 4) < 0 ||
+		    check_list(&rec, hdr + 8, size - 4) < 0)
+			break;
+	}
+
+	if (rec.errors == 0)
+		check_tables(&rec);
+	for (i = 0; i < T_NUMS; i++)
+		safe_free(rec.tbl[i]);
+	return rec.errors;
+}
+
+
+/*----------------------------------------------------------------
+ * messages
+ *----------------------------------------------------------------*/
+
+static void error(CheckRec *rec, char *fmt, ...)
+{
+	va_list ap;
+	rec->errors++;
+	if (rec->verbose < 1)
+		return;
+	fprintf(stderr, "*** ");
+	va_start(ap, fmt);
+	vfprintf(stderr, fmt, ap);
+	va_end(ap);
+	fputc('\n', stderr);
+}
+
+static void warning(CheckRec *rec, char *fmt, ...)
+{
+	va_list ap;
+	rec->warnings++;
+	if (rec->verbose < 2)
+		return;
+	fprintf(stderr, "warning: ");
+	va_start(ap, fmt);
+	vfprintf(stderr, fmt, ap);
+	va_end(ap);
+	fputc('\n', stderr);
+}
+
+
+/*----------------------------------------------------------------
+ * read and skip
+ *----------------------------------------------------------------*/
+
+static int read_data(CheckRec *rec, void *buf, long size)
+{
+	if (fread(buf, 1, size, rec->fp) != (size_t)size) {
+		error(rec, "unexpected end of file at %ld", rec->pos);
+		return -1;
+	}
+	rec->pos += size;
+	return 0;
+}
+
+static int skip_data(CheckRec *rec, long size)
+{
+	char tmp[4096];
+	long len;
+
+	if (rec->fsize >= 0) {
+		/* the size was already checked with the file size */
+		if (fseek(rec->fp, size, SEEK_CUR) < 0) {
+			error(rec, "can't seek to %ld", rec->pos + size);
+			return -1;
+		}
+		rec->pos += size;
+		return 0;
+	}
+	while (size > 0) {
+		len = size < (long)sizeof(tmp) ? size : (long)sizeof(tmp);
+		if (read_data(rec, tmp, len) < 0)
+			return -1;
+		size -= len;
+	}
+	return 0;
+}
+
+
+/*----------------------------------------------------------------
+ * check the sub chunks in a list
+ *----------------------------------------------------------------*/
+
+static int check_list(CheckRec *rec, unsigned char *id, long size)
+{
+	unsigned char hdr[8];
+	char cid[4];
+	long listend, csize;
+	int (*check)(CheckRec *rec, char *id, long size);
+
+	if (memcmp(id, "INFO", 4) == 0)
+		check = check_info;
+	else if (memcmp(id, "sdta", 4) == 0)
+		check = check_sdta;
+	else if (memcmp(id, "pdta", 4) == 0)
+		check = check_pdta;
+	else {
+		warning(rec, "unknown list %4.4s", id);
+		return skip_data(rec, size);
+	}
+
+	listend = rec->pos + size;
+	while (rec->pos < listend) {
+		if (listend - rec->pos < 8) {
+			error(rec, "broken sub chunk in %4.4s", id);
+			return -1;
+		}
+		if (read_data(rec, hdr, 8) < 0)
+			return -1;
+		memcpy(cid, hdr, 4);
+		csize = DWORD(hdr + 4);
+		if (csize < 0 || csize > listend - rec->pos) {
+			error(rec, "illegal size of %4.4s: %ld", cid, csize);
+			return -1;
+		}
+		if (check(rec, cid, csize) < 0)
+			return -1;
+	}
+	return 0;
+}
+
+/* INFO list */
+static int check_info(CheckRec *rec, char *id, long size)
+{
+	unsigned char buf[4];
+
+	if (memcmp(id, "ifil", 4) == 0) {
+		if (size != 4) {
+			error(rec, "illegal size of ifil: %ld", size);
+			return -1;
+		}
+		if (read_data(rec, buf, 4) < 0)
+			return -1;
+		rec->version = WORD(buf);
+		if (rec->version != 1 && rec->version != 2) {
+			error(rec, "unsupported version %d", rec->version);
+			return -1;
+		}
+		return 0;
+	}
+	if (memcmp(id, "INAM", 4) == 0) {
+		if (size > MAX_NAME_LEN) {
+			error(rec, "too long INAM: %ld", size);
+			return -1;
+		}
+		rec->has_name = 1;
+	}
+	return skip_data(rec, size);
+}
+
+/* sdta list */
+static int check_sdta(CheckRec *rec, char *id, long size)
+{
+	if (memcmp(id, "smpl", 4) == 0)
+		rec->smplsize = size / 2;
+	return skip_data(rec, size);
+}
+
+/* pdta list; read the tables on memory */
+static int check_pdta(CheckRec *rec, char *id, long size)
+{
+	static int recsize[T_NUMS] = { 38, 4, 4, 22, 4, 4, 46 };
+	int i, rsize;
+
+	for (i = 0; i < T_NUMS; i++) {
+		if (memcmp(id, table_id[i], 4) == 0)
+			break;
+	}
+	if (i >= T_NUMS)
+		return skip_data(rec, size); /* pmod, imod */
+
+	if (rec->version == 0) {
+		error(rec, "no version before pdta");
+		return -1;
+	}
+	rsize = recsize[i];
+	if (i == T_SHDR && rec->version == 1)
+		rsize = 16;
+	if (rec->tbl[i]) {
+		error(rec, "duplicated %s", table_id[i]);
+		return -1;
+	}
+	if (size % rsize)
+		warning(rec, "%s size %ld is not aligned", table_id[i], size);
+	rec->nrecs[i] = size / rsize;
+	if (rec->nrecs[i] < 1 || rec->nrecs[i] > MAX_RECORDS) {
+		error(rec, "illegal number of %s: %d", table_id[i], rec->nrecs[i]);
+		return -1;
+	}
+	rec->tbl[i] = (unsigned char*)safe_malloc(size);
+	return read_data(rec, rec->tbl[i], size);
+}
+
+
+/*----------------------------------------------------------------
+ * check the indices in the tables
+ *----------------------------------------------------------------*/
+
+static void check_tables(CheckRec *rec)
+{
+	int i;
+
+	for (i = 0; i < T_NUMS; i++) {
+		if (rec->tbl[i] == NULL) {
+			error(rec, "no %s chunk", table_id[i]);
+			return;
+		}
+	}
+	if (! rec->has_name) {
+		/* mandatory; the loader makes the unique name from it */
+		error(rec, "no INAM chunk");
+		return;
+	}
+
+	/* the last records are the terminators */
+	rec->ninsts = rec->nrecs[T_INST] - 1;
+	rec->nsamples = rec->nrecs[T_SHDR];
+	if (rec->version > 1)
+		rec->nsamples--;
+	check_hdrs(rec, T_PHDR, 38, 24, T_PBAG, T_PGEN);
+	check_hdrs(rec, T_INST, 22, 20, T_IBAG, T_IGEN);
+	check_samples(rec);
+}
+
+/* check the bag indices of headers (at bagofs in each record), the
+ * generator indices of bags, and the generators.  the instrument and
+ * sample ids are checked in both levels, since parsesf.c merges them.
+ */
+static void check_hdrs(CheckRec *rec, int hdr, int recsize, int bagofs,
+		       int bag, int gen)
+{
+	int i, idx, prev, nhdrs, nbags, ngens, amount;
+	unsigned char *p;
+
+	nhdrs = rec->nrecs[hdr];
+	nbags = rec->nrecs[bag];
+	ngens = rec->nrecs[gen];
+
+	/* bag indices; the terminator points the last bag */
+	prev = 0;
+	for (i = 0, p = rec->tbl[hdr]; i < nhdrs; i++, p += recsize) {
+		idx = WORD(p + bagofs);
+		if (idx < prev || idx >= nbags) {
+			error(rec, "%s %d: illegal bag index %d",
+			      table_id[hdr], i, idx);
+			return;
+		}
+		prev = idx;
+	}
+
+	/* generator indices; the last bag points the end */
+	prev = 0;
+	for (i = 0, p = rec->tbl[bag]; i < nbags; i++, p += 4) {
+		idx = WORD(p);
+		if (idx < prev || idx > ngens) {
+			error(rec, "%s %d: illegal generator index %d",
+			      table_id[bag], i, idx);
+			return;
+		}
+		prev = idx;
+	}
+
+	/* generators */
+	for (i = 0, p = rec->tbl[gen]; i < ngens; i++, p += 4) {
+		idx = WORD(p);
+		if (idx >= SF_EOF) {
+			error(rec, "%s %d: unknown generator %d",
+			      table_id[gen], i, idx);
+			continue;
+		}
+		amount = WORD(p + 2);
+		if ((idx == SF_instrument && amount >= rec->ninsts) ||
+		    (idx == SF_sampleId && amount >= rec->nsamples))
+			error(rec, "%s %d: illegal %s %d",
+			      table_id[gen], i, sf_gen_text[idx], amount);
+	}
+}
+
+/* check the sample positions; ROM samples are not checked */
+static void check_samples(CheckRec *rec)
+{
+	int i, nsamples, nrecs, rsize, type, shot, in_rom;
+	long start, end, loopstart, loopend, next;
+	unsigned char *p;
+
+	nsamples = rec->nsamples;
+	rsize = rec->version == 1 ? 16 : 46;
+	in_rom = 1;	/* SBK may begin with ROM samples (see sffile.c) */
+	/* the terminator is read by the loader, too */
+	nrecs = rec->nrecs[T_SHDR];
+	for (i = 0, p = rec->tbl[T_SHDR]; i < nrecs; i++, p += rsize) {
+		unsigned char *q = rec->version == 1 ? p : p + 20;
+		start = DWORD(q);
+		end = DWORD(q + 4);
+		loopstart = DWORD(q + 8);
+		loopend = DWORD(q + 12);
+		if (rec->version == 1) {
+			if (start == 0)
+				in_rom = 0;
+			type = in_rom ? 0x8001 : 1;
+		} else
+			type = WORD(q + 24);
+		/* the loader calculates the differences of the offsets
+		 * in int, even for ROM samples and the terminator
+		 */
+		if (start < 0 || end < 0 || loopstart < 0 || loopend < 0 ||
+		    start > MAX_OFFSET || end > MAX_OFFSET ||
+		    loopstart > MAX_OFFSET || loopend > MAX_OFFSET) {
+			error(rec, "sample %d: illegal offset", i);
+			continue;
+		}
+		if (i >= nsamples)
+			continue;
+		if (type & 0x8000) {
+			if (end < start)
+				error(rec, "sample %d: illegal range %ld-%ld",
+				      i, start, end);
+			continue;
+		}
+		if (end < start || end > rec->smplsize) {
+			error(rec, "sample %d: illegal range %ld-%ld",
+			      i, start, end);
+			continue;
+		}
+		if (loopstart < start || loopend > end || loopstart > loopend)
+			warning(rec, "sample %d: loop %ld-%ld is out of range",
+				i, loopstart, loopend);
+		/* parsesf.c puts a blank loop after the sample for one-shot
+		 * play; it needs a gap of more than 8 words
+		 */
+		if (i < nsamples - 1) {
+			next = DWORD(q + rsize);
+			shot = next - end;
+			if (shot >= 0 && shot <= 8)
+				warning(rec, "sample %d: too short gap %d for one-shot",
+					i, shot);
+		}
+	}
+}
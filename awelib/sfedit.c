@@ -0,0 +1,275 @@
+/*================================================================
+ * sfedit.c:
+ *	edit soundfont information on memory
+ *
+ * Copyright (C) 1996-2000 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *================================================================*/
+
+/*
+ * The soundfont loaded by awe_load_soundfont() (or awe_load_textinfo())
+ * is modified directly, and saved via awe_save_soundfont().  The order
+ * of generators is kept as required by SF2 spec: keyRange comes first,
+ * velRange next, and instrument or sampleId at last.
+ * The last preset and instrument are the terminators (EOP and EOI),
+ * and never changed.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include "util.h"
+#include "sffile.h"
+#include "sflayer.h"
+
+/*----------------------------------------------------------------
+ * prototypes
+ *----------------------------------------------------------------*/
+
+static int gen_position(SFGenLayer *lay, int oper);
+
+
+/*----------------------------------------------------------------
+ * search a preset; return the index or -1 if not found
+ *----------------------------------------------------------------*/
+
+int awe_sf_find_preset(SFInfo *sf, int bank, int preset)
+{
+	int i;
+	for (i = 0; i < sf->npresets - 1; i++) {
+		if (sf->preset[i].bank == bank && sf->preset[i].preset == preset)
+			return i;
+	}
+	return -1;
+}
+
+/*----------------------------------------------------------------
+ * search an instrument by name; return the index or -1
+ *----------------------------------------------------------------*/
+
+int awe_sf_find_inst(SFInfo *sf, char *name)
+{
+	int i;
+	for (i = 0; i < sf->ninsts - 1; i++) {
+		if (strncmp(sf->inst[i].hdr.name, name, 20) == 0)
+			return i;
+	}
+	return -1;
+}
+
+
+/*----------------------------------------------------------------
+ * generators in a layer
+ *----------------------------------------------------------------*/
+
+/* return the generator record, or NULL if not defined */
+SFGenRec *awe_sf_get_gen(SFGenLayer *lay, int oper)
+{
+	int i;
+	for (i = 0; i < lay->nlists; i++) {
+		if (lay->list[i].oper == oper)
+			return &lay->list[i];
+	}
+	return NULL;
+}
+
+/* set the generator value; added if not defined yet.
+ * return 0 if successful, or -1 if the generator is invalid.
+ */
+int awe_sf_set_gen(SFGenLayer *lay, int oper, int amount)
+{
+	SFGenRec *gen;
+	int pos;
+
+	if (oper < 0 || oper >= SF_EOF)
+		return -1;
+	if ((gen = awe_sf_get_gen(lay, oper)) != NULL) {
+		gen->amount = amount;
+		return 0;
+	}
+
+	pos = gen_position(lay, oper);
+	if (lay->list == NULL)
+		lay->list = (SFGenRec*)safe_malloc(sizeof(SFGenRec));
+	else
+		lay->list = (SFGenRec*)safe_realloc(lay->list, sizeof(SFGenRec) * (lay->nlists + 1));
+	memmove(lay->list + pos + 1, lay->list + pos,
+		sizeof(SFGenRec) * (lay->nlists - pos));
+	lay->list[pos].oper = oper;
+	lay->list[pos].amount = amount;
+	lay->nlists++;
+	return 0;
+}
+
+/* remove the generator; return 1 if removed, 0 if not defined */
+int awe_sf_remove_gen(SFGenLayer *lay, int oper)
+{
+	SFGenRec *gen;
+	int pos;
+
+	if ((gen = awe_sf_get_gen(lay, oper)) == NULL)
+		return 0;
+	pos = gen - lay->list;
+	memmove(lay->list + pos, lay->list + pos + 1,
+		sizeof(SFGenRec) * (lay->nlists - pos - 1));
+	lay->nlists--;
+	return 1;
+}
+
+/* position to insert a new generator */
+static int gen_position(SFGenLayer *lay, int oper)
+{
+	int pos;
+
+	switch (oper) {
+	case SF_keyRange:
+		return 0;
+	case SF_velRange:
+		if (lay->nlists > 0 && lay->list[0].oper == SF_keyRange)
+			return 1;
+		return 0;
+	case SF_instrument:
+	case SF_sampleId:
+		return lay->nlists;
+	}
+	pos = lay->nlists;
+	if (pos > 0 && (lay->list[pos - 1].oper == SF_instrument ||
+			lay->list[pos - 1].oper == SF_sampleId))
+		pos--;
+	return pos;
+}
+
+
+/*----------------------------------------------------------------
+ * generators in all layers of a preset or an instrument;
+ * return the number of changed layers
+ *----------------------------------------------------------------*/
+
+int awe_sf_set_hdr_gen(SFHeader *hdr, int oper, int amount)
+{
+	int i, n = 0;
+	for (i = 0; i < hdr->nlayers; i++) {
+		if (awe_sf_set_gen(&hdr->layer[i], oper, amount) == 0)
+			n++;
+	}
+	return n;
+}
+
+int awe_sf_remove_hdr_gen(SFHeader *hdr, int oper)
+{
+	int i, n = 0;
+	for (i = 0; i < hdr->nlayers; i++)
+		n += awe_sf_remove_gen(&hdr->layer[i], oper);
+	return n;
+}
+
+
+/*----------------------------------------------------------------
+ * names and numbers
+ *----------------------------------------------------------------*/
+
+/* rename a preset or an instrument (up to 20 letters) */
+void awe_sf_rename(SFHeader *hdr, char *name)
+{
+	strncpy(hdr->name, name, 20);
+}
+
+/* change the soundfont name; the INAM chunk is enlarged when saved
+ * if the name is longer.  return -1 if the name is too long.
+ */
+int awe_sf_set_font_name(SFInfo *sf, char *name)
+{
+	if (strlen(name) >= SF_NAME_MAX)
+		return -1;
+	safe_free(sf->sf_name);
+	sf->sf_name = safe_strdup(name);
+	return 0;
+}
+
+/* change bank and preset numbers of the matching presets;
+ * -1 matches with any number.  return the number of changed presets.
+ */
+int awe_sf_remap_preset(SFInfo *sf, int bank, int preset, int newbank, int newpreset)
+{
+	int i, n = 0;
+	SFPresetHdr *p;
+
+	for (i = 0, p = sf->preset; i < sf->npresets - 1; i++, p++) {
+		if (bank >= 0 && p->bank != bank)
+			continue;
+		if (preset >= 0 && p->preset != preset)
+			continue;
+		if (newbank >= 0)
+			p->bank = newbank;
+		if (newpreset >= 0)
+			p->preset = newpreset;
+		n++;
+	}
+	return n;
+}
+
+
+/*----------------------------------------------------------------
+ * save the soundfont to a file
+ *----------------------------------------------------------------
+ * orig = the original soundfont file (for INFO and sample data)
+ * outfile = output file name; NULL = overwrite the original
+ * The data is written in a temporary file at first, and renamed
+ * to the output file.  return 0 if successful, or -1 on error.
+ *----------------------------------------------------------------*/
+
+int awe_sf_save_file(SFInfo *sf, char *orig, char *outfile)
+{
+	FILE *fin, *fout;
+	struct stat st;
+	char *tmpname;
+	int fd, rc;
+
+	if (outfile == NULL)
+		outfile = orig;
+	if ((fin = fopen(orig, "r")) == NULL) {
+		fprintf(stderr, "can't open soundfont %s\n", orig);
+		return -1;
+	}
+	tmpname = (char*)safe_malloc(strlen(outfile) + 8);
+	sprintf(tmpname, "%s.XXXXXX", outfile);
+	if ((fd = mkstemp(tmpname)) < 0) {
+		fprintf(stderr, "can't create file %s: %s\n", tmpname, strerror(errno));
+		fclose(fin);
+		safe_free(tmpname);
+		return -1;
+	}
+	/* keep the permission of the replaced file */
+	if (stat(outfile, &st) == 0 || fstat(fileno(fin), &st) == 0)
+		fchmod(fd, st.st_mode & 0777);
+	fout = fdopen(fd, "w");
+
+	rc = awe_save_soundfont(sf, fin, fout);
+	fclose(fin);
+	if (fclose(fout) != 0)
+		rc = -1;
+	if (rc == 0 && rename(tmpname, outfile) < 0) {
+		fprintf(stderr, "can't rename to %s: %s\n", outfile, strerror(errno));
+		rc = -1;
+	}
+	if (rc < 0)
+		unlink(tmpname);
+	safe_free(tmpname);
+	return rc;
+}
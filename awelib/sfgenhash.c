@@ -0,0 +1,39 @@
+/*================================================================
+ * sfgenhash.c:
+ *	hash function for generator names
+ *
+ * Copyright (C) 1996-1999 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *================================================================*/
+
+/*
+ * This is shared by the library and mkgenhash, so that the table made
+ * by mkgenhash matches with the lookup.
+ */
+
+#include "sfgenhash.h"
+
+unsigned int sf_gen_hash(const char *str, unsigned int seed, int bits)
+{
+	const unsigned char *p = (const unsigned char *)str;
+	unsigned int h = seed;
+
+	while (*p) {
+		h ^= *p++;
+		h *= 16777619U;
+	}
+	return (h >> (32 - bits)) & ((1U << bits) - 1);
+}
@@ -19,29 +19,54 @@
  * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
  *----------------------------------------------------------------*/
 
+#define _GNU_SOURCE	/* copy_file_range */
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <unistd.h>
+#include <errno.h>
 #include "util.h"
 #include "sffile.h"
 #include "config.h"
+/* only the Linux sendfile() in sys/sendfile.h; the BSD one has
+ * a different signature
+ */
+#if defined(HAVE_SENDFILE) && defined(HAVE_SYS_SENDFILE_H)
+#include <sys/sendfile.h>
+#define USE_SENDFILE
+#endif
 
 /*----------------------------------------------------------------
  * prototypes
  *----------------------------------------------------------------*/
 
-static void write_header(SFInfo *sf, FILE *fin, FILE *fout);
-static void write_info(SFInfo *sf, FILE *fin, FILE *fout);
-static void write_sdta(SFInfo *sf, FILE *fin, FILE *fout);
-static int calc_pdta_size(SFInfo *sf);
-static void write_pdta(SFInfo *sf, FILE *fin, FILE *fout);
-static void copy_file(int size, FILE *fin, FILE *fout);
+/* growable output buffer; the data is stored in little endian */
+typedef struct _SFBuf {
+	unsigned char *buf;
+	int len, size;
+} SFBuf;
+
+static void write_header(SFInfo *sf, int info_size, int pdta_size, FILE *fout);
+static int name_chunk_size(SFInfo *sf, int orig_size);
+static int get_info_size(SFInfo *sf, FILE *fin);
+static int write_info(SFInfo *sf, int info_size, FILE *fin, FILE *fout);
+static int write_sdta(SFInfo *sf, FILE *fin, FILE *fout);
+static void make_pdta(SFInfo *sf, SFBuf *pdta);
+static void put_layers(SFHeader *hdr, SFBuf *bag, SFBuf *gen);
+static void buf_reserve(SFBuf *p, int len);
+static void put_word(SFBuf *p, int val);
+static void put_dword(SFBuf *p, int32 val);
+static void put_data(SFBuf *p, void *data, int len);
+static int put_chunk(SFBuf *p, char *id);
+static void end_chunk(SFBuf *p, int pos);
+static void put_sub_chunk(SFBuf *p, char *id, SFBuf *data);
+static int copy_file(int size, FILE *fin, FILE *fout);
+static int copy_file_direct(int size, FILE *fin, FILE *fout);
 
 
 #ifndef WORDS_BIGENDIAN
 #define READCHUNK(var,fd)	fread(&var, 8, 1, fd)
 #define WRITECHUNK(var,fd)	fwrite(&var, 8, 1, fd)
-#define WRITEW(var,fd)		fwrite(&var, 2, 1, fd)
 #define WRITEDW(var,fd)		fwrite(&var, 4, 1, fd)
 #else
 #define XCHG_SHORT(x) ((((x)&0xFF)<<8) | (((x)>>8)&0xFF))
@@ -52,8 +77,7 @@ static void copy_file(int size, FILE *fin, FILE *fout);
 #define READCHUNK(var,fd)	{uint32 tmp; fread((var).id, 4, 1, fd);\
 	fread(&tmp, 4, 1, fd); (var).size = XCHG_LONG(tmp);}
 #define WRITECHUNK(var,fd)	{uint32 tmp; fwrite((var).id, 4, 1, fd);\
-	tmp = XCHG_LONG((uint32)(var).size); fwrite(&tmp, 8, 1, fd);}
-#define WRITEW(var,fd)		{uint16 tmp = XCHG_SHORT((uint16)(var)); fwrite(&tmp, 2, 1, fd);}
+	tmp = XCHG_LONG((uint32)(var).size); fwrite(&tmp, 4, 1, fd);}
 #define WRITEDW(var,fd)		{uint32 tmp = XCHG_LONG((uint32)(var)); fwrite(&tmp, 4, 1, fd);}
 #endif
 #define WRITEB(var,fd)		fwrite(&var, 1, 1, fd)
@@ -63,31 +87,53 @@ static void copy_file(int size, FILE *fin, FILE *fout);
 
 /*----------------------------------------------------------------
  * save the soundfont info to a file
+ * return 0 if successful, or -1 if any read/write error occurs
  *----------------------------------------------------------------*/
 
-void awe_save_soundfont(SFInfo *sf, FILE *fin, FILE *fout)
+int awe_save_soundfont(SFInfo *sf, FILE *fin, FILE *fout)
 {
-	write_header(sf, fin, fout);
-	write_info(sf, fin, fout);
-	write_sdta(sf, fin, fout);
-	write_pdta(sf, fin, fout);
+	SFBuf pdta;
+	int info_size;
+	int rc = -1;
+
+	/* the pdta list is built at first to know the total size */
+	memset(&pdta, 0, sizeof(pdta));
+	make_pdta(sf, &pdta);
+
+	/* the info list size changes if the name is longer */
+	info_size = get_info_size(sf, fin);
+	write_header(sf, info_size, pdta.len, fout);
+	if (write_info(sf, info_size, fin, fout) < 0)
+		goto error;
+	if (write_sdta(sf, fin, fout) < 0)
+		goto error;
+	fwrite(pdta.buf, pdta.len, 1, fout);
+	if (fflush(fout) != 0 || ferror(fout)) {
+		fprintf(stderr, "can't write soundfont: %s\n", strerror(errno));
+		goto error;
+	}
+	rc = 0;
+
+ error:
+	safe_free(pdta.buf);
+	return rc;
 }
 
 /*----------------------------------------------------------------
  * write RIFF header and sfbk id
  *----------------------------------------------------------------*/
 
-static void write_header(SFInfo *sf, FILE *fin, FILE *fout)
+static void write_header(SFInfo *sf, int info_size, int pdta_size, FILE *fout)
 {
 	int32 size;
 
 	WRITEID("RIFF", fout);
 	size = 4; /* sfbk header */
-	size += sf->infosize + 4 + 8; /* info list */
+	size += info_size + 4 + 8; /* info list */
 	size += sf->samplesize + 8 + 4 + 8; /* sdta */
 	if (sf->version == 1)
 		size += sf->nsamples * 20 + 8; /* snam */
-	size += calc_pdta_size(sf) + 8; /* pdta */
+	size += pdta_size; /* pdta */
 	WRITEDW(size, fout);
 	WRITEID("sfbk", fout);
 }
@@ -97,12 +143,47 @@ static void write_header(SFInfo *sf, FILE *fin, FILE *fout)
  * write info list
  *----------------------------------------------------------------*/
 
-static void write_info(SFInfo *sf, FILE *fin, FILE *fout)
+/* size of INAM chunk; the original size is kept if the name fits,
+ * otherwise enlarged to an even size including the terminator
+ */
+static int name_chunk_size(SFInfo *sf, int orig_size)
+{
+	int size = sf->sf_name ? strlen(sf->sf_name) + 1 : 1;
+	if (size > SF_NAME_MAX)
+		size = SF_NAME_MAX;
+	size = (size + 1) & ~1;
+	return size > orig_size ? size : orig_size;
+}
+
+/* size of info list with the new INAM chunk */
+static int get_info_size(SFInfo *sf, FILE *fin)
+{
+	int32 size, left;
+	SFChunk chunk;
+
+	size = 0;
+	left = sf->infosize;
+	fseek(fin, sf->infopos, SEEK_SET);
+	while (left > 0) {
+		READCHUNK(chunk, fin);
+		if (feof(fin))
+			return sf->infosize;
+		left -= 8 + chunk.size;
+		if (strncmp(chunk.id, "INAM", 4) == 0)
+			size += 8 + name_chunk_size(sf, chunk.size);
+		else
+			size += 8 + chunk.size;
+		fseek(fin, chunk.size, SEEK_CUR);
+	}
+	return size;
+}
+
+static int write_info(SFInfo *sf, int info_size, FILE *fin, FILE *fout)
 {
 	int32 size, left;
 	
 	WRITEID("LIST", fout);
-	size = sf->infosize + 4; /* size with 'INFO' id */
+	size = info_size + 4; /* size with 'INFO' id */
 	WRITEDW(size, fout);
 	WRITEID("INFO", fout);
 	left = sf->infosize;
@@ -112,17 +193,27 @@ static void write_info(SFInfo *sf, FILE *fin, FILE *fout)
 		READCHUNK(chunk, fin); left -= 8;
 		/* replace INAM */
 		if (strncmp(chunk.id, "INAM", 4) == 0) {
+			/* the name may be changed; padded with zero */
+			SFChunk name = chunk;
+			int len = sf->sf_name ? strlen(sf->sf_name) : 0;
 			char term = 0;
-			WRITECHUNK(chunk, fout);
-			fwrite(sf->sf_name, chunk.size - 1, 1, fout);
-			WRITEB(term, fout); /* write zero terminator */
+			name.size = name_chunk_size(sf, chunk.size);
+			if (len > name.size - 1)
+				len = name.size - 1;
+			WRITECHUNK(name, fout);
+			if (len > 0)
+				fwrite(sf->sf_name, len, 1, fout);
+			for (; len < name.size; len++)
+				WRITEB(term, fout); /* write zero terminator */
 			fseek(fin, chunk.size, SEEK_CUR);
 		} else {
 			WRITECHUNK(chunk, fout);
-			copy_file(chunk.size, fin, fout);
+			if (copy_file(chunk.size, fin, fout) < 0)
+				return -1;
 		}
 		left -= chunk.size;
 	}
+	return 0;
 }
 
 
@@ -130,7 +221,7 @@ static void write_info(SFInfo *sf, FILE *fin, FILE *fout)
  * write sdta list
  *----------------------------------------------------------------*/
 
-static void write_sdta(SFInfo *sf, FILE *fin, FILE *fout)
+static int write_sdta(SFInfo *sf, FILE *fin, FILE *fout)
 {
 	int32 size;
 	int i;
@@ -156,264 +247,289 @@ static void write_sdta(SFInfo *sf, FILE *fin, FILE *fout)
 		size = sf->samplesize;
 		WRITEDW(size, fout);
 		fseek(fin, sf->samplepos, SEEK_SET);
-		copy_file(sf->samplesize, fin, fout);
+		if (copy_file_direct(sf->samplesize, fin, fout) < 0)
+			return -1;
 	}
+	return 0;
 }
 
 
 /*----------------------------------------------------------------
- * calculate pdta list size
+ * build pdta list on memory
+ *----------------------------------------------------------------
+ * The presets and instruments are traversed only once; the bags and
+ * generators are collected in the temporary buffers and appended
+ * after the header chunk.  The chunk sizes are filled afterwards.
  *----------------------------------------------------------------*/
 
-static int calc_pdta_size(SFInfo *sf)
+static void make_pdta(SFInfo *sf, SFBuf *pdta)
 {
-	int32 size = 0;
-	int i, j;
-	uint16 bag, gen;
+	SFBuf bag, gen;
+	int i, pos, list_pos;
 
-	/* pdta id */
-	size = 4;
+	memset(&bag, 0, sizeof(bag));
+	memset(&gen, 0, sizeof(gen));
 
-	/* phdr chunk */
-	size += sf->npresets * 38 + 8;
-
-	/* pbag chunk */
-	bag = 0;
-	for (i = 0; i < sf->npresets; i++) {
-		if (sf->preset[i].hdr.nlayers <= 0)
-			bag++;
-		else
-			bag += sf->preset[i].hdr.nlayers;
-	}
-	size += bag * 4 + 8;
-		
-	/* pmod chunk */
-	size += 8;
+	list_pos = put_chunk(pdta, "LIST");
+	put_data(pdta, "pdta", 4);
 
-	/* pgen chunk */
-	gen = 0;
+	/* presets */
+	pos = put_chunk(pdta, "phdr");
+	buf_reserve(pdta, sf->npresets * 38);
 	for (i = 0; i < sf->npresets; i++) {
-		for (j = 0; j < sf->preset[i].hdr.nlayers; j++)
-			gen += sf->preset[i].hdr.layer[j].nlists;
+		put_data(pdta, sf->preset[i].hdr.name, 20);
+		put_word(pdta, sf->preset[i].preset);
+		put_word(pdta, sf->preset[i].bank);
+		put_word(pdta, bag.len / 4);
+		put_dword(pdta, 0); /* library */
+		put_dword(pdta, 0); /* genre */
+		put_dword(pdta, 0); /* morphology */
+		put_layers(&sf->preset[i].hdr, &bag, &gen);
 	}
-	size += gen * 4 + 8;
-
-	/* ihdr chunk */
-	size += sf->ninsts * 22 + 8;
-
-	/* ibag chunk */
-	bag = 0;
+	end_chunk(pdta, pos);
+	put_sub_chunk(pdta, "pbag", &bag);
+	put_sub_chunk(pdta, "pmod", NULL);
+	put_sub_chunk(pdta, "pgen", &gen);
+
+	/* instruments */
+	bag.len = gen.len = 0;
+	pos = put_chunk(pdta, "inst");
+	buf_reserve(pdta, sf->ninsts * 22);
 	for (i = 0; i < sf->ninsts; i++) {
-		if (sf->inst[i].hdr.nlayers <= 0)
-			bag++;
-		else
-			bag += sf->inst[i].hdr.nlayers;
+		put_data(pdta, sf->inst[i].hdr.name, 20);
+		put_word(pdta, bag.len / 4);
+		put_layers(&sf->inst[i].hdr, &bag, &gen);
 	}
-	size += bag * 4 + 8;
-		
-	/* imod chunk */
-	size += 8;
-
-	/* igen chunk */
-	gen = 0;
-	for (i = 0; i < sf->ninsts; i++) {
-		for (j = 0; j < sf->inst[i].hdr.nlayers; j++)
-			gen += sf->inst[i].hdr.layer[j].nlists;
+	end_chunk(pdta, pos);
+	put_sub_chunk(pdta, "ibag", &bag);
+	put_sub_chunk(pdta, "imod", NULL);
+	put_sub_chunk(pdta, "igen", &gen);
+
+	/* samples */
+	pos = put_chunk(pdta, "shdr");
+	buf_reserve(pdta, sf->nsamples * (sf->version == 1 ? 16 : 46));
+	for (i = 0; i < sf->nsamples; i++) {
+		SFSampleInfo *sp = &sf->sample[i];
+		if (sf->version > 1)
+			put_data(pdta, sp->name, 20);
+		put_dword(pdta, sp->startsample);
+		put_dword(pdta, sp->endsample);
+		put_dword(pdta, sp->startloop);
+		put_dword(pdta, sp->endloop);
+		if (sf->version > 1) { /* SF2 only */
+			put_dword(pdta, sp->samplerate);
+			put_data(pdta, &sp->originalPitch, 1);
+			put_data(pdta, &sp->pitchCorrection, 1);
+			put_word(pdta, sp->samplelink);
+			put_word(pdta, sp->sampletype);
+		}
 	}
-	size += gen * 4 + 8;
+	end_chunk(pdta, pos);
 
-	/* shdr chunk */
-	if (sf->version == 1)
-		size += sf->nsamples * 16 + 8;
-	else
-		size += sf->nsamples * 46 + 8;
+	end_chunk(pdta, list_pos);
 
-	return size;
+	safe_free(bag.buf);
+	safe_free(gen.buf);
+}
+
+/* add the bags and generators of the header;
+ * a header without layers still has one empty bag
+ */
+static void put_layers(SFHeader *p, SFBuf *bag, SFBuf *gen)
+{
+	int j, k;
+
+	if (p->nlayers <= 0) {
+		put_word(bag, gen->len / 4);
+		put_word(bag, 0);
+		return;
+	}
+	for (j = 0; j < p->nlayers; j++) {
+		put_word(bag, gen->len / 4);
+		put_word(bag, 0);
+		buf_reserve(gen, p->layer[j].nlists * 4);
+		for (k = 0; k < p->layer[j].nlists; k++) {
+			put_word(gen, p->layer[j].list[k].oper);
+			put_word(gen, p->layer[j].list[k].amount);
+		}
+	}
 }
 
 
 /*----------------------------------------------------------------
- * write pdta list
+ * output buffer
  *----------------------------------------------------------------*/
 
-static void write_pdta(SFInfo *sf, FILE *fin, FILE *fout)
+#define BUF_UNIT	(16 * 1024)
+
+/* make room for len bytes */
+static void buf_reserve(SFBuf *p, int len)
 {
-	int32 size, total_size;
-	int i, j, k;
-	uint16 bag, gen;
-	
-	WRITEID("LIST", fout);
-	size = calc_pdta_size(sf);
-	WRITEDW(size, fout);
-	WRITEID("pdta", fout);
-	total_size = 4;
+	if (p->len + len <= p->size)
+		return;
+	if (p->size == 0)
+		p->size = BUF_UNIT;
+	while (p->len + len > p->size)
+		p->size *= 2;
+	p->buf = (unsigned char*)safe_realloc(p->buf, p->size);
+}
 
-	WRITEID("phdr", fout);
-	size = sf->npresets * 38;
-	WRITEDW(size, fout);
-	total_size += size + 8;
+static void put_word(SFBuf *p, int val)
+{
+	buf_reserve(p, 2);
+	p->buf[p->len++] = val & 0xff;
+	p->buf[p->len++] = (val >> 8) & 0xff;
+}
 
-	/* calculate bag size */
-	bag = 0;
-	for (i = 0; i < sf->npresets; i++) {
-		int32 dummy = 0;
-		WRITESTR(sf->preset[i].hdr.name, fout);
-		WRITEW(sf->preset[i].preset, fout);
-		WRITEW(sf->preset[i].bank, fout);
-		WRITEW(bag, fout);
-		WRITEDW(dummy, fout);
-		WRITEDW(dummy, fout);
-		WRITEDW(dummy, fout);
-		if (sf->preset[i].hdr.nlayers <= 0)
-			bag++;
-		else
-			bag += sf->preset[i].hdr.nlayers;
-	}
+static void put_dword(SFBuf *p, int32 val)
+{
+	buf_reserve(p, 4);
+	p->buf[p->len++] = val & 0xff;
+	p->buf[p->len++] = (val >> 8) & 0xff;
+	p->buf[p->len++] = (val >> 16) & 0xff;
+	p->buf[p->len++] = (val >> 24) & 0xff;
+}
 
-	WRITEID("pbag", fout);
-	size = bag * 4;
-	WRITEDW(size, fout);
-	total_size += size + 8;
+static void put_data(SFBuf *p, void *data, int len)
+{
+	buf_reserve(p, len);
+	memcpy(p->buf + p->len, data, len);
+	p->len += len;
+}
 
-	/* calculate generators size */
-	gen = 0;
-	for (i = 0; i < sf->npresets; i++) {
-		SFHeader *p = &sf->preset[i].hdr;
-		int16 dummy = 0;
-		if (p->nlayers <= 0) {
-			WRITEW(gen, fout);
-			WRITEW(dummy, fout);
-			continue;
-		}
-		for (j = 0; j < p->nlayers; j++) {
-			WRITEW(gen, fout);
-			WRITEW(dummy, fout);
-			gen += p->layer[j].nlists;
-		}
-	}
-		
-	WRITEID("pmod", fout);
-	size = 0;
-	WRITEDW(size, fout);
-	total_size += size + 8;
-	
-	WRITEID("pgen", fout);
-	size = gen * 4;
-	WRITEDW(size, fout);
-	total_size += size + 8;
+/* put a chunk header with empty size; return the position to fill */
+static int put_chunk(SFBuf *p, char *id)
+{
+	int pos;
+	put_data(p, id, 4);
+	pos = p->len;
+	put_dword(p, 0);
+	return pos;
+}
 
-	for (i = 0; i < sf->npresets; i++) {
-		SFHeader *p = &sf->preset[i].hdr;
-		for (j = 0; j < p->nlayers; j++) {
-			for (k = 0; k < p->layer[j].nlists; k++) {
-				WRITEW(p->layer[j].list[k].oper, fout);
-				WRITEW(p->layer[j].list[k].amount, fout);
-			}
-		}
-	}
+/* fill the chunk size */
+static void end_chunk(SFBuf *p, int pos)
+{
+	int32 size = p->len - pos - 4;
+	p->buf[pos] = size & 0xff;
+	p->buf[pos + 1] = (size >> 8) & 0xff;
+	p->buf[pos + 2] = (size >> 16) & 0xff;
+	p->buf[pos + 3] = (size >> 24) & 0xff;
+}
 
-	WRITEID("inst", fout);
-	size = sf->ninsts * 22;
-	WRITEDW(size, fout);
-	total_size += size + 8;
+/* put a chunk with the buffered data */
+static void put_sub_chunk(SFBuf *p, char *id, SFBuf *data)
+{
+	put_data(p, id, 4);
+	put_dword(p, data ? data->len : 0);
+	if (data && data->len > 0)
+		put_data(p, data->buf, data->len);
+}
 
-	bag = 0;
-	for (i = 0; i < sf->ninsts; i++) {
-		WRITESTR(sf->inst[i].hdr.name, fout);
-		WRITEW(bag, fout);
-		if (sf->inst[i].hdr.nlayers <= 0)
-			bag++;
-		else
-			bag += sf->inst[i].hdr.nlayers;
-	}
 
-	WRITEID("ibag", fout);
-	size = bag * 4;
-	WRITEDW(size, fout);
-	total_size += size + 8;
+/*----------------------------------------------------------------
+ * copy a block from file to file
+ * return 0 if successful, or -1 on a short read or write error
+ *----------------------------------------------------------------*/
 
-	gen = 0;
-	for (i = 0; i < sf->ninsts; i++) {
-		SFHeader *p = &sf->inst[i].hdr;
-		int16 dummy = 0;
-		if (p->nlayers <= 0) {
-			WRITEW(gen, fout);
-			WRITEW(dummy, fout);
-			continue;
-		}
-		for (j = 0; j < p->nlayers; j++) {
-			WRITEW(gen, fout);
-			WRITEW(dummy, fout);
-			gen += p->layer[j].nlists;
-		}
-	}
-		
-	WRITEID("imod", fout);
-	size = 0;
-	WRITEDW(size, fout);
-	total_size += size + 8;
-	
-	WRITEID("igen", fout);
-	size = gen * 4;
-	WRITEDW(size, fout);
-	total_size += size + 8;
+#define COPY_BUFSIZE	(64 * 1024)
 
-	for (i = 0; i < sf->ninsts; i++) {
-		SFHeader *p = &sf->inst[i].hdr;
-		for (j = 0; j < p->nlayers; j++) {
-			for (k = 0; k < p->layer[j].nlists; k++) {
-				WRITEW(p->layer[j].list[k].oper, fout);
-				WRITEW(p->layer[j].list[k].amount, fout);
-			}
+static int copy_file(int size, FILE *fin, FILE *fout)
+{
+	static char *buf;
+	int s, n;
+
+	if (buf == NULL)
+		buf = (char*)safe_malloc(COPY_BUFSIZE);
+	for (s = size; s > 0; s -= n) {
+		n = s < COPY_BUFSIZE ? s : COPY_BUFSIZE;
+		if (fread(buf, 1, n, fin) != n) {
+			fprintf(stderr, "can't read soundfont: %s\n",
+				feof(fin) ? "unexpected end of file" : strerror(errno));
+			return -1;
 		}
-	}
-	
-	WRITEID("shdr", fout);
-	if (sf->version == 1)
-		size = sf->nsamples * 16;
-	else
-		size = sf->nsamples * 46;
-	WRITEDW(size, fout);
-	total_size += size + 8;
-
-	for (i = 0; i < sf->nsamples; i++) {
-		if (sf->version > 1)
-			WRITESTR(sf->sample[i].name, fout);
-		WRITEDW(sf->sample[i].startsample, fout);
-		WRITEDW(sf->sample[i].endsample, fout);
-		WRITEDW(sf->sample[i].startloop, fout);
-		WRITEDW(sf->sample[i].endloop, fout);
-		if (sf->version > 1) { /* SF2 only */
-			WRITEDW(sf->sample[i].samplerate, fout);
-			WRITEB(sf->sample[i].originalPitch, fout);
-			WRITEB(sf->sample[i].pitchCorrection, fout);
-			WRITEW(sf->sample[i].samplelink, fout);
-			WRITEW(sf->sample[i].sampletype, fout);
+		if (fwrite(buf, 1, n, fout) != n) {
+			fprintf(stderr, "can't write soundfont: %s\n", strerror(errno));
+			return -1;
 		}
 	}
-
-	if ((size = calc_pdta_size(sf)) != total_size) {
-		fprintf(stderr, "pdta total size differ: %d %d\n",
-			total_size, size);
-	}
+	return 0;
 }
 
 
 /*----------------------------------------------------------------
- * copy a block from file to file
+ * copy a large block (the sample data) within the kernel
+ *----------------------------------------------------------------
+ * The data is transferred between the file descriptors by
+ * copy_file_range() or sendfile() with explicit offsets, and the
+ * stdio streams are repositioned afterwards.  If neither is
+ * available for these files (e.g. piped output), falls back to
+ * the buffered copy.
  *----------------------------------------------------------------*/
 
-static void copy_file(int size, FILE *fin, FILE *fout)
+static int copy_file_direct(int size, FILE *fin, FILE *fout)
 {
-	static char buf[1024];
-	int s;
-
-	for (s = size; s >= sizeof(buf); s -= sizeof(buf)) {
-		fread(buf, sizeof(buf), 1, fin);
-		fwrite(buf, sizeof(buf), 1, fout);
+#if defined(HAVE_COPY_FILE_RANGE) || defined(USE_SENDFILE)
+	int fdin, fdout;
+	off_t inpos, outpos;
+	ssize_t n = -1;
+	int left;
+
+	if (size <= 0)
+		return 0;
+	if (fflush(fout) != 0)
+		return copy_file(size, fin, fout);
+	if ((inpos = ftello(fin)) < 0)
+		return copy_file(size, fin, fout);
+	fdin = fileno(fin);
+	fdout = fileno(fout);
+	outpos = ftello(fout);
+	left = size;
+
+#ifdef HAVE_COPY_FILE_RANGE
+	/* both must be regular files */
+	while (outpos >= 0 && left > 0) {
+		n = copy_file_range(fdin, &inpos, fdout, &outpos, left, 0);
+		if (n <= 0)
+			break;
+		left -= n;
+	}
+	if (left < size && outpos >= 0) {
+		/* sync the stream with the written offset */
+		if (fseeko(fout, outpos, SEEK_SET) < 0)
+			return -1;
+	}
+#endif
+#ifdef USE_SENDFILE
+	/* the output offset is the current one of the descriptor */
+	if (left > 0 && (left == size || outpos < 0)) {
+		while (left > 0) {
+			n = sendfile(fdout, fdin, &inpos, left);
+			if (n <= 0)
+				break;
+			left -= n;
+			if (outpos >= 0)
+				outpos += n;
+		}
+		if (left < size && outpos >= 0) {
+			if (fseeko(fout, outpos, SEEK_SET) < 0)
+				return -1;
+		}
 	}
-	if (s > 0) {
-		fread(buf, s, 1, fin);
-		fwrite(buf, s, 1, fout);
+#endif
+	if (left < size) {
+		/* the data is not read through the stream, so seek it */
+		if (fseeko(fin, inpos, SEEK_SET) < 0)
+			return -1;
+		if (left > 0 && n == 0) {
+			fprintf(stderr, "can't read soundfont: unexpected end of file\n");
+			return -1;
+		}
 	}
+	if (left > 0)
+		return copy_file(left, fin, fout);
+	return 0;
+#else
+	return copy_file(size, fin, fout);
+#endif
 }
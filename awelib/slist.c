@@ -1,6 +1,6 @@
 /*================================================================
  * slist.c:
- *	S-expression list
+ *	S-expression token reader
  *
  * Copyright (C) 1996-1999 Takashi Iwai
  *
@@ -27,90 +27,81 @@
 #include "util.h"
 
 /*----------------------------------------------------------------
- * prototypes
+ * buffered file reader
+ *----------------------------------------------------------------
+ * The file is read via fread() in a large block instead of getc()
+ * for each character.  The read-ahead data is kept for the next
+ * call with the same file until SReadDone() is called.
  *----------------------------------------------------------------*/
 
-static SList SReadAtom(FILE *fp, int in_list);
-static SList SReadList(FILE *fp);
-static int SReadInt(FILE *fp);
-static int SReadChr(FILE *fp);
-static char *SReadFun(FILE *fp);
-static char *SReadStr(FILE *fp);
+#define READ_BUFSIZE	(64 * 1024)
 
+static struct {
+	FILE *fp;
+	unsigned char *buf;
+	int pos, len;
+} reader;
 
-/*----------------------------------------------------------------
- * allocate an atom
- *----------------------------------------------------------------*/
+/* token buffer */
+static char *tokbuf;
+static int toklen, toksize;
 
-SList SCons(void)
+static int fill_buffer(FILE *fp)
 {
-	SList p = (SList)safe_malloc(sizeof(SAtom));
-	memset(p, 0, sizeof(SAtom));
-	return p;
+	if (reader.fp != fp) {
+		reader.fp = fp;
+		reader.pos = reader.len = 0;
+	}
+	if (reader.buf == NULL)
+		reader.buf = (unsigned char*)safe_malloc(READ_BUFSIZE);
+	reader.pos = 0;
+	reader.len = fread(reader.buf, 1, READ_BUFSIZE, fp);
+	if (reader.len <= 0) {
+		reader.len = 0;
+		return EOF;
+	}
+	return reader.buf[reader.pos++];
 }
 
+#define getch(fp)	((reader.fp == (fp) && reader.pos < reader.len) ?\
+			 reader.buf[reader.pos++] : fill_buffer(fp))
+/* put back the last read character */
+#define ungetch(fp)	(reader.pos--)
 
-/*----------------------------------------------------------------
- * read s-expression file
- *----------------------------------------------------------------*/
-
-SList SReadFile(FILE *fp)
+/* forget the read-ahead data of the file */
+void SReadDone(FILE *fp)
 {
-	return SReadAtom(fp, FALSE);
+	if (reader.fp == fp) {
+		reader.fp = NULL;
+		reader.pos = reader.len = 0;
+	}
 }
 
-
-/*----------------------------------------------------------------
- * free a list
- *----------------------------------------------------------------*/
-
-void SFree(SList at)
+static void tok_reset(void)
 {
-	SList nx;
-	while (at) {
-		switch (at->type) {
-		case S_ATOM_LIST:
-			SFree(at->val.p);
-			break;
-		case S_ATOM_STR:
-		case S_ATOM_FUN:
-			free(at->val.s);
-			break;
-		}
-		nx = at->nxt.p;
-		free(at);
-		at = nx;
+	if (tokbuf == NULL) {
+		toksize = 256;
+		tokbuf = (char*)safe_malloc(toksize);
 	}
+	toklen = 0;
+	tokbuf[0] = 0;
 }
 
-
-/*----------------------------------------------------------------
- * return number of members
- *----------------------------------------------------------------*/
-
-int SIndex(SList list)
+static void tok_add(int c)
 {
-	int n;
-	if (list == NIL || !SListP(list)) return -1;
-	n = 0;
-	for (list = SCar(list); list; list = SCdr(list))
-		n++;
-	return n;
+	if (toklen + 1 >= toksize) {
+		toksize = toksize ? toksize * 2 : 256;
+		tokbuf = (char*)safe_realloc(tokbuf, toksize);
+	}
+	tokbuf[toklen++] = c;
+	tokbuf[toklen] = 0;
 }
 
-
-/*----------------------------------------------------------------
- * file operation
- *----------------------------------------------------------------*/
-
-/* skip one character */
-#define skipc(fp)	getc(fp)
-
 /* skip one line */
 static void skipline(FILE *fp)
 {
 	int c;
-	while ((c = getc(fp)) != EOF && c != '\n')
+	while ((c = getch(fp)) != EOF && c != '\n')
 		;
 }
 
@@ -122,13 +113,13 @@ static int readchar(int delim, int accept_empty, FILE *fp)
 {
 	int c, c2, c3;
 
-	if ((c = getc(fp)) == ESC_CHAR) {
-		if ((c = getc(fp)) == EOF || c == '\n')
+	if ((c = getch(fp)) == ESC_CHAR) {
+		if ((c = getch(fp)) == EOF || c == '\n')
 			return EOF;
 		if (isdigit(c)) {
-			if ((c2 = getc(fp)) == EOF || !isdigit(c2))
+			if ((c2 = getch(fp)) == EOF || !isdigit(c2))
 				return EOF;
-			if ((c3 = getc(fp)) == EOF || !isdigit(c3))
+			if ((c3 = getch(fp)) == EOF || !isdigit(c3))
 				return EOF;
 			c = (todigit(c) << 6) | (todigit(c2) << 3) | (todigit(c3));
 		}
@@ -141,187 +132,81 @@ static int readchar(int delim, int accept_empty, FILE *fp)
 	return c;
 }
 
-/* read a token */
-static char *readtoken(char *buf, int delim, FILE *fp)
+/* read a token into tokbuf */
+static char *readtoken(int delim, FILE *fp)
 {
-	char *p;
 	int c;
 
-	p = buf;
+	tok_reset();
 	for (;;) {
 		if (delim) {
 			if ((c = readchar(delim, TRUE, fp)) == EOF)
 				break;
 		} else {
-			if ((c = getc(fp)) == EOF)
+			if ((c = getch(fp)) == EOF)
 				break;
-			if (isspace(c) || c == '\n')
+			if (isspace(c))
 				break;
 			if (c == ')') {
-				ungetc(c, fp);
+				ungetch(fp);
 				break;
 			}
 		}
-		*p++ = c;
+		tok_add(c);
 	}
-	*p = 0;
-	return buf;
+	return tokbuf;
 }
 
-/* read a character and restore it again */
+/* skip spaces and comments, and return the next character */
 static int readhead(FILE *fp)
 {
 	int c;
-	while ((c = getc(fp)) != EOF) {
-		if (!isspace(c) && c != '\n') {
+	while ((c = getch(fp)) != EOF) {
+		if (!isspace(c)) {
 			if (c == ';' || c == '#') /* comment */
 				skipline(fp);
-			else {
-				ungetc(c, fp);
+			else
 				return c;
-			}
 		}
 	}
 	return EOF;
 }
 
+
 /*----------------------------------------------------------------
- * read an atom
+ * read a token
+ *----------------------------------------------------------------
+ * The token type is returned, and the value is stored in val.
+ * The string of S_TOKEN_STR and S_TOKEN_FUN is valid until the
+ * next call.
  *----------------------------------------------------------------*/
 
-static SList SReadAtom(FILE *fp, int in_list)
+int SReadToken(FILE *fp, SAtomVal *val)
 {
-	SList cur;
 	int c;
 
-	/* skip space and comments */
-	if ((c = readhead(fp)) == EOF) {
-		if (in_list)
-			fprintf(stderr, "SList: non-closed list\n");
-		return NIL;
-	}
-	if (c == ')') { /* close list */
-		skipc(fp); /* skip it */
-		if (!in_list)
-			fprintf(stderr, "SList: non-matched parenthesis\n");
-		return NIL;
-	}
-
-	cur = SCons();
-	switch (c) {
-	case '(': /* open list */
-		cur->type = S_ATOM_LIST;
-		cur->val.p = SReadList(fp);
-		break;
+	switch ((c = readhead(fp))) {
+	case EOF:
+		return S_TOKEN_EOF;
+	case '(':
+		return S_TOKEN_OPEN;
+	case ')':
+		return S_TOKEN_CLOSE;
 	case '"': /* string */
-		cur->type = S_ATOM_STR;
-		cur->val.s = SReadStr(fp);
-		break;
+		val->s = readtoken('"', fp);
+		return S_TOKEN_STR;
 	case '\'': /* char */
-		cur->type = S_ATOM_CHR;
-		cur->val.c = SReadChr(fp);
-		break;
-	default:
-		if (isdigit(c) || c == '-') { /* int */
-			cur->type = S_ATOM_INT;
-			cur->val.i = SReadInt(fp);
-		} else { /* func */
-			cur->type = S_ATOM_FUN;
-			cur->val.f = SReadFun(fp);
-		}
-		break;
+		val->c = readchar('\'', FALSE, fp);
+		if (getch(fp) != '\'')
+			fprintf(stderr, "SList: non-closed character\n");
+		return S_TOKEN_CHR;
 	}
-	return cur;
-}
-
-/* read a list */
-static SList SReadList(FILE *fp)
-{
-	SList head, cur;
-
-	skipc(fp); /* skip open parenthesis */
-	head = cur = SReadAtom(fp, TRUE);
-	while (cur) {
-		cur->nxt.p = SReadAtom(fp, TRUE);
-		cur = cur->nxt.p;
+	ungetch(fp);
+	readtoken(0, fp);
+	if (isdigit(c) || c == '-') { /* int */
+		val->i = (int)strtol(tokbuf, NULL, 0);
+		return S_TOKEN_INT;
 	}
-	return head;
-}
-
-/* read an integer value */
-static int SReadInt(FILE *fp)
-{
-	char str[256];
-	readtoken(str, 0, fp);
-	return (int)strtol(str, NULL, 0);
-	return 0;
-}
-	
-/* read a character value */
-static int SReadChr(FILE *fp)
-{
-	int c;
-	skipc(fp); /* skip leading quote */
-	c = readchar('\'', FALSE, fp);
-	if (getc(fp) != '\'')
-		fprintf(stderr, "SList: non-closed character\n");
-	return c;
-
-}
-		
-/* read a constant string */
-static char *SReadFun(FILE *fp)
-{
-	char str[256];
-	readtoken(str, 0, fp);
-	return safe_strdup(str);
+	val->f = tokbuf; /* func */
+	return S_TOKEN_FUN;
 }
-
-/* read a string */
-static char *SReadStr(FILE *fp)
-{
-	char str[256];
-	skipc(fp); /* skip reading double quote */
-	readtoken(str, '"', fp);
-	return safe_strdup(str);
-}
-
-
-#ifdef DEBUG_MODE
-
-/*----------------------------------------------------------------
- * print a list recursively
- *----------------------------------------------------------------*/
-
-void print_list(SList at)
-{
-	while (at) {
-		switch (at->type) {
-		case S_ATOM_LIST:
-			printf("(");
-			print_list(at->val.p);
-			printf(")\n");
-			break;
-		case S_ATOM_STR:
-			printf("\"%s\"", at->val.s);
-			break;
-		case S_ATOM_FUN:
-			printf("%s", at->val.s);
-			break;
-		case S_ATOM_INT:
-			printf("%d", at->val.i);
-			break;
-		case S_ATOM_CHR:
-			printf("'%c'", at->val.c);
-			break;
-		default:
-			printf("*unknown*");
-			break;
-		}
-		at = at->nxt.p;
-		if (at)
-			printf(" ");
-	}
-}
-
-#endif
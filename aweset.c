@@ -31,10 +31,19 @@
 #endif
 #include <awe_voice.h>
 #include <getopt.h>
+#ifdef BUILD_AAWESET
+#include <alsa/asoundlib.h>
+#endif
 #include "util.h"
 #include "seq.h"
 #include "awe_version.h"
 
+#ifdef BUILD_AAWESET
+#define PROGNAME "aaweset"
+#else
+#define PROGNAME "aweset"
+#endif
+
 int verbose = 0;
 
 /*----------------------------------------------------------------
@@ -45,17 +54,35 @@ static void seq_setmode(int mode, int val);
 static void seq_init_chip(void);
 static void usage(void);
 static int search_cmd(char *arg);
-static void parse_cmd(int argc, char **argv);
+static int parse_cmd(int argc, char **argv);
 static void do_cmd(int c, char *arg);
 static void read_from_file(char *fname);
+static void read_commands(FILE *fp, int each_line);
+static void error_exit(void);
 
 
 /*----------------------------------------------------------------
  * sequencer part
  *----------------------------------------------------------------*/
 
-SEQ_USE_EXTBUF();
+#ifdef BUILD_AAWESET
 
+/* the mode is changed on all ports via hwdep */
+static void seq_setmode(int mode, int val)
+{
+	if (seq_misc_mode(mode, val) < 0)
+		fprintf(stderr, "error: can't set mode %d\n", mode);
+}
+
+/* Emux hwdep has no interface to initialize the chip */
+static void seq_init_chip(void)
+{
+	fprintf(stderr, "error: init is not supported on ALSA\n");
+}
+
+#else
+
+/* the event is kept in the buffer in batch mode */
 static void seq_setmode(int mode, int val)
 {
 	AWE_MISC_MODE(awe_dev, mode, val);
@@ -64,9 +91,13 @@ static void seq_setmode(int mode, int val)
 
 static void seq_init_chip(void)
 {
+	/* this is sent directly, so write out the former commands */
+	seq_flush();
 	AWE_INITIALIZE_CHIP(seqfd, awe_dev);
 }
 
+#endif
+
 
 /*----------------------------------------------------------------
  * main routine
@@ -76,34 +107,64 @@ static struct option long_options[] = {
 	{"help", 0, 0, 'h'},
 	{"verbose", 0, 0, 'v'},
 	{"file", 1, 0, 'f'},
+	{"stdin", 0, 0, 's'},
+#ifdef BUILD_AAWESET
+	{"hwdep", 1, 0, 'D'},
+#else
+	{"batch", 0, 0, 'b'},
 	{"device", 1, 0, 'F'},
 	{"index", 1, 0, 'D'},
+#endif
 	{0,0,0,0},
 };
 
-#define OPTIONS "hvf:F:D:"
-static int file_passed = 0;
+#ifdef BUILD_AAWESET
+#define OPTIONS "hvf:sD:"
+#else
+#define OPTIONS "hvf:sbF:D:"
+#endif
 
 int main(int argc, char **argv)
 {
-	int c;
+	int c, i;
+	char **files;
+	int nfiles = 0;
+	int from_stdin = FALSE;
+#ifdef BUILD_AAWESET
+	char *hwdep_name = NULL;
+#else
 	char *seq_devname = NULL;
 	int seq_devidx = -1;
+	int batch = FALSE;
+#endif
 
+	/* -f can't be given more than argc times */
+	files = (char**)safe_malloc(sizeof(char*) * argc);
 	while ((c = getopt_long(argc, argv, OPTIONS, long_options, NULL)) != -1) {
 		switch (c) {
+#ifdef BUILD_AAWESET
+		case 'D':
+			hwdep_name = optarg;
+			break;
+#else
 		case 'F':
 			seq_devname = optarg;
 			break;
 		case 'D':
 			seq_devidx = atoi(optarg);
 			break;
+		case 'b':
+			batch = TRUE;
+			break;
+#endif
 		case 'v':
 			verbose = TRUE;
 			break;
 		case 'f':
-			read_from_file(optarg);
-			file_passed = 1;
+			files[nfiles++] = optarg;
+			break;
+		case 's':
+			from_stdin = TRUE;
 			break;
 		default:
 			usage();
@@ -112,16 +173,39 @@ int main(int argc, char **argv)
 		}
 	}
 
-	seq_init(seq_devname, seq_devidx);
-	
-	if (optind < argc)
-		parse_cmd(argc - optind, argv + optind);
-	else if (! file_passed) {
+	if (optind >= argc && ! nfiles && ! from_stdin) {
 		usage();
 		return 1;
 	}
 
+	/* all commands are sent via the same device */
+#ifdef BUILD_AAWESET
+	seq_alsa_init(hwdep_name);
+#else
+	seq_init(seq_devname, seq_devidx);
+	/* the commands are written at once in seq_batch_end() */
+	if (batch || from_stdin)
+		seq_batch_begin();
+#endif
+
+	for (i = 0; i < nfiles; i++)
+		read_from_file(files[i]);
+	safe_free(files);
+	if (optind < argc && ! parse_cmd(argc - optind, argv + optind))
+		error_exit();
+	if (from_stdin)
+		read_commands(stdin, TRUE);
+
+#ifndef BUILD_AAWESET
+	if (batch || from_stdin)
+		seq_batch_end();
+#endif
+
+#ifdef BUILD_AAWESET
+	seq_alsa_end();
+#else
 	seq_end();
+#endif
 	return 0;
 }
 
@@ -137,14 +221,24 @@ int main(int argc, char **argv)
 static void read_from_file(char *fname)
 {
 	FILE *fp;
-	char line[MAX_LINES];
-	char *argv[MAX_ARGS];
-	int argc;
 
 	if ((fp = fopen(fname, "r")) == NULL) {
 		fprintf(stderr, "error: can't open file '%s'\n", fname);
-		exit(1);
+		error_exit();
 	}
+	read_commands(fp, FALSE);
+	fclose(fp);
+}
+
+/* parse each line as command arguments;
+ * if each_line is TRUE (stdin), the commands are written out at each
+ * line, and a bad line is reported and skipped
+ */
+static void read_commands(FILE *fp, int each_line)
+{
+	char line[MAX_LINES];
+	char *argv[MAX_ARGS];
+	int argc;
 
 	argc = 0;
 	while (fgets(line, sizeof(line), fp)) {
@@ -157,11 +251,14 @@ static void read_from_file(char *fname)
 				if (argc >= MAX_ARGS)
 					break;
 			}
-			parse_cmd(argc, argv);
+			if (! parse_cmd(argc, argv) && ! each_line)
+				error_exit();
 		}
+#ifndef BUILD_AAWESET
+		if (each_line)
+			seq_flush();
+#endif
 	}
-
-	fclose(fp);
 }
 
 
@@ -232,13 +329,25 @@ static void usage(void)
 {
 	int i;
 
+#ifdef BUILD_AAWESET
+	fprintf(stderr, "aaweset -- control Emux WaveTable parameters on ALSA\n");
+#else
 	fprintf(stderr, "aweset -- control awedrv parameters\n");
+#endif
 	fprintf(stderr, VERSION_NOTE);
-	fprintf(stderr, "usage: aweset [-options] command [argument] ...\n");
+	fprintf(stderr, "usage: " PROGNAME " [-options] command [argument] ...\n");
 	fprintf(stderr, "  options:\n");
 	fprintf(stderr, "    --help, -h: put this message\n");
 	fprintf(stderr, "    --verbose, -v: verbose mode\n");
 	fprintf(stderr, "    --file=config, -f: read commands from file\n");
+	fprintf(stderr, "    --stdin, -s: read commands from stdin until EOF\n");
+#ifdef BUILD_AAWESET
+	fprintf(stderr, "    --hwdep=name, -D: specify the hwdep name\n");
+#else
+	fprintf(stderr, "    --batch, -b: write all commands at once\n");
+	fprintf(stderr, "    --device=file, -F: specify the device file\n");
+	fprintf(stderr, "    --index=number, -D: specify the device index (-1=autoprobe)\n");
+#endif
 	fprintf(stderr, "  commands: name (abbrev) argument : description\n");
 	for (i = 0; i < numberof(ctrl_parms); i++) {
 		fprintf(stderr, "    %10s (%c)",
@@ -291,7 +400,10 @@ static int search_cmd(char *arg)
  * parse command line arguments
  *----------------------------------------------------------------*/  
 
-static void parse_cmd(int argc, char **argv)
+/* return FALSE if a bad command is found; the commands before it
+ * are executed
+ */
+static int parse_cmd(int argc, char **argv)
 {
 	int c, cmd;
 	char *p;
@@ -300,7 +412,7 @@ static void parse_cmd(int argc, char **argv)
 		if ((cmd = search_cmd(argv[c])) >= 0) {
 			if (ctrl_parms[cmd].type != CT_NONE && c >= argc - 1) {
 				fprintf(stderr, "error: no argument is given for command '%s'\n", ctrl_parms[cmd].longcmd);
-				exit(1);
+				return FALSE;
 			}
 			do_cmd(cmd, argv[c + 1]);
 			if (ctrl_parms[cmd].type != CT_NONE)
@@ -309,11 +421,26 @@ static void parse_cmd(int argc, char **argv)
 			*p = 0;
 			if ((cmd = search_cmd(argv[c])) < 0) {
 				fprintf(stderr, "error: invalid command '%s'\n", argv[c]);
-				exit(1);
+				return FALSE;
 			}
 			do_cmd(cmd, p + 1);
 		}
 	}
+	return TRUE;
+}
+
+/* quit after sending the commands accepted so far;
+ * in batch mode, they are still in the buffer
+ */
+static void error_exit(void)
+{
+#ifdef BUILD_AAWESET
+	seq_alsa_end();
+#else
+	seq_batch_end();
+	seq_end();
+#endif
+	exit(1);
 }
 
 
@@ -0,0 +1,88 @@
+/*================================================================
+ * bnkcompile -- compile virtual bank file
+ *
+ * Copyright (C) 1996-2000 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <util.h>
+#include <awebank.h>
+#include <sfopts.h>
+#include <awe_version.h>
+
+extern int awe_verbose;
+
+static void usage()
+{
+	fputs("bnkcompile -- compile virtual bank file\n"
+	      VERSION_NOTE
+	      "usage:	bnkcompile [-options] bankfile[.bnk] [outputfile]\n"
+	      "\n"
+	      " options:\n"
+	      " -v, --verbose[=int]      set verbosity level\n"
+	      " -P, --path=dir           set SoundFont file search path\n",
+	      stderr);
+	exit(1);
+}
+
+static struct option long_options[] = {
+	{"verbose", 2, 0, 'v'},
+	{0, 0, 0, 0},
+};
+static int option_index;
+
+#define OPTION_FLAGS	"v"
+
+int main(int argc, char **argv)
+{
+	int c, rc;
+	char *bank, *outfile;
+
+	awe_init_option();
+	awe_read_option_file(NULL);
+
+	while ((c = awe_parse_options(argc, argv, OPTION_FLAGS, long_options, &option_index)) != -1) {
+		switch (c) {
+		case 0:
+			break;
+		case 'v':
+			if (optarg)
+				awe_verbose = atoi(optarg);
+			else
+				awe_verbose++;
+			break;
+		default:
+			usage();
+			break;
+		}
+	}
+	if (optind >= argc)
+		usage();
+	bank = argv[optind];
+	outfile = optind + 1 < argc ? argv[optind + 1] : NULL;
+
+	rc = awe_compile_bank(bank, outfile);
+	if (rc == AWE_RET_NOT_FOUND) {
+		fprintf(stderr, "bnkcompile: can't find bank file %s\n", bank);
+		return 1;
+	} else if (rc != AWE_RET_OK)
+		return 1;
+
+	return 0;
+}
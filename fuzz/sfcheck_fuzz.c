@@ -0,0 +1,52 @@
+/*================================================================
+ * sfcheck_fuzz -- libFuzzer target for the soundfont checker
+ *
+ * Copyright (C) 1996-2003 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *================================================================*/
+
+/*
+ * The input is checked by awe_check_soundfont() as read_font() in
+ * loadbank.c does, and the accepted one is parsed as well, so that
+ * the parser never sees a file the checker missed.
+ * Built with "configure --enable-fuzz" (clang is needed).
+ */
+
+#define _GNU_SOURCE	/* fmemopen */
+#include <stdio.h>
+#include <stdint.h>
+#include "util.h"
+#include "sffile.h"
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+	FILE *fp;
+	SFInfo sf;
+
+	if (size == 0)
+		return 0;
+	if ((fp = fmemopen((void*)data, size, "r")) == NULL)
+		return 0;
+	if (awe_check_soundfont(fp, 0) == 0) {
+		rewind(fp);
+		if (awe_load_soundfont(&sf, fp, TRUE) == 0) {
+			awe_correct_samples(&sf);
+			awe_free_soundfont(&sf);
+		}
+	}
+	fclose(fp);
+	return 0;
+}
@@ -21,8 +21,10 @@
 #include <stdio.h>
 #include <unistd.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
-#include <math.h>
+#include <ctype.h>
+#include <sys/stat.h>
 #include <sys/fcntl.h>
 #ifdef BUILD_AGUSLOAD
 #include <alsa/asoundlib.h>
@@ -35,6 +37,9 @@
 #include "guspatch.h"
 #include "seq.h"
 #include "util.h"
+#include "aweseq.h"
+#include "freqnote.h"
+#include "sfopts.h"
 #include "awe_version.h"
 
 #ifdef BUILD_AGUSLOAD
@@ -43,14 +48,26 @@
 #define PROGNAME "gusload"
 #endif
 
-void seq_load_gus(FILE *fd);
+int seq_load_gus(FILE *fp, int preset, int keynote);
+static int load_gus_file(char *name, int bank, int preset, int keynote);
+static int load_config(char *name, int level);
+static int load_soundfont(void);
+static int save_soundfont(char *outfile);
+
+static AWEOps load_ops = {
+	seq_load_patch,
+	seq_mem_avail,
+	seq_reset_samples,
+	seq_remove_samples,
+	seq_zero_atten
+};
 
 
 static void usage()
 {
 	fprintf(stderr, PROGNAME " -- load GUS patch file on AWE32 sound driver\n");
 	fprintf(stderr, VERSION_NOTE);
-	fprintf(stderr, "usage: " PROGNAME " [-options] GUSpatch\n"
+	fprintf(stderr, "usage: " PROGNAME " [-options] GUSpatch|config.cfg...\n"
 #ifdef BUILD_AGUSLOAD
 		" -D, --hwdep=name        specify the hwdep name\n"
 #else
@@ -60,7 +77,11 @@ static void usage()
 		" -v          verbose mode\n"
 		" -p number   set instrument number (default is internal value)\n"
 		" -b number   set bank number (default is 0)\n"
-		" -k keynote  set fixed keynote\n");
+		" -k keynote  set fixed keynote\n"
+		" -s          convert to SoundFont voices and load them\n"
+		" -o file     convert to SoundFont and write to the file\n"
+		"The files with .cfg suffix are read as timidity config files.\n"
+		"Options -p, -b and -k are not applied to the patches in them.\n");
 	exit(1);
 }
 
@@ -68,19 +89,24 @@ static int clear_sample = FALSE;
 static int preset = -1;
 static int bankchange = -1;
 static int keynote = -1;
+static int convert_sf = FALSE;
+static char *sf_outfile = NULL;
 int awe_verbose;
 
+/* the converted soundfont; the samples are written on sf_tmp */
+static SFInfo sfinfo;
+static FILE *sf_tmp;
+
 #ifdef BUILD_AGUSLOAD
-#define OPTION_FLAGS	"b:p:k:viD:"
+#define OPTION_FLAGS	"b:p:k:viso:D:"
 #else
-#define OPTION_FLAGS	"b:p:k:viF:D:"
+#define OPTION_FLAGS	"b:p:k:viso:F:D:"
 #endif
 
 int main(int argc, char **argv)
 {
-	FILE *fd;
-	char *gusfile;
-	int c;
+	char *name;
+	int c, len, rc;
 #ifdef BUILD_AGUSLOAD
 	char *hwdep_name = NULL;
 #else
@@ -120,6 +146,13 @@ int main(int argc, char **argv)
 		case 'i':
 			clear_sample = TRUE;
 			break;
+		case 's':
+			convert_sf = TRUE;
+			break;
+		case 'o':
+			sf_outfile = optarg;
+			convert_sf = TRUE;
+			break;
 		default:
 			usage();
 			return 1;
@@ -131,23 +164,59 @@ int main(int argc, char **argv)
 		return 1;
 	}
 
-	gusfile = argv[optind]; optind++;
-	if ((fd = fopen(gusfile, "r")) == NULL) {
-		fprintf(stderr, "can't open GUS patch file %s\n", gusfile);
-		return 1;
+	if (convert_sf) {
+		/* the samples are kept on a temporary file until loaded */
+		if ((sf_tmp = tmpfile()) == NULL) {
+			perror("can't create a temporary file");
+			return 1;
+		}
+		if ((name = strrchr(argv[optind], '/')) != NULL)
+			name++;
+		else
+			name = argv[optind];
+		awe_gus_begin_soundfont(&sfinfo, name, sf_tmp);
 	}
 
-	/* open awe sequencer device */
+	/* open awe sequencer device; all files are loaded on it */
+	if (! sf_outfile) {
 #ifdef BUILD_AGUSLOAD
-	seq_alsa_init(hwdep_name);
+		seq_alsa_init(hwdep_name);
 #else
-	seq_init(seq_devname, seq_devidx);
+		seq_init(seq_devname, seq_devidx);
 #endif
-	if (clear_sample)
-		seq_reset_samples();
+		if (clear_sample)
+			seq_reset_samples();
+	}
 
 	DEBUG(0,fprintf(stderr, "uploading samples..\n"));
-	seq_load_gus(fd);
+	rc = 0;
+	for (; optind < argc; optind++) {
+		name = argv[optind];
+		len = strlen(name);
+		if (len > 4 && strcmp(name + len - 4, ".cfg") == 0) {
+			if (load_config(name, 0) < 0)
+				rc = 1;
+		} else if (load_gus_file(name, bankchange, preset, keynote) < 0)
+			rc = 1;
+	}
+
+	if (convert_sf) {
+		/* with -o, nothing is written if any patch failed;
+		 * with -s, the patches converted successfully are
+		 * still loaded; the failed ones are skipped
+		 */
+		if (awe_gus_end_soundfont(&sfinfo, sf_tmp) < 0)
+			rc = 1;
+		else if (sf_outfile) {
+			if (rc || save_soundfont(sf_outfile) < 0)
+				rc = 1;
+		} else if (sfinfo.ninsts > 1 && load_soundfont() < 0)
+			rc = 1;
+		awe_free_soundfont(&sfinfo);
+		fclose(sf_tmp);
+		if (sf_outfile)
+			return rc;
+	}
 
 	DEBUG(0,printf("DRAM memory left = %d kB\n", seq_mem_avail()/1024));
 
@@ -157,190 +226,335 @@ int main(int argc, char **argv)
 #else
 	seq_end();
 #endif
+
+	return rc;
+}
+
+
+/*----------------------------------------------------------------
+ * load a patch file
+ *----------------------------------------------------------------*/
+
+/* the bank value last sent to the driver; -1 = not sent yet */
+static int cur_bank = -1;
+
+static int load_gus_file(char *name, int bank, int pre, int key)
+{
+	FILE *fd;
+	int rc;
+
+	if ((fd = fopen(name, "r")) == NULL) {
+		fprintf(stderr, "can't open GUS patch file %s\n", name);
+		return -1;
+	}
+	if (convert_sf) {
+		DEBUG(0,fprintf(stderr, "converting %s\n", name));
+		rc = awe_gus_add_patch(&sfinfo, sf_tmp, fd, name, bank, pre, key);
+		fclose(fd);
+		if (rc < 0)
+			fprintf(stderr, "[Converting GUS patch %s]\n", name);
+		return rc;
+	}
+	/* if -b option is specified, change the bank value */
+	if (bank >= 0 && bank != cur_bank) {
+		DEBUG(1,fprintf(stderr, "-- set bank number %d\n", bank));
+		seq_set_gus_bank(bank);
+		cur_bank = bank;
+	}
+	DEBUG(0,fprintf(stderr, "loading %s\n", name));
+	rc = seq_load_gus(fd, pre, key);
 	fclose(fd);
+	if (rc < 0)
+		fprintf(stderr, "[Loading GUS patch %s]\n", name);
+	return rc;
+}
+
+
+/*----------------------------------------------------------------
+ * load or save the converted soundfont
+ *----------------------------------------------------------------*/
+
+static int load_soundfont(void)
+{
+	int rc;
+
+	awe_init_option();
+	awe_read_option_file(NULL);
+	awe_correct_samples(&sfinfo);
+	if (awe_open_font(&load_ops, &sfinfo, sf_tmp, FALSE) < 0) {
+		fprintf(stderr, "can't open the converted patches\n");
+		return -1;
+	}
+	rc = awe_load_all_fonts(&load_ops, &sfinfo, NULL);
+	awe_close_font(&load_ops, &sfinfo);
+	return rc == AWE_RET_OK ? 0 : -1;
+}
 
-	return 0;
+static int save_soundfont(char *outfile)
+{
+	FILE *fout;
+	int rc;
+
+	if ((fout = fopen(outfile, "w")) == NULL) {
+		fprintf(stderr, "can't open %s\n", outfile);
+		return -1;
+	}
+	rc = awe_save_soundfont(&sfinfo, sf_tmp, fout);
+	if (fclose(fout) != 0)
+		rc = -1;
+	if (rc < 0)
+		fprintf(stderr, "can't write %s\n", outfile);
+	return rc;
 }
 
-static GusPatchHeader header;
-static GusInstrument ins;
-static GusLayerData layer;
-static GusPatchData sample;
 
-#define freq_to_note(mhz)	(int)(log((double)mhz / 8176.0) / log(2.0) * 1200.0)
+/*----------------------------------------------------------------
+ * timidity config file
+ *----------------------------------------------------------------
+ * dir path		add the search path
+ * source file		read another config file
+ * bank number		following programs are in the tone bank
+ * drumset number	following notes are in the drum set
+ * number file [opts]	load the patch file on the program or note
+ * the other keywords and options are ignored.
+ *----------------------------------------------------------------*/
+
+#define MAX_CONFIG_NEST		16
+
+static char *cfg_path;	/* search path of patches; the last dir first */
+static char *patch_ext[] = { ".pat", NULL };
+
+static void add_cfg_dir(char *dir)
+{
+	char *path;
+
+	if (cfg_path) {
+		path = (char*)safe_malloc(strlen(dir) + strlen(cfg_path) + 2);
+		sprintf(path, "%s:%s", dir, cfg_path);
+		safe_free(cfg_path);
+	} else
+		path = safe_strdup(dir);
+	cfg_path = path;
+}
+
+static int load_config(char *name, int level)
+{
+	FILE *fp;
+	char line[1024], path[1024];
+	char *tok, *file;
+	int lineno, bank, drum, num, rc;
+
+	if (level >= MAX_CONFIG_NEST) {
+		fprintf(stderr, "too deep nesting of config file %s\n", name);
+		return -1;
+	}
+	if (level > 0 &&
+	    awe_search_file_name(path, sizeof(path), name, cfg_path, NULL))
+		name = path;
+	if ((fp = fopen(name, "r")) == NULL) {
+		fprintf(stderr, "can't open config file %s\n", name);
+		return -1;
+	}
+
+	rc = 0;
+	bank = 0;
+	drum = FALSE;
+	lineno = 0;
+	while (fgets(line, sizeof(line), fp)) {
+		lineno++;
+		if ((tok = strtok(line, " \t\r\n")) == NULL || *tok == '#')
+			continue;
+		if (strcmp(tok, "dir") == 0) {
+			if ((tok = strtok(NULL, " \t\r\n")) != NULL)
+				add_cfg_dir(tok);
+		} else if (strcmp(tok, "source") == 0) {
+			if ((tok = strtok(NULL, " \t\r\n")) != NULL &&
+			    load_config(tok, level + 1) < 0)
+				rc = -1;
+		} else if (strcmp(tok, "bank") == 0 ||
+			   strcmp(tok, "drumset") == 0) {
+			drum = (*tok == 'd');
+			if ((tok = strtok(NULL, " \t\r\n")) != NULL)
+				bank = atoi(tok);
+		} else if (isdigit(*tok)) {
+			num = atoi(tok);
+			if ((file = strtok(NULL, " \t\r\n")) == NULL ||
+			    *file == '#')
+				continue;
+			if (! awe_search_file_name(path, sizeof(path), file,
+						   cfg_path, patch_ext)) {
+				fprintf(stderr, "%s:%d: can't find %s\n",
+					name, lineno, file);
+				rc = -1;
+				continue;
+			}
+			/* drum set is loaded on bank 128 with fixed keys */
+			if (drum)
+				num = load_gus_file(path, 128, bank, num);
+			else
+				num = load_gus_file(path, bank, num, -1);
+			if (num < 0)
+				rc = -1;
+		} else
+			DEBUG(0,fprintf(stderr, "%s:%d: %s is ignored\n",
+					name, lineno, tok));
+	}
+	fclose(fp);
+	return rc;
+}
+
+
+/*----------------------------------------------------------------
+ * load the patch as raw GUS voices
+ *----------------------------------------------------------------*/
+
+/* grow-only buffers reused for all files and samples */
+static byte *file_buf;
+static long file_buf_size;
+static byte *patch_buf;
+static long patch_buf_size;
+
+static byte *grow_buffer(byte **bufp, long *sizep, long size)
+{
+	if (size > *sizep) {
+		safe_free(*bufp);
+		*bufp = (byte*)safe_malloc(size);
+		*sizep = size;
+	}
+	return *bufp;
+}
+
+typedef struct _LoadRec {
+	int preset, keynote;
+} LoadRec;
+
+static int load_sample(void *private, GusPatchHeader *hp, GusInstrument *ip,
+		       GusLayerData *lp, GusPatchData *sp, byte *data);
 
 /*
- * load voice record to the awe driver
+ * load all instruments, layers and samples in the patch file
+ * to the awe driver.  the whole file is read at once, and the
+ * headers are parsed on memory.
  */
-void seq_load_gus(FILE *fp)
+int seq_load_gus(FILE *fp, int pre, int key)
 {
-	int j, len;
-	struct patch_info *patch;
-
-	/* Unix based routines, assume big-endian machine */
-	/* read header */
-	DEBUG(1,fprintf(stderr, "reading header\n"));
-	fread(&header.header, sizeof(header.header), 1, fp);
-	fread(&header.gravis_id, sizeof(header.gravis_id), 1, fp);
-	fread(&header.description, sizeof(header.description), 1, fp);
-	fread(&header.instruments, sizeof(header.instruments), 1, fp);
-	fread(&header.voices, sizeof(header.voices), 1, fp);
-	fread(&header.channels, sizeof(header.channels), 1, fp);
-	fread(&header.wave_forms, sizeof(header.wave_forms), 1, fp);
-	header.wave_forms = swapi( header.wave_forms );
-	fread(&header.master_volume, sizeof(header.master_volume), 1, fp);
-	header.master_volume = swapi( header.master_volume );
-	fread(&header.data_size, sizeof(header.data_size), 1, fp);
-	header.data_size = swapl( header.data_size );
-	fread(&header.reserved, sizeof(header.reserved), 1, fp);
-	/* read instrument header */
-	DEBUG(1,fprintf(stderr, "reading instrument\n"));
-	fread(&ins.instrument, sizeof(ins.instrument), 1, fp);
-	fread(&ins.instrument_name, sizeof(ins.instrument_name), 1, fp);
-	fread(&ins.instrument_size, sizeof(ins.instrument_size), 1, fp);
-	ins.instrument_size = swapl( ins.instrument_size );
-	fread(&ins.layers, sizeof(ins.layers), 1, fp);
-	fread(&ins.reserved, sizeof(ins.reserved), 1, fp);
-	/* read layer header */
-	DEBUG(1,fprintf(stderr, "reading layer\n"));
-	fread(&layer.layer_duplicate, sizeof(layer.layer_duplicate), 1, fp);
-	fread(&layer.layer, sizeof(layer.layer), 1, fp);
-	fread(&layer.layer_size, sizeof(layer.layer_size), 1, fp);
-	layer.layer_size = swapl( layer.layer_size );
-	fread(&layer.samples, sizeof(layer.samples), 1, fp);
-	fread(&layer.reserved, sizeof(layer.reserved), 1, fp);
-	if (strcmp(header.gravis_id, "ID#000002") != 0) {
+	struct stat st;
+	byte *buf;
+	LoadRec rec;
+
+	if (fstat(fileno(fp), &st) < 0) {
 		fprintf(stderr, "Not a GUS patch file\n");
-		exit(1);
+		return -1;
+	}
+	/* the records are sent with the padding after the wave data
+	 * (see load_sample), so keep it readable at the end
+	 */
+	buf = grow_buffer(&file_buf, &file_buf_size,
+			  st.st_size + sizeof(struct patch_info));
+	if (fread(buf, 1, st.st_size, fp) != st.st_size) {
+		fprintf(stderr, "can't read GUS patch file\n");
+		return -1;
 	}
+	memset(buf + st.st_size, 0, sizeof(struct patch_info));
 
-	DEBUG(0,fprintf(stderr, "data size = %d\n", (int)header.data_size));
-
-	/* read sample information */
-	for (j = 0; j < layer.samples; j++) {
-		/* read sample information */
-		DEBUG(1,fprintf(stderr, "reading sample(%d)\n", j));
-		fread(&sample.wave_name, sizeof(sample.wave_name), 1, fp);
-		fread(&sample.fractions, sizeof(sample.fractions), 1, fp);
-		fread(&sample.wave_size, sizeof(sample.wave_size), 1, fp);
-		sample.wave_size = swapl( sample.wave_size );
-		fread(&sample.start_loop, sizeof(sample.start_loop), 1, fp);
-		fread(&sample.end_loop, sizeof(sample.end_loop), 1, fp);
-		fread(&sample.sample_rate, sizeof(sample.sample_rate), 1, fp);
-		sample.sample_rate = swapi( sample.sample_rate );
-		fread(&sample.low_frequency, sizeof(sample.low_frequency), 1, fp);
-		fread(&sample.high_frequency, sizeof(sample.high_frequency), 1, fp);
-		fread(&sample.root_frequency, sizeof(sample.root_frequency), 1, fp);
-		fread(&sample.tune, sizeof(sample.tune), 1, fp);
-		fread(&sample.balance, sizeof(sample.balance), 1, fp);
-		fread(&sample.envelope_rate, sizeof(sample.envelope_rate), 1, fp);
-		fread(&sample.envelope_offset, sizeof(sample.envelope_offset), 1, fp);
-		fread(&sample.tremolo_sweep, sizeof(sample.tremolo_sweep), 1, fp);
-		fread(&sample.tremolo_rate, sizeof(sample.tremolo_rate), 1, fp);
-		fread(&sample.tremolo_depth, sizeof(sample.tremolo_depth), 1, fp);
-		fread(&sample.vibrato_sweep, sizeof(sample.vibrato_sweep), 1, fp);
-		fread(&sample.vibrato_rate, sizeof(sample.vibrato_rate), 1, fp);
-		fread(&sample.vibrato_depth, sizeof(sample.vibrato_depth), 1, fp);
-		fread(&sample.modes, sizeof(sample.modes), 1, fp);
-		fread(&sample.scale_frequency, sizeof(sample.scale_frequency), 1, fp);
-		fread(&sample.scale_factor, sizeof(sample.scale_factor), 1, fp);
-		sample.scale_factor = swapi( sample.scale_factor );
-		fread(&sample.reserved, sizeof(sample.reserved), 1, fp);
-
-		DEBUG(1,fprintf(stderr, "-- sample len = %d\n",
-				(int)sample.wave_size));
-		/* allocate sound driver patch data */
-		len = sizeof(struct patch_info) + sample.wave_size - 1;
-		patch = (struct patch_info*)calloc(len, 1);
-		if (patch == NULL) {
-			fprintf(stderr, "can't allocate patch buffer\n");
-			exit(1);
-		}
-		patch->key = GUS_PATCH;
+	rec.preset = pre;
+	rec.keynote = key;
+	return awe_gus_parse(buf, st.st_size, load_sample, &rec);
+}
+
+/*
+ * load a sample as a voice record.
+ * data points the wave data in the file buffer.
+ * return 1 if loaded with the fixed key, 0 to continue, or -1 on error.
+ */
+static int load_sample(void *private, GusPatchHeader *hp, GusInstrument *ip,
+		       GusLayerData *lp, GusPatchData *sp, byte *data)
+{
+	LoadRec *lrec = (LoadRec*)private;
+	int len, hdrlen, key = lrec->keynote;
+	struct patch_info rec, *patch = &rec;
+	byte *buf;
+
+	DEBUG(1,fprintf(stderr, "-- sample len = %d\n",
+			(int)sp->wave_size));
+	len = sizeof(struct patch_info) + sp->wave_size - 1;
+	memset(patch, 0, sizeof(*patch));
+	patch->key = GUS_PATCH;
 #ifndef BUILD_AGUSLOAD
-		patch->device_no = awe_dev;
+	patch->device_no = awe_dev;
 #endif
-		if (preset >= 0)
-			patch->instr_no = preset;
-		else
-			patch->instr_no = ins.instrument;
-		DEBUG(0,fprintf(stderr,"-- preset=%d\n", patch->instr_no));
-		patch->mode = sample.modes;
-		DEBUG(0,fprintf(stderr,"-- sample_mode=0x%x\n", patch->mode));
-		patch->len = sample.wave_size;
-		patch->loop_start = sample.start_loop;
-		patch->loop_end = sample.end_loop;
-		DEBUG(1,fprintf(stderr,"-- loop position=%d/%d\n", patch->loop_start, patch->loop_end));
-		patch->base_freq = sample.sample_rate;
-		if (keynote != -1) {
-			/*int note = freq_to_note(sample.root_frequency);*/
-			int low = freq_to_note(sample.low_frequency);
-			int high = freq_to_note(sample.high_frequency);
-			if (keynote < low / 100 || high / 100 < keynote)
-				continue;
-			low = (low / 100) * 100;
-			patch->base_note = (int)(pow(2.0, (double)(keynote * 100 - low) / 1200.0) * sample.root_frequency);
-			patch->low_note = (int)(pow(2.0, (double)keynote / 12.0) * 8176.0);
-			patch->high_note = patch->low_note;
-		} else {
-			patch->base_note = sample.root_frequency;
-			patch->high_note = sample.high_frequency;
-			patch->low_note = sample.low_frequency;
-		}
-		DEBUG(0,fprintf(stderr,"-- base freq=%d, note=%d[%d] (%d[%d]-%d[%d])\n",
-				(int)patch->base_freq, (int)patch->base_note,
-				freq_to_note(patch->base_note)/100,
-				(int)patch->low_note,
-				freq_to_note(patch->low_note)/100,
-				(int)patch->high_note,
-				freq_to_note(patch->high_note)/100));
-		patch->panning = sample.balance;
-		patch->detuning = sample.tune;
-		memcpy(patch->env_rate, sample.envelope_rate, 6);
-		memcpy(patch->env_offset, sample.envelope_offset, 6);
-		if (sample.tremolo_rate > 0 && sample.tremolo_depth > 0)
-			patch->mode |= WAVE_TREMOLO;
-		patch->tremolo_sweep = sample.tremolo_sweep;
-		patch->tremolo_rate = sample.tremolo_rate;
-		patch->tremolo_depth = sample.tremolo_depth;
-		DEBUG(0,fprintf(stderr,"-- tremolo rate=%d, depth=%d\n",
-		      patch->tremolo_rate, patch->tremolo_depth));
-		if (sample.vibrato_rate > 0 && sample.vibrato_depth > 0)
-			patch->mode |= WAVE_VIBRATO;
-		patch->vibrato_sweep = sample.vibrato_sweep;
-		patch->vibrato_rate = sample.vibrato_rate;
-		patch->vibrato_depth = sample.vibrato_depth;
-		DEBUG(0,fprintf(stderr,"-- vibrato rate=%d, depth=%d\n",
-		      patch->vibrato_rate, patch->vibrato_depth));
-		patch->scale_frequency = sample.scale_frequency;
-		patch->scale_factor = sample.scale_factor;
-		patch->volume = header.master_volume;
+	patch->instr_no = lrec->preset >= 0 ? lrec->preset : ip->instrument;
+	DEBUG(0,fprintf(stderr,"-- preset=%d\n", patch->instr_no));
+	patch->mode = sp->modes;
+	DEBUG(0,fprintf(stderr,"-- sample_mode=0x%x\n", patch->mode));
+	patch->len = sp->wave_size;
+	patch->loop_start = sp->start_loop;
+	patch->loop_end = sp->end_loop;
+	DEBUG(1,fprintf(stderr,"-- loop position=%d/%d\n", patch->loop_start, patch->loop_end));
+	patch->base_freq = sp->sample_rate;
+	if (key != -1) {
+		int low = awe_freq_to_cent(sp->low_frequency) / 100;
+		int high = awe_freq_to_cent(sp->high_frequency) / 100;
+		if (key < low || high < key)
+			return 0;
+		patch->base_note = (int)(awe_semitone_ratio(key - low) * sp->root_frequency);
+		patch->low_note = awe_note_to_freq(key);
+		patch->high_note = patch->low_note;
+	} else {
+		patch->base_note = sp->root_frequency;
+		patch->high_note = sp->high_frequency;
+		patch->low_note = sp->low_frequency;
+	}
+	DEBUG(0,fprintf(stderr,"-- base freq=%d, note=%d[%d] (%d[%d]-%d[%d])\n",
+			(int)patch->base_freq, (int)patch->base_note,
+			awe_freq_to_cent(patch->base_note)/100,
+			(int)patch->low_note,
+			awe_freq_to_cent(patch->low_note)/100,
+			(int)patch->high_note,
+			awe_freq_to_cent(patch->high_note)/100));
+	patch->panning = sp->balance;
+	patch->detuning = sp->tune;
+	memcpy(patch->env_rate, sp->envelope_rate, 6);
+	memcpy(patch->env_offset, sp->envelope_offset, 6);
+	if (sp->tremolo_rate > 0 && sp->tremolo_depth > 0)
+		patch->mode |= WAVE_TREMOLO;
+	patch->tremolo_sweep = sp->tremolo_sweep;
+	patch->tremolo_rate = sp->tremolo_rate;
+	patch->tremolo_depth = sp->tremolo_depth;
+	DEBUG(0,fprintf(stderr,"-- tremolo rate=%d, depth=%d\n",
+	      patch->tremolo_rate, patch->tremolo_depth));
+	if (sp->vibrato_rate > 0 && sp->vibrato_depth > 0)
+		patch->mode |= WAVE_VIBRATO;
+	patch->vibrato_sweep = sp->vibrato_sweep;
+	patch->vibrato_rate = sp->vibrato_rate;
+	patch->vibrato_depth = sp->vibrato_depth;
+	DEBUG(0,fprintf(stderr,"-- vibrato rate=%d, depth=%d\n",
+	      patch->vibrato_rate, patch->vibrato_depth));
+	patch->scale_frequency = sp->scale_frequency;
+	patch->scale_factor = sp->scale_factor;
+	patch->volume = hp->master_volume;
 #if SOUND_VERSION > 301
-		patch->fractions = sample.fractions;
+	patch->fractions = sp->fractions;
 #endif
-		/* allocate raw sample buffer */
-		DEBUG(1,fprintf(stderr, "-- reading wave data\n"));
-		fread(patch->data, 1, patch->len, fp);
-
-		/* if -b option is specified, change the bank value */
-		if (bankchange >= 0) {
-			DEBUG(1,fprintf(stderr, "-- set bank number\n"));
-			seq_set_gus_bank(bankchange);
-		}
 
-		DEBUG(1,fprintf(stderr, "-- transferring\n"));
-		if (seq_load_rawpatch(patch, len) < 0) {
-			fprintf(stderr, "[Loading GUS %d]\n", j);
-			perror("Error in loading info");
-			exit(1);
-		}
-
-		/* free temporary buffer */
-		free(patch);
+	/* put the header just before the wave data, over the sample
+	 * header already parsed, so that the wave isn't copied.
+	 * otherwise, copy both to the patch buffer.
+	 */
+	hdrlen = offsetof(struct patch_info, data);
+	if (hdrlen <= GUS_PATCH_DATA_LEN)
+		buf = data - hdrlen;
+	else {
+		buf = grow_buffer(&patch_buf, &patch_buf_size, len);
+		memcpy(buf + hdrlen, data, patch->len);
+	}
+	memcpy(buf, patch, hdrlen);
 
-		/* exit loop if keynote is fixed */
-		if (keynote != -1)
-			break;
+	DEBUG(1,fprintf(stderr, "-- transferring\n"));
+	if (seq_load_rawpatch(buf, len) < 0) {
+		perror("Error in loading info");
+		return -1;
 	}
+	/* exit loop if keynote is fixed */
+	return key != -1 ? 1 : 0;
 }
-
@@ -74,6 +74,18 @@ LoadList *awe_merge_loadlist(LoadList *list, LoadList *old);
 /* free all list elements */
 void awe_free_loadlist(LoadList *p);
 
+/* hashed index of a loading list (looked up via map record) */
+typedef struct _AWELoadHash LoadHash;
+
+/* create an index of the list */
+LoadHash *awe_make_loadhash(LoadList *list);
+/* register an element prepended to the indexed list */
+void awe_loadhash_add(LoadHash *hash, LoadList *rec);
+/* search the first element matching with pat */
+LoadList *awe_loadhash_find(LoadHash *hash, SFPatchRec *pat, int loaded_only);
+/* free the index (not the list) */
+void awe_free_loadhash(LoadHash *hash);
+
 /*----------------------------------------------------------------
  * load a soundfont or virtual bank file
  *----------------------------------------------------------------
@@ -86,5 +98,38 @@ void awe_free_loadlist(LoadList *p);
 
 int awe_load_bank(AWEOps *ops, char *name, LoadList *list, int locked);
 
+/*----------------------------------------------------------------
+ * load only the preset mapping of a virtual bank
+ *----------------------------------------------------------------
+ * If the bank cache is enabled, the later awe_load_bank() calls on
+ * the same bank don't send the mapping again, until the bank file
+ * is changed.  Returns AWE_RET_OK for a soundfont file.
+ *----------------------------------------------------------------*/
+
+int awe_load_bank_map(AWEOps *ops, char *name, int locked);
+
+/*----------------------------------------------------------------
+ * compile a virtual bank file
+ *----------------------------------------------------------------
+ * The bank file 'name' is searched as well as awe_load_bank(), and
+ * the bank table is written to 'outfile' after expanding the included
+ * files and resolving the font paths.  If 'outfile' is NULL, the
+ * extension .bnk is replaced with .bnc.  awe_load_bank() reads the
+ * compiled bank instead of the bank file as long as it's up to date.
+ *----------------------------------------------------------------*/
+
+int awe_compile_bank(char *name, char *outfile);
+
+/*----------------------------------------------------------------
+ * keep soundfonts and bank tables resident
+ *----------------------------------------------------------------
+ * If enabled, the soundfont files and the virtual bank tables read
+ * by awe_load_bank() are kept in memory for the next call, as long as
+ * the files are unchanged.  Disabling the cache releases them.
+ *----------------------------------------------------------------*/
+
+void awe_set_bank_cache(int on);
+void awe_free_bank_cache(void);
+
 
 #endif	/* AWEBANK_H_DEF */
@@ -0,0 +1,37 @@
+/*----------------------------------------------------------------
+ * conversion between frequency and note
+ *
+ * Copyright (C) 1996-2003 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *----------------------------------------------------------------*/
+
+#ifndef FREQNOTE_H_DEF
+#define FREQNOTE_H_DEF
+
+/* the formulas; the tables made by mkfreqtab give the same values */
+#define FREQ_TO_CENT(mHz)	(log((double)(mHz) / 8176.0) / log(2.0) * 1200.0)
+#define SEMITONE_RATIO(n)	pow(2.0, (double)(n) / 12.0)
+
+/* frequency in mHz to cents of key number (truncated) */
+int awe_freq_to_cent(int mHz);
+/* frequency in mHz to cents of key number (rounded) */
+int awe_freq_to_cent_round(int mHz);
+/* frequency ratio of n semitones */
+double awe_semitone_ratio(int n);
+/* frequency in mHz of the key number */
+int awe_note_to_freq(int key);
+
+#endif
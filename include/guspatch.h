@@ -6,7 +6,9 @@
 #ifndef GUSPATCH_H_DEF
 #define GUSPATCH_H_DEF
 
+#include <stdio.h>
 #include "itypes.h"
+#include "sffile.h"
 
 #define GUS_ENVELOPES	6	
  
@@ -21,6 +23,12 @@
 #define GUS_LAYER_RESERVED_SIZE	40
 #define GUS_PATCH_DATA_RESERVED_SIZE	36
 #define GUS_GF1_HEADER_TEXT	"GF1PATCH110"
+
+/* record sizes in the file */
+#define GUS_PATCH_HEADER_LEN	129
+#define GUS_INSTRUMENT_LEN	63
+#define GUS_LAYER_LEN		47
+#define GUS_PATCH_DATA_LEN	96
  
 typedef struct
 {
@@ -98,4 +106,25 @@ typedef struct
 } GusPatchData;
 
 
+/*----------------------------------------------------------------
+ * functions
+ *----------------------------------------------------------------*/
+
+/* gusconv.c */
+
+/* called for each sample with the current headers in the file;
+ * data points the wave data in the file buffer.
+ * return 0 to continue, 1 to stop, or negative on error.
+ */
+typedef int (*GusLoader)(void *private, GusPatchHeader *hp, GusInstrument *ip,
+			 GusLayerData *lp, GusPatchData *sp, byte *data);
+
+int awe_gus_parse(byte *buf, long size, GusLoader loader, void *private);
+
+int awe_gus_begin_soundfont(SFInfo *sf, char *name, FILE *fout);
+int awe_gus_add_patch(SFInfo *sf, FILE *fout, FILE *fp, char *name,
+		      int bank, int preset, int keynote);
+int awe_gus_end_soundfont(SFInfo *sf, FILE *fout);
+
+
 #endif
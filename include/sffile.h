@@ -120,9 +120,28 @@ typedef struct _SFInfo {
 /* sffile.c */
 int awe_load_soundfont(SFInfo *sf, FILE *fp, int is_seekable);
 void awe_free_soundfont(SFInfo *sf);
-void awe_save_soundfont(SFInfo *sf, FILE *fin, FILE *fout);
+int awe_save_soundfont(SFInfo *sf, FILE *fin, FILE *fout);
 void awe_load_textinfo(SFInfo *sf, FILE *fp);
 
+/* sfcheck.c */
+int awe_check_soundfont(FILE *fp, int verbose);
+
+/* sfedit.c */
+int awe_sf_find_preset(SFInfo *sf, int bank, int preset);
+int awe_sf_find_inst(SFInfo *sf, char *name);
+SFGenRec *awe_sf_get_gen(SFGenLayer *lay, int oper);
+int awe_sf_set_gen(SFGenLayer *lay, int oper, int amount);
+int awe_sf_remove_gen(SFGenLayer *lay, int oper);
+int awe_sf_set_hdr_gen(SFHeader *hdr, int oper, int amount);
+int awe_sf_remove_hdr_gen(SFHeader *hdr, int oper);
+void awe_sf_rename(SFHeader *hdr, char *name);
+int awe_sf_set_font_name(SFInfo *sf, char *name);
+int awe_sf_remap_preset(SFInfo *sf, int bank, int preset, int newbank, int newpreset);
+int awe_sf_save_file(SFInfo *sf, char *orig, char *outfile);
+
+/* max size of INAM chunk including the terminator */
+#define SF_NAME_MAX	256
+
 /* sample.c */
 void awe_correct_samples(SFInfo *sf);
 
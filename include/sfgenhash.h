@@ -0,0 +1,33 @@
+/*================================================================
+ * sfgenhash.h:
+ *	hash function for generator names
+ *
+ * Copyright (C) 1996-1999 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *================================================================*/
+
+#ifndef SFGENHASH_H_DEF
+#define SFGENHASH_H_DEF
+
+/*
+ * The seed and the table are chosen by mkgenhash so that all names
+ * in sf_gen_text have different hash keys.
+ */
+
+/* FNV-1a from the given seed; the upper bits are used as the key */
+unsigned int sf_gen_hash(const char *str, unsigned int seed, int bits);
+
+#endif
@@ -95,6 +95,7 @@ enum {
 
 /* name strings */
 extern char *sf_gen_text[SF_EOF];
+int sf_gen_index(char *str);
 
 
 /*----------------------------------------------------------------
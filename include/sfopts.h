@@ -45,6 +45,8 @@ extern sf_options awe_option;
 void awe_read_option_file(char *fname);
 int awe_parse_options(int argc, char **argv, char *optflags,
 		      struct option *long_opts, int *optidx);
+int awe_skip_options(int argc, char **argv, char *optflags,
+		     struct option *long_opts);
 
 #define AWE_BASE_OPTIONS	"b:c:r:P:A:a:d:V:BC"
 
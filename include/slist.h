@@ -1,6 +1,6 @@
 /*================================================================
  * slist.h:
- *	S-expression list
+ *	S-expression token reader
  *
  * Copyright (C) 1996-1999 Takashi Iwai
  *
@@ -22,45 +22,17 @@
 #ifndef SLIST_H_DEF
 #define SLIST_H_DEF
 
-enum { S_ATOM_NIL, S_ATOM_LIST, S_ATOM_CHR, S_ATOM_INT, S_ATOM_STR, S_ATOM_FUN, };
-
-typedef struct _SAtom *SList;
-
 typedef union {
 	char c;
 	int i;
 	char *s;
 	char *f;
-	SList p;
 } SAtomVal;
 
-typedef struct _SAtom {
-	int type;
-	SAtomVal val, nxt;
-} SAtom;
-
-SList SCons(void);
-SList SReadFile(FILE *fp);
-void SFree(SList);
-
-#define NIL	(SList)0
-
-#define SIsNil(at)	((at)->type == S_ATOM_NIL)
-#define SListP(at)	((at)->type == S_ATOM_LIST)
-#define SChrP(at)	((at)->type == S_ATOM_CHR)
-#define SIntP(at)	((at)->type == S_ATOM_INT)
-#define SStrP(at)	((at)->type == S_ATOM_STR)
-#define SFunP(at)	((at)->type == S_ATOM_FUN)
-
-#define SCar(at)	((at)->val.p)
-#define SCdr(at)	((at)->nxt.p)
-
-#define SChr(at)	((at)->val.c)
-#define SStr(at)	((at)->val.s)
-#define SInt(at)	((at)->val.i)
-#define SFun(at)	((at)->val.f)
-#define SFunIs(at,fun)	(strcmp(SFun(at),fun) == 0)
-
-int SIndex(SList);
+/* token reader */
+enum { S_TOKEN_EOF, S_TOKEN_OPEN, S_TOKEN_CLOSE, S_TOKEN_CHR, S_TOKEN_INT,
+       S_TOKEN_STR, S_TOKEN_FUN, };
+int SReadToken(FILE *fp, SAtomVal *val);
+void SReadDone(FILE *fp);
 
 #endif
@@ -48,6 +48,7 @@ void CmpAddList(char *ext, char *format);
 
 /* malloc.c */
 void *safe_malloc(int size);
+void *safe_realloc(void *ptr, int size);
 void safe_free(void *ptr);
 char *safe_strdup(char *src);
 
@@ -62,6 +63,7 @@ void fskip(int size, FILE *fd, int seekable);
 
 /* path.c */
 int awe_search_file_name(char *fresult, int maxlen, char *fname, char *path, char **ext);
+void awe_clear_path_cache(void);
 
 
 #endif
@@ -0,0 +1,251 @@
+/*
+ * on-demand preset loading via ALSA sequencer
+ *
+ * Copyright (C) 2003 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ */
+
+/*
+ * The presets are loaded when the program change event arrives on
+ * the sequencer port.  If the DRAM becomes short, the unlocked samples
+ * are removed, and the recently used presets are loaded again as many
+ * as possible.  The driver can remove only all unlocked samples at
+ * once, so the least recently used presets are evicted by reloading
+ * the others.  The preset mapping of a virtual bank is sent only once
+ * at the beginning, and locked, so that it survives the eviction.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <alsa/asoundlib.h>
+#include <util.h>
+#include <awebank.h>
+#include "seq.h"
+
+#define DRUM_CHANNEL	9
+#define DRUM_BANK	128
+
+/* requested preset */
+typedef struct _DemandRec {
+	SFPatchRec pat;
+	int size;		/* used DRAM in bytes when loaded */
+	int loaded;
+	unsigned int stamp;	/* last time used */
+	struct _DemandRec *next;
+} DemandRec;
+
+static DemandRec *demands;
+static int ndemands;
+static unsigned int cur_stamp;
+static LoadList *locked_list;
+
+static int load_preset(AWEOps *ops, char *name, DemandRec *d);
+static void request_preset(AWEOps *ops, char *name, int preset, int bank, int reserve);
+static void evict_presets(AWEOps *ops, char *name, int reserve);
+
+
+/*----------------------------------------------------------------
+ * wait for events and load presets
+ *----------------------------------------------------------------
+ * name = soundfont or virtual bank file
+ * locked = presets to be loaded and locked in advance (NULL = none)
+ * source = sequencer port to be connected (NULL = none)
+ * reserve = DRAM size to be kept free, in bytes
+ *----------------------------------------------------------------*/
+
+int seq_ondemand_loop(AWEOps *ops, char *name, LoadList *locked, char *source, int reserve)
+{
+	snd_seq_t *seq;
+	snd_seq_event_t *ev;
+	snd_seq_addr_t addr;
+	int port, ch, err, rc;
+	int bank[16];
+
+	if ((err = snd_seq_open(&seq, "default", SND_SEQ_OPEN_INPUT, 0)) < 0) {
+		fprintf(stderr, "can't open sequencer: %s\n", snd_strerror(err));
+		return AWE_RET_ERR;
+	}
+	snd_seq_set_client_name(seq, "asfxload");
+	port = snd_seq_create_simple_port(seq, "on-demand loader",
+					  SND_SEQ_PORT_CAP_WRITE |
+					  SND_SEQ_PORT_CAP_SUBS_WRITE,
+					  SND_SEQ_PORT_TYPE_MIDI_GENERIC |
+					  SND_SEQ_PORT_TYPE_APPLICATION);
+	if (port < 0) {
+		fprintf(stderr, "can't create port: %s\n", snd_strerror(port));
+		snd_seq_close(seq);
+		return AWE_RET_ERR;
+	}
+	if (source) {
+		if (snd_seq_parse_address(seq, &addr, source) < 0 ||
+		    snd_seq_connect_from(seq, port, addr.client, addr.port) < 0) {
+			fprintf(stderr, "can't connect to port %s\n", source);
+			snd_seq_close(seq);
+			return AWE_RET_ERR;
+		}
+	}
+	DEBUG(0,fprintf(stderr, "waiting events on port %d:%d\n",
+			snd_seq_client_id(seq), port));
+
+	locked_list = locked;
+	awe_set_bank_cache(TRUE);
+	rc = awe_load_bank_map(ops, name, TRUE);
+	if (rc != AWE_RET_OK && rc != AWE_RET_SKIP) {
+		fprintf(stderr, "can't load the preset mapping of %s\n", name);
+		awe_set_bank_cache(FALSE);
+		snd_seq_close(seq);
+		return AWE_RET_ERR;
+	}
+	/* loaded from the cached bank, so the mapping isn't sent again */
+	if (locked) {
+		rc = awe_load_bank(ops, name, locked, TRUE);
+		if (rc != AWE_RET_OK && rc != AWE_RET_SKIP) {
+			fprintf(stderr, "can't load the locked presets of %s\n", name);
+			awe_set_bank_cache(FALSE);
+			snd_seq_close(seq);
+			return AWE_RET_ERR;
+		}
+	}
+	for (ch = 0; ch < 16; ch++)
+		bank[ch] = 0;
+
+	for (;;) {
+		err = snd_seq_event_input(seq, &ev);
+		if (err == -EAGAIN || err == -ENOSPC)
+			continue;
+		if (err < 0) {
+			fprintf(stderr, "can't read event: %s\n", snd_strerror(err));
+			break;
+		}
+		ch = ev->data.control.channel & 0x0f;
+		switch (ev->type) {
+		case SND_SEQ_EVENT_CONTROLLER:
+			if (ev->data.control.param == MIDI_CTL_MSB_BANK)
+				bank[ch] = ev->data.control.value & 0x7f;
+			break;
+		case SND_SEQ_EVENT_PGMCHANGE:
+			request_preset(ops, name, ev->data.control.value & 0x7f,
+				       ch == DRUM_CHANNEL ? DRUM_BANK : bank[ch],
+				       reserve);
+			break;
+		}
+	}
+
+	awe_set_bank_cache(FALSE);
+	snd_seq_close(seq);
+	return AWE_RET_ERR;
+}
+
+
+/*----------------------------------------------------------------
+ * load the requested preset
+ *----------------------------------------------------------------*/
+
+static void request_preset(AWEOps *ops, char *name, int preset, int bank, int reserve)
+{
+	DemandRec *d;
+	LoadList *p;
+	SFPatchRec pat;
+	int rc;
+
+	pat.preset = preset;
+	pat.bank = bank;
+	pat.keynote = -1;
+	for (p = locked_list; p; p = p->next) {
+		if (awe_match_preset(&pat, &p->map))
+			return;
+	}
+
+	for (d = demands; d; d = d->next) {
+		if (d->pat.preset == preset && d->pat.bank == bank)
+			break;
+	}
+	if (d == NULL) {
+		d = (DemandRec*)safe_malloc(sizeof(DemandRec));
+		d->pat = pat;
+		d->next = demands;
+		demands = d;
+		ndemands++;
+	}
+	d->stamp = ++cur_stamp;
+	if (d->loaded)
+		return;
+
+	rc = load_preset(ops, name, d);
+	if (rc == AWE_RET_NOMEM || (reserve > 0 && ops->mem_avail() < reserve))
+		evict_presets(ops, name, reserve);
+}
+
+/* load a preset on the driver and remember the used memory */
+static int load_preset(AWEOps *ops, char *name, DemandRec *d)
+{
+	LoadList *list;
+	int rc, avail;
+
+	DEBUG(1,fprintf(stderr, "loading preset %d/%d\n", d->pat.preset, d->pat.bank));
+	list = awe_add_loadlist(NULL, &d->pat, NULL);
+	avail = ops->mem_avail();
+	rc = awe_load_bank(ops, name, list, FALSE);
+	awe_free_loadlist(list);
+	if (rc == AWE_RET_OK || rc == AWE_RET_SKIP) {
+		/* missing presets are not requested again */
+		d->loaded = TRUE;
+		d->size = avail - ops->mem_avail();
+		if (d->size < 0)
+			d->size = 0;
+	}
+	return rc;
+}
+
+static int compare_stamp(const void *a, const void *b)
+{
+	unsigned int sa = (*(DemandRec**)a)->stamp;
+	unsigned int sb = (*(DemandRec**)b)->stamp;
+	return sa < sb ? 1 : (sa > sb ? -1 : 0);
+}
+
+/* remove the unlocked samples, and reload the presets from the
+ * recently used ones while the memory is available
+ */
+static void evict_presets(AWEOps *ops, char *name, int reserve)
+{
+	DemandRec **list, *d;
+	int i, n, avail;
+
+	DEBUG(0,fprintf(stderr, "DRAM is short; removing samples\n"));
+	ops->remove_samples();
+
+	list = (DemandRec**)safe_malloc(sizeof(DemandRec*) * ndemands);
+	for (n = 0, d = demands; d; d = d->next) {
+		d->loaded = FALSE;
+		list[n++] = d;
+	}
+	qsort(list, n, sizeof(DemandRec*), compare_stamp);
+
+	avail = ops->mem_avail();
+	for (i = 0; i < n; i++) {
+		d = list[i];
+		/* skip the preset known to be too large */
+		if (d->size > 0 && avail - d->size < reserve)
+			continue;
+		if (load_preset(ops, name, d) == AWE_RET_NOMEM)
+			break;
+		if ((avail = ops->mem_avail()) < reserve)
+			break;
+	}
+	safe_free(list);
+}
@@ -22,6 +22,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <unistd.h>
+#include <string.h>
 #include <sys/time.h>
 #include <sys/ioctl.h>
 #include <math.h>
@@ -35,19 +36,111 @@
 #include <util.h>
 #include "seq.h"
 
-SEQ_DEFINEBUF(128);
+/*
+ * event buffer; this replaces SEQ_DEFINEBUF(128) so that the buffer
+ * size can be changed.  the macros in soundcard.h call seqbuf_dump()
+ * when the events exceed _seqbuflen, and the buffer is written out
+ * there.  in batch mode, the buffer is enlarged instead.
+ */
+#define SEQ_BUFLEN	128
+#define SEQ_EVENT_MAX	8	/* the longest event in soundcard.h */
+
+static unsigned char seq_defbuf[SEQ_BUFLEN];
+unsigned char *_seqbuf = seq_defbuf;
+int _seqbuflen = SEQ_BUFLEN;
+int _seqbufptr = 0;
+static int seq_bufsize = SEQ_BUFLEN;	/* allocated size */
+static int seq_threshold = SEQ_BUFLEN;	/* size to write out */
+static int seq_batch;
+
+/* statistics of written events */
+static int seq_nwrites;
+static long seq_nbytes;
+
 int seqfd;
 
-void seqbuf_dump()
+/* write out the buffered events */
+void seq_flush(void)
 {
-	if (_seqbufptr)
+	if (_seqbufptr) {
 		if (write(seqfd, _seqbuf, _seqbufptr) == -1) {
 			perror("write device");
 			exit(-1);
 		}
+		seq_nwrites++;
+		seq_nbytes += _seqbufptr;
+	}
 	_seqbufptr = 0;
 }
 
+/* write out the buffered events, and wait until they are played */
+void seq_sync(void)
+{
+	seq_flush();
+	ioctl(seqfd, SNDCTL_SEQ_SYNC);
+}
+
+/* enlarge the buffer to the given size */
+static void seq_grow_buffer(int size)
+{
+	if (size <= seq_bufsize)
+		return;
+	if (_seqbuf == seq_defbuf) {
+		_seqbuf = (unsigned char*)safe_malloc(size);
+		memcpy(_seqbuf, seq_defbuf, _seqbufptr);
+	} else
+		_seqbuf = (unsigned char*)safe_realloc(_seqbuf, size);
+	seq_bufsize = size;
+}
+
+/* in batch mode, the buffer is enlarged instead of written */
+void seqbuf_dump()
+{
+	if (! seq_batch) {
+		seq_flush();
+		return;
+	}
+	if (_seqbufptr + SEQ_EVENT_MAX <= _seqbuflen)
+		return;
+	seq_grow_buffer(_seqbuflen * 2);
+	_seqbuflen *= 2;
+}
+
+/* set the size of events to be written at once */
+void seq_set_buffer_size(int size)
+{
+	if (size < SEQ_EVENT_MAX)
+		size = SEQ_EVENT_MAX;
+	seq_flush();
+	seq_grow_buffer(size);
+	seq_threshold = size;
+	if (! seq_batch)
+		_seqbuflen = size;
+	else if (_seqbuflen < size)
+		_seqbuflen = size;
+}
+
+/* get the number of writes and the written bytes */
+void seq_get_stats(int *nwrites, long *nbytes)
+{
+	*nwrites = seq_nwrites;
+	*nbytes = seq_nbytes;
+}
+
+/* accumulate all events until seq_batch_end() */
+void seq_batch_begin(void)
+{
+	seq_batch = 1;
+}
+
+/* write all accumulated events at once */
+void seq_batch_end(void)
+{
+	seq_batch = 0;
+	seq_flush();
+	_seqbuflen = seq_threshold;
+}
+
 
 #define MAX_CARDS	16
 int awe_dev;
@@ -123,7 +216,7 @@ int seq_reset_samples(void)
 
 void seq_end(void)
 {
-	SEQ_DUMPBUF();
+	seq_flush();
 	/*ioctl(seqfd, SNDCTL_SEQ_SYNC);*/
 	close(seqfd);
 }
@@ -137,13 +230,13 @@ int seq_remove_samples(void)
 void seq_default_atten(int val)
 {
 	AWE_MISC_MODE(awe_dev, AWE_MD_ZERO_ATTEN, val);
-	SEQ_DUMPBUF();
+	seq_flush();
 }
 
 void seq_set_gus_bank(int bank)
 {
 	AWE_SET_GUS_BANK(awe_dev, bank);
-	SEQ_DUMPBUF();
+	seq_flush();
 }
 
 int seq_load_rawpatch(void *patch, int len)
@@ -154,7 +247,7 @@ int seq_load_rawpatch(void *patch, int len)
 int seq_load_patch(void *patch, int len)
 {
 	awe_patch_info *p;
-	SEQ_DUMPBUF();
+	seq_flush();
 	p = (awe_patch_info*)patch;
 	p->key = AWE_PATCH;
 	p->device_no = awe_dev;
@@ -23,6 +23,9 @@
 #define SEQ_H_DEF
 
 extern int seqfd;
+/* event buffer of seq.c; use this instead of SEQ_USE_EXTBUF() */
+extern unsigned char *_seqbuf;
+extern int _seqbuflen, _seqbufptr;
 /*extern int nrsynths;*/
 extern int awe_dev;
 /*extern int max_synth_voices;*/
@@ -40,9 +43,22 @@ void seq_set_gus_bank(int bank);
 int seq_load_patch(void *patch, int len);
 int seq_load_rawpatch(void *patch, int len);
 int seq_mem_avail(void);
+void seq_flush(void);
+void seq_sync(void);
+void seq_set_buffer_size(int size);
+void seq_get_stats(int *nwrites, long *nbytes);
+void seq_batch_begin(void);
+void seq_batch_end(void);
 
 /* alsa.c */
 void seq_alsa_init(char *hwdep);
 void seq_alsa_end(void);
+int seq_misc_mode(int mode, int value);
+
+/* ondemand.c */
+struct _AWEOps;
+struct _AWELoadList;
+int seq_ondemand_loop(struct _AWEOps *ops, char *name, struct _AWELoadList *locked,
+		      char *source, int reserve);
 
 #endif
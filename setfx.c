@@ -23,6 +23,11 @@
 #include <string.h>
 #include <ctype.h>
 #include <stdlib.h>
+#include <limits.h>
+#include <sys/stat.h>
+#ifdef BUILD_ASETFX
+#include <alsa/asoundlib.h>
+#endif
 #ifdef __FreeBSD__
 #  include <machine/soundcard.h>
 #elif defined(linux)
@@ -43,14 +48,41 @@ static char *gettok(FILE *fp);
 static char *divtok(char *src, char *divs, int only_one);
 static int htoi(char *p);
 
+static void read_config(FILE *fp);
 static void read_chorus(int mode, char *name, int incl, FILE *fp);
 static void read_reverb(int mode, char *name, int incl, FILE *fp);
+static void add_fx(int type, int mode);
+static int upload_fx(void);
+
+static int compiled_fx_name(char *dst, int maxlen, char *path);
+static int write_compiled_fx(char *outfile, char *srcpath);
+static int read_compiled_fx(char *path, char *srcpath, int maxlen, char *config);
 
 /*----------------------------------------------------------------*/
 
 static char chorus_defined[AWE_CHORUS_NUMBERS] = {1,1,1,1,1,1,1,1,};
 static char reverb_defined[AWE_CHORUS_NUMBERS] = {1,1,1,1,1,1,1,1,};
 
+/* user defined modes in the order of definition;
+ * a mode defined twice is sent only once with the last values
+ */
+#define FX_CHORUS	0
+#define FX_REVERB	1
+
+typedef struct _FxRec {
+	int type, mode;
+} FxRec;
+
+static FxRec fx_list[AWE_CHORUS_NUMBERS + AWE_REVERB_NUMBERS];
+static int fx_count;
+
+#ifdef BUILD_ASETFX
+static char *hwdep_name = NULL;
+#else
+static char *seq_devname = NULL;
+static int seq_devidx = -1;
+#endif
+
 char *progname;
 int verbose = 0;
 
@@ -63,23 +95,40 @@ static int connected;
 
 static void usage(void)
 {
+#ifdef BUILD_ASETFX
+	fprintf(stderr, "asetfx -- load user defined chorus / reverb mode effects on ALSA Emux WaveTable\n");
+	fprintf(stderr, VERSION_NOTE);
+	fprintf(stderr, "usage:	asetfx [-options] config-file\n");
+	fprintf(stderr, " -D name     specify the hwdep name\n");
+#else
 	fprintf(stderr, "setfx -- load user defined chorus / reverb mode effects\n");
 	fprintf(stderr, VERSION_NOTE);
-	fprintf(stderr, "usage:	setfx config-file\n");
+	fprintf(stderr, "usage:	setfx [-options] config-file\n");
+	fprintf(stderr, " -F file     specify the device file\n");
+	fprintf(stderr, " -D number   specify the device index (-1=autoprobe)\n");
+#endif
+	fprintf(stderr, " -c          compile the config file, and exit\n");
+	fprintf(stderr, " -o file     set the compiled file name (default is .fxc)\n");
 #ifdef DEFAULT_SF_PATH
 	fprintf(stderr, "   system default path is %s\n", DEFAULT_SF_PATH);
 #endif
 	exit(1);
 }
 
+#ifdef BUILD_ASETFX
+#define OPTION_FLAGS	"D:co:"
+#else
+#define OPTION_FLAGS	"F:D:co:"
+#endif
+
 int main(int argc, char **argv)
 {
 	char *default_sf_path;
-	char sfname[500];
+	char sfname[500], cname[500], srcname[PATH_MAX];
+	char abspath[PATH_MAX], *config;
 	FILE *fp;
-	int c;
-	char *seq_devname = NULL;
-	int seq_devidx = -1;
+	int c, rc, compile = FALSE;
+	char *outfile = NULL;
 
 	/* set program name */
 	progname = strrchr(argv[0], '/');
@@ -88,14 +137,27 @@ int main(int argc, char **argv)
 	else
 		progname++;
 
-	while ((c = getopt(argc, argv, "F:D:")) != -1) {
+	while ((c = getopt(argc, argv, OPTION_FLAGS)) != -1) {
 		switch (c) {
+#ifdef BUILD_ASETFX
+		case 'D':
+			hwdep_name = optarg;
+			break;
+#else
 		case 'F':
 			seq_devname = optarg;
 			break;
 		case 'D':
 			seq_devidx = atoi(optarg);
 			break;
+#endif
+		case 'c':
+			compile = TRUE;
+			break;
+		case 'o':
+			outfile = optarg;
+			compile = TRUE;
+			break;
 		default:
 			usage();
 			exit(1);
@@ -120,16 +182,67 @@ int main(int argc, char **argv)
 		return 1;
 	}
 
+	/* use the compiled config as long as the config is unchanged */
+	if (! compile && compiled_fx_name(cname, sizeof(cname), sfname)) {
+		/* the compiled config must be made from the given config */
+		config = NULL;
+		if (strcmp(cname, sfname) != 0) {
+			if (realpath(sfname, abspath) == NULL) {
+				fprintf(stderr, "%s: can't open %s\n", progname, sfname);
+				return 1;
+			}
+			config = abspath;
+		}
+		rc = read_compiled_fx(cname, srcname, sizeof(srcname), config);
+		if (rc > 0)
+			return upload_fx() < 0;
+		if (strcmp(cname, sfname) == 0) {
+			/* the compiled config was given */
+			if (rc == 0) {
+				fprintf(stderr, "%s: invalid compiled file %s\n",
+					progname, cname);
+				return 1;
+			}
+			fprintf(stderr, "%s: %s is obsolete; reading %s\n",
+				progname, cname, srcname);
+			strcpy(sfname, srcname);
+		}
+	}
+
 	if ((fp = fopen(sfname, "r")) == NULL) {
 		fprintf(stderr, "%s: can't open %s\n", progname, sfname);
 		return 1;
 	}
+	read_config(fp);
+	fclose(fp);
+
+	if (compile) {
+		if (outfile == NULL) {
+			if (! compiled_fx_name(cname, sizeof(cname), sfname) ||
+			    strcmp(cname, sfname) == 0) {
+				fprintf(stderr, "%s: can't make compiled file name for %s\n",
+					progname, sfname);
+				return 1;
+			}
+			outfile = cname;
+		}
+		return write_compiled_fx(outfile, sfname) < 0;
+	}
+
+	rc = upload_fx();
+	return rc < 0;
+}
+
+
+/*----------------------------------------------------------------
+ * read the config file
+ *----------------------------------------------------------------*/
 
+static void read_config(FILE *fp)
+{
 	curline = 0;
 	if (!my_getline(fp))
-		return 0;
-
-	seq_init(seq_devname, seq_devidx);
+		return;
 
 	do {
 		int chorus, mode, incl;
@@ -192,10 +305,6 @@ int main(int argc, char **argv)
 			read_reverb(mode, name, incl, fp);
 
 	} while (nextline(fp));
-
-	fclose(fp);
-	seq_end();
-	return 0;
 }
 
 
@@ -274,10 +383,6 @@ static void read_reverb(int mode, char *name, int incl, FILE *fp)
 {
 	char *p;
 	int i, val;
-	struct reverb_pat {
-		awe_patch_info patch;
-		awe_reverb_fx_rec v;
-	} r;
 
 	if (incl >= 0) {
 		/* include from pre-defined mode */
@@ -317,12 +422,7 @@ static void read_reverb(int mode, char *name, int incl, FILE *fp)
 			reverb_parm[mode].parms[i] = val;
 		}
 	}
-	r.patch.optarg = mode;
-	r.patch.len = sizeof(awe_reverb_fx_rec);
-	r.patch.type = AWE_LOAD_REVERB_FX;
-	r.v = reverb_parm[mode];
-	seq_load_patch(&r, sizeof(r));
-
+	add_fx(FX_REVERB, mode);
 	reverb_defined[mode] = 1;
 }
 
@@ -334,10 +434,6 @@ static void read_chorus(int mode, char *name, int incl, FILE *fp)
 {
 	char *p;
 	int i, val;
-	struct chorus_pat {
-		awe_patch_info patch;
-		awe_chorus_fx_rec v;
-	} c;
 
 	/* define all five parameters */
 	for (i = 0; i < 5; i++) {
@@ -356,16 +452,305 @@ static void read_chorus(int mode, char *name, int incl, FILE *fp)
 		}
 	}
 
-	c.patch.optarg = mode;
-	c.patch.len = sizeof(awe_chorus_fx_rec);
-	c.patch.type = AWE_LOAD_CHORUS_FX;
-	c.v = chorus_parm[mode];
-	seq_load_patch(&c, sizeof(c));
-
+	add_fx(FX_CHORUS, mode);
 	chorus_defined[mode] = 1;
 }
 
 
+/*----------------------------------------------------------------
+ * upload the user defined modes
+ *----------------------------------------------------------------*/
+
+struct chorus_pat {
+	awe_patch_info patch;
+	awe_chorus_fx_rec v;
+};
+
+struct reverb_pat {
+	awe_patch_info patch;
+	awe_reverb_fx_rec v;
+};
+
+/* append the mode to the list unless already defined */
+static void add_fx(int type, int mode)
+{
+	int i;
+	for (i = 0; i < fx_count; i++) {
+		if (fx_list[i].type == type && fx_list[i].mode == mode)
+			return;
+	}
+	fx_list[fx_count].type = type;
+	fx_list[fx_count].mode = mode;
+	fx_count++;
+}
+
+/*
+ * all records are built in a buffer before opening the device, and
+ * sent in order.  the sequencer takes only one patch record per write,
+ * so they can't be merged into a single write.
+ */
+static int upload_fx(void)
+{
+	char *buf, *p;
+	int i, len, rc;
+
+	if (fx_count == 0)
+		return 0;
+	len = 0;
+	for (i = 0; i < fx_count; i++) {
+		if (fx_list[i].type == FX_CHORUS)
+			len += sizeof(struct chorus_pat);
+		else
+			len += sizeof(struct reverb_pat);
+	}
+	buf = (char*)safe_malloc(len);
+	p = buf;
+	for (i = 0; i < fx_count; i++) {
+		int mode = fx_list[i].mode;
+		if (fx_list[i].type == FX_CHORUS) {
+			struct chorus_pat *c = (struct chorus_pat*)p;
+			memset(&c->patch, 0, sizeof(c->patch));
+			c->patch.optarg = mode;
+			c->patch.len = sizeof(awe_chorus_fx_rec);
+			c->patch.type = AWE_LOAD_CHORUS_FX;
+			c->v = chorus_parm[mode];
+			p += sizeof(*c);
+		} else {
+			struct reverb_pat *r = (struct reverb_pat*)p;
+			memset(&r->patch, 0, sizeof(r->patch));
+			r->patch.optarg = mode;
+			r->patch.len = sizeof(awe_reverb_fx_rec);
+			r->patch.type = AWE_LOAD_REVERB_FX;
+			r->v = reverb_parm[mode];
+			p += sizeof(*r);
+		}
+	}
+
+#ifdef BUILD_ASETFX
+	seq_alsa_init(hwdep_name);
+#else
+	seq_init(seq_devname, seq_devidx);
+#endif
+	rc = 0;
+	for (p = buf, i = 0; i < fx_count; i++) {
+		len = fx_list[i].type == FX_CHORUS ?
+			sizeof(struct chorus_pat) : sizeof(struct reverb_pat);
+		if (seq_load_patch(p, len) < 0) {
+			fprintf(stderr, "%s: can't load %s mode %d\n", progname,
+				fx_list[i].type == FX_CHORUS ? "chorus" : "reverb",
+				fx_list[i].mode);
+			rc = -1;
+		}
+		p += len;
+	}
+#ifdef BUILD_ASETFX
+	seq_alsa_end();
+#else
+	seq_end();
+#endif
+	safe_free(buf);
+	return rc;
+}
+
+
+/*----------------------------------------------------------------
+ * compiled config file
+ *
+ * The compiled config (.fxc) keeps the user defined modes in the
+ * order to be sent.  It's used in place of the config file of the
+ * same name as long as the config file is unchanged.
+ *
+ * Each value is stored as a 32bit little endian integer, and each
+ * string as its length followed by the letters:
+ *
+ *	magic, version, (absolute path, mtime, size) of the config file,
+ *	number of modes, (type, mode, number of parameters,
+ *	parameters) of each mode
+ *----------------------------------------------------------------*/
+
+#define FXC_MAGIC	"AWEFXC"
+#define FXC_VERSION	1
+
+#define CHORUS_PARMS	5
+#define REVERB_PARMS	28
+
+/* make the name of compiled config from the config file name */
+static int compiled_fx_name(char *dst, int maxlen, char *path)
+{
+	char *p;
+	int len;
+
+	if ((p = strrchr(path, '.')) == NULL || strchr(p, '/') != NULL)
+		len = strlen(path);
+	else
+		len = p - path;
+	if (len + 5 > maxlen)
+		return FALSE;
+	memcpy(dst, path, len);
+	strcpy(dst + len, ".fxc");
+	return TRUE;
+}
+
+static void put_int(FILE *fp, int val)
+{
+	putc(val & 0xff, fp);
+	putc((val >> 8) & 0xff, fp);
+	putc((val >> 16) & 0xff, fp);
+	putc((val >> 24) & 0xff, fp);
+}
+
+static void put_string(FILE *fp, char *str)
+{
+	int len = str ? strlen(str) : 0;
+	put_int(fp, len);
+	if (len > 0)
+		fwrite(str, 1, len, fp);
+}
+
+/* write the parsed modes to the compiled config */
+static int write_compiled_fx(char *outfile, char *srcpath)
+{
+	struct stat st;
+	char abspath[PATH_MAX];
+	FILE *fp;
+	int i, j, rc;
+
+	/* the path is stored absolute, so that it's valid from any cwd */
+	if (realpath(srcpath, abspath) == NULL || stat(abspath, &st) < 0) {
+		fprintf(stderr, "%s: can't stat %s\n", progname, srcpath);
+		return -1;
+	}
+	if ((fp = fopen(outfile, "w")) == NULL) {
+		fprintf(stderr, "%s: can't create %s\n", progname, outfile);
+		return -1;
+	}
+
+	fwrite(FXC_MAGIC, 1, strlen(FXC_MAGIC), fp);
+	put_int(fp, FXC_VERSION);
+	put_string(fp, abspath);
+	put_int(fp, (int)st.st_mtime);
+	put_int(fp, (int)st.st_size);
+
+	put_int(fp, fx_count);
+	for (i = 0; i < fx_count; i++) {
+		int mode = fx_list[i].mode;
+		put_int(fp, fx_list[i].type);
+		put_int(fp, mode);
+		if (fx_list[i].type == FX_CHORUS) {
+			put_int(fp, CHORUS_PARMS);
+			put_int(fp, chorus_parm[mode].feedback);
+			put_int(fp, chorus_parm[mode].delay_offset);
+			put_int(fp, chorus_parm[mode].lfo_depth);
+			put_int(fp, chorus_parm[mode].delay);
+			put_int(fp, chorus_parm[mode].lfo_freq);
+		} else {
+			put_int(fp, REVERB_PARMS);
+			for (j = 0; j < REVERB_PARMS; j++)
+				put_int(fp, reverb_parm[mode].parms[j]);
+		}
+	}
+
+	rc = ferror(fp) ? -1 : 0;
+	if (fclose(fp) != 0)
+		rc = -1;
+	if (rc < 0) {
+		fprintf(stderr, "%s: can't write %s\n", progname, outfile);
+		unlink(outfile);
+	}
+	return rc;
+}
+
+static int get_int(FILE *fp)
+{
+	unsigned int val;
+	val = getc(fp) & 0xff;
+	val |= (getc(fp) & 0xff) << 8;
+	val |= (getc(fp) & 0xff) << 16;
+	val |= (getc(fp) & 0xff) << 24;
+	return (int)val;
+}
+
+/* read a string into the buffer; return FALSE if too long */
+static int get_string(FILE *fp, char *buf, int maxlen)
+{
+	int len = get_int(fp);
+	if (len < 0 || len >= maxlen)
+		return FALSE;
+	if (len > 0 && fread(buf, 1, len, fp) != len)
+		return FALSE;
+	buf[len] = 0;
+	return TRUE;
+}
+
+/* read the modes from the compiled config;
+ * the path of the config file is stored in srcpath.
+ * if config is given, the compiled config must be made from it.
+ * return 1 if loaded, 0 if no valid compiled config exists,
+ * or -1 if the config file was changed.
+ */
+static int read_compiled_fx(char *path, char *srcpath, int maxlen, char *config)
+{
+	struct stat st;
+	FILE *fp;
+	int i, j, n, type, mode, nparms, mtime, size, rc;
+
+	if ((fp = fopen(path, "r")) == NULL)
+		return 0;
+	rc = 0;
+	if (fread(line, 1, strlen(FXC_MAGIC), fp) != strlen(FXC_MAGIC) ||
+	    memcmp(line, FXC_MAGIC, strlen(FXC_MAGIC)) != 0 ||
+	    get_int(fp) != FXC_VERSION ||
+	    ! get_string(fp, srcpath, maxlen))
+		goto error;
+	if (config && strcmp(srcpath, config) != 0)
+		goto error;	/* made from another config */
+	mtime = get_int(fp);
+	size = get_int(fp);
+	if (stat(srcpath, &st) < 0 ||
+	    (int)st.st_mtime != mtime || (int)st.st_size != size) {
+		rc = -1;
+		goto error;
+	}
+
+	n = get_int(fp);
+	if (n < 0 || n > AWE_CHORUS_NUMBERS + AWE_REVERB_NUMBERS)
+		goto error;
+	for (i = 0; i < n; i++) {
+		type = get_int(fp);
+		mode = get_int(fp);
+		nparms = get_int(fp);
+		if (mode < 8 || mode >= 32)
+			goto error;
+		if (type == FX_CHORUS && nparms == CHORUS_PARMS) {
+			chorus_parm[mode].feedback = get_int(fp);
+			chorus_parm[mode].delay_offset = get_int(fp);
+			chorus_parm[mode].lfo_depth = get_int(fp);
+			chorus_parm[mode].delay = get_int(fp);
+			chorus_parm[mode].lfo_freq = get_int(fp);
+			chorus_defined[mode] = 1;
+		} else if (type == FX_REVERB && nparms == REVERB_PARMS) {
+			for (j = 0; j < REVERB_PARMS; j++)
+				reverb_parm[mode].parms[j] = get_int(fp);
+			reverb_defined[mode] = 1;
+		} else
+			goto error;
+		add_fx(type, mode);
+	}
+	if (feof(fp))
+		goto error;
+	fclose(fp);
+	return 1;
+
+ error:
+	/* discard the modes read so far */
+	fx_count = 0;
+	memset(chorus_defined + 8, 0, sizeof(chorus_defined) - 8);
+	memset(reverb_defined + 8, 0, sizeof(reverb_defined) - 8);
+	fclose(fp);
+	return rc;
+}
+
+
 /*----------------------------------------------------------------
  * read a line and parse tokens
  *----------------------------------------------------------------*/
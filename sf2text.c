@@ -19,36 +19,91 @@
  *================================================================*/
 
 #include <stdio.h>
-#include <ctype.h>
+#include <stdlib.h>
 #include <string.h>
+#include <getopt.h>
 #include "sffile.h"
 #include "sfitem.h"
 #include "sflayer.h"
 #include "awe_parm.h"
+#include "awebank.h"
 #include "util.h"
+#include "awe_version.h"
 
 int seqfd, awe_dev;
 static SFInfo sfinfo;
 
+/* selected presets; NULL = all */
+static LoadList *part_list;
+/* marks of the printed presets, instruments and samples */
+static char *preset_mark, *inst_mark, *sample_mark;
+
 void print_soundfont(FILE *fp, SFInfo *sf);
-static void print_name(FILE *fp, char *str);
-static void print_layers(FILE *fp, SFInfo *sf, SFHeader *hdr);
-static void print_amount(FILE *fp, SFInfo *sf, SFGenRec *gen);
+static void print_json(FILE *fp, SFInfo *sf);
+static void print_binary(FILE *fp, SFInfo *sf);
+static void print_name(char *str);
+static void print_layers(SFInfo *sf, SFHeader *hdr);
+static void print_amount(SFInfo *sf, SFGenRec *gen);
+static void mark_selected(SFInfo *sf);
+static void add_part_list(char *arg);
+
+
+static void usage(void)
+{
+	fputs("sf2text -- convert soundfont to text\n"
+	      VERSION_NOTE
+	      "usage:	sf2text [-options] soundfont [outputfile]\n"
+	      "\n"
+	      " options:\n"
+	      " -p, --preset=preset[/bank]  print only the given presets and their\n"
+	      "                             instruments and samples\n"
+	      " -m, --mode=text|json|binary output format (default=text)\n",
+	      stderr);
+	exit(1);
+}
+
+static struct option long_options[] = {
+	{"preset", 1, 0, 'p'},
+	{"mode", 1, 0, 'm'},
+	{"help", 0, 0, 'h'},
+	{0, 0, 0, 0},
+};
 
+#define OPTION_FLAGS	"p:m:h"
 
 int main(int argc, char  **argv)
 {
 	FILE *fd, *fout;
-	int piped=0;
+	int c, piped=0;
+	void (*print)(FILE *fp, SFInfo *sf) = print_soundfont;
+
+	while ((c = getopt_long(argc, argv, OPTION_FLAGS, long_options, NULL)) != -1) {
+		switch (c) {
+		case 'p':
+			add_part_list(optarg);
+			break;
+		case 'm':
+			if (strcmp(optarg, "text") == 0)
+				print = print_soundfont;
+			else if (strcmp(optarg, "json") == 0)
+				print = print_json;
+			else if (strcmp(optarg, "binary") == 0)
+				print = print_binary;
+			else
+				usage();
+			break;
+		default:
+			usage();
+			break;
+		}
+	}
+	argc -= optind - 1;
+	argv += optind - 1;
+
 	if (argc < 2 || strcmp(argv[1],"-") == 0) {
 		piped = 1;
 		fd = stdin;
 	} else {
-		if (strcmp(argv[1], "-h") ==0 || strcmp(argv[1], "--help") == 0) {
-			fprintf(stderr, "no file is given\n");
-			fprintf(stderr, "usage: sf2text soundfont [outputfile]\n");
-			return 1;
-		}
 		if ((fd = fopen(argv[1], "r")) == NULL) {
 			fprintf(stderr, "can't open file %s\n", argv[1]);
 			return 1;
@@ -58,7 +113,7 @@ int main(int argc, char  **argv)
 		return 1;
 	fclose(fd);
 
-	if (argc < 3 || strcmp(argv[2], "-"))
+	if (argc < 3 || strcmp(argv[2], "-") == 0)
 		fout = stdout;
 	else {
 		if ((fout = fopen(argv[2], "w")) == NULL) {
@@ -66,11 +121,196 @@ int main(int argc, char  **argv)
 			return 1;
 		}
 	}
-	print_soundfont(fout, &sfinfo);
+	mark_selected(&sfinfo);
+	print(fout, &sfinfo);
+	if (fclose(fout) != 0) {
+		fprintf(stderr, "can't write the output\n");
+		return 1;
+	}
 	return 0;
 }
 
 
+/*----------------------------------------------------------------
+ * preset selection
+ *----------------------------------------------------------------*/
+
+/* make a preset list from comand line options */
+static void add_part_list(char *arg)
+{
+	char tmp[100];
+	SFPatchRec pat, map;
+	if (strlen(arg) > sizeof(tmp)-1) {
+		fprintf(stderr, "sf2text: illegal argument %s\n", arg);
+		exit(1);
+	}
+	strcpy(tmp, arg);
+	if (awe_parse_loadlist(tmp, &pat, &map, NULL))
+		part_list = awe_add_loadlist(part_list, &pat, &map);
+}
+
+/* mark instruments and samples used in the layers */
+static void mark_layers(SFHeader *hdr, int oper, char *mark, int nums)
+{
+	int j, k;
+	for (j = 0; j < hdr->nlayers; j++) {
+		for (k = 0; k < hdr->layer[j].nlists; k++) {
+			SFGenRec *gen = &hdr->layer[j].list[k];
+			if (gen->oper == oper && gen->amount >= 0 &&
+			    gen->amount < nums)
+				mark[gen->amount] = TRUE;
+		}
+	}
+}
+
+/* mark the selected presets and the instruments and samples used
+ * by them.  the terminators are not printed in this case.
+ */
+static void mark_selected(SFInfo *sf)
+{
+	LoadList *p;
+	SFPatchRec rec;
+	int i;
+
+	if (part_list == NULL)
+		return;
+	preset_mark = (char*)safe_malloc(sf->npresets + 1);
+	inst_mark = (char*)safe_malloc(sf->ninsts + 1);
+	sample_mark = (char*)safe_malloc(sf->nsamples + 1);
+	for (i = 0; i < sf->npresets - 1; i++) {
+		rec.preset = sf->preset[i].preset;
+		rec.bank = sf->preset[i].bank;
+		rec.keynote = -1;
+		for (p = part_list; p; p = p->next) {
+			if (awe_match_preset(&rec, &p->pat)) {
+				preset_mark[i] = TRUE;
+				mark_layers(&sf->preset[i].hdr, SF_instrument,
+					    inst_mark, sf->ninsts - 1);
+				break;
+			}
+		}
+	}
+	for (i = 0; i < sf->ninsts - 1; i++) {
+		if (inst_mark[i])
+			mark_layers(&sf->inst[i].hdr, SF_sampleId,
+				    sample_mark, sf->nsamples - 1);
+	}
+}
+
+#define is_marked(mark,i)	((mark) == NULL || (mark)[i])
+
+static int count_marks(char *mark, int nums)
+{
+	int i, n;
+	if (mark == NULL)
+		return nums;
+	for (i = n = 0; i < nums; i++) {
+		if (mark[i])
+			n++;
+	}
+	return n;
+}
+
+
+/*----------------------------------------------------------------
+ * buffered output
+ *----------------------------------------------------------------
+ * The text is formatted in a large buffer by hand without stdio
+ * and locale.
+ *----------------------------------------------------------------*/
+
+#define OUT_BUFSIZE	(64 * 1024)
+#define OUT_MARGIN	256	/* enough for one item */
+
+static FILE *out_fp;
+static char out_buf[OUT_BUFSIZE];
+static int out_len;
+
+static void out_flush(void)
+{
+	if (out_len > 0)
+		fwrite(out_buf, out_len, 1, out_fp);
+	out_len = 0;
+}
+
+/* make room for a short item */
+#define out_room()	{if (out_len > OUT_BUFSIZE - OUT_MARGIN) out_flush();}
+#define out_char(c)	(out_buf[out_len++] = (c))
+
+static void out_str(const char *str)
+{
+	while (*str) {
+		out_room();
+		out_char(*str++);
+	}
+}
+
+/* put a decimal number */
+static void out_int(long val)
+{
+	char tmp[24];
+	unsigned long v;
+	int n = 0;
+
+	out_room();
+	if (val < 0) {
+		out_char('-');
+		v = -(unsigned long)val;
+	} else
+		v = val;
+	do {
+		tmp[n++] = '0' + v % 10;
+		v /= 10;
+	} while (v);
+	while (n > 0)
+		out_char(tmp[--n]);
+}
+
+/* put a hex number with 0x prefix */
+static void out_hex(unsigned int val)
+{
+	static const char digits[] = "0123456789abcdef";
+	char tmp[16];
+	int n = 0;
+
+	out_room();
+	do {
+		tmp[n++] = digits[val & 15];
+		val >>= 4;
+	} while (val);
+	out_char('0');
+	out_char('x');
+	while (n > 0)
+		out_char(tmp[--n]);
+}
+
+/* put val / div (div = 10 or 100) in the same form as "%g" */
+static void out_frac(int val, int div)
+{
+	unsigned int v;
+	int frac, digits;
+
+	if (val < 0) {
+		out_room();
+		out_char('-');
+		v = -(unsigned int)val;
+	} else
+		v = val;
+	out_int(v / div);
+	if ((frac = v % div) == 0)
+		return;
+	out_char('.');
+	for (digits = div / 10; frac; digits /= 10) {
+		out_char('0' + frac / digits);
+		frac %= digits;
+	}
+}
+
+
+/*----------------------------------------------------------------
+ * print soundfont information
+ *----------------------------------------------------------------*/
+
 void print_soundfont(FILE *fp, SFInfo *sf)
 {
 	int i;
@@ -78,99 +318,151 @@ void print_soundfont(FILE *fp, SFInfo *sf)
 	SFInstHdr *inst;
 	SFSampleInfo *sp;
 
-	fprintf(fp, "(Name ");
-	print_name(fp, sf->sf_name);
-	fprintf(fp, ")\n");
+	out_fp = fp;
+	out_len = 0;
+
+	out_str("(Name ");
+	print_name(sf->sf_name ? sf->sf_name : "");
+	out_str(")\n");
 
-	fprintf(fp, "(SoundFont %d %d)\n", sf->version, sf->minorversion);
-	fprintf(fp, "(SamplePos %ld %d)\n", sf->samplepos, sf->samplesize);
-	fprintf(fp, "(InfoPos %ld %ld)\n", sf->infopos, sf->infosize);
-	fprintf(fp, "(Presets %d (\n", sf->npresets);
+	out_str("(SoundFont ");
+	out_int(sf->version);
+	out_char(' ');
+	out_int(sf->minorversion);
+	out_str(")\n(SamplePos ");
+	out_int(sf->samplepos);
+	out_char(' ');
+	out_int(sf->samplesize);
+	out_str(")\n(InfoPos ");
+	out_int(sf->infopos);
+	out_char(' ');
+	out_int(sf->infosize);
+	out_str(")\n(Presets ");
+	out_int(count_marks(preset_mark, sf->npresets));
+	out_str(" (\n");
 	for (preset = sf->preset, i = 0; i < sf->npresets; preset++, i++) {
-		fprintf(fp, " (");
-		fprintf(fp, "%d ", i);
-		print_name(fp, preset->hdr.name);
-		fprintf(fp, " (preset %d) (bank %d) (\n",
-		       preset->preset, preset->bank);
-		print_layers(fp, sf, &preset->hdr);
-		fprintf(fp, "  ))\n");
-	}
-	fprintf(fp, " ))\n");
-	
-	fprintf(fp, "(Instruments %d (\n", sf->ninsts);
+		if (! is_marked(preset_mark, i))
+			continue;
+		out_str(" (");
+		out_int(i);
+		out_char(' ');
+		print_name(preset->hdr.name);
+		out_str(" (preset ");
+		out_int(preset->preset);
+		out_str(") (bank ");
+		out_int(preset->bank);
+		out_str(") (\n");
+		print_layers(sf, &preset->hdr);
+		out_str("  ))\n");
+	}
+	out_str(" ))\n");
+
+	out_str("(Instruments ");
+	out_int(count_marks(inst_mark, sf->ninsts));
+	out_str(" (\n");
 	for (inst = sf->inst, i = 0; i < sf->ninsts; inst++, i++) {
-		fprintf(fp, "  (");
-		fprintf(fp, "%d ", i);
-		print_name(fp, inst->hdr.name);
-		fprintf(fp, " (\n");
-		print_layers(fp, sf, &inst->hdr);
-		fprintf(fp, "  ))\n");
-	}
-	fprintf(fp, " ))\n");
-	
-	fprintf(fp, "(SampleInfo %d (\n", sf->nsamples);
+		if (! is_marked(inst_mark, i))
+			continue;
+		out_str("  (");
+		out_int(i);
+		out_char(' ');
+		print_name(inst->hdr.name);
+		out_str(" (\n");
+		print_layers(sf, &inst->hdr);
+		out_str("  ))\n");
+	}
+	out_str(" ))\n");
+
+	out_str("(SampleInfo ");
+	out_int(count_marks(sample_mark, sf->nsamples));
+	out_str(" (\n");
 	for (sp = sf->sample, i = 0; i < sf->nsamples; sp++, i++) {
-		fprintf(fp, " (%d ", i);
-		print_name(fp, sp->name);
-		fprintf(fp, " (0x%x 0x%x) (0x%x 0x%x)",
-		       sp->startsample, sp->endsample,
-		       sp->startloop, sp->endloop);
+		if (! is_marked(sample_mark, i))
+			continue;
+		out_str(" (");
+		out_int(i);
+		out_char(' ');
+		print_name(sp->name);
+		out_str(" (");
+		out_hex(sp->startsample);
+		out_char(' ');
+		out_hex(sp->endsample);
+		out_str(") (");
+		out_hex(sp->startloop);
+		out_char(' ');
+		out_hex(sp->endloop);
+		out_char(')');
 		if (sf->version == 2) {
-			fprintf(fp, "\n          (%d %d %d %d %d)",
-			       sp->samplerate, sp->originalPitch,
-			       sp->pitchCorrection, sp->samplelink,
-			       sp->sampletype);
+			out_str("\n          (");
+			out_int(sp->samplerate);
+			out_char(' ');
+			out_int(sp->originalPitch);
+			out_char(' ');
+			out_int(sp->pitchCorrection);
+			out_char(' ');
+			out_int(sp->samplelink);
+			out_char(' ');
+			out_int(sp->sampletype);
+			out_char(')');
 		}
-		fprintf(fp, ")\n");
+		out_str(")\n");
 	}
-	fprintf(fp, " ))\n");
+	out_str(" ))\n");
+	out_flush();
 }
 
 /* print string value. escape or convert the letter to octet if necessary. */
-static void print_name(FILE *fp, char *str)
+static void print_name(char *str)
 {
 	int i = 0;
 	unsigned char *p;
-	putc('"', fp);
 
-	for (p = str; *p && i < 20; i++, p++) {
-		if (!isprint(*p))
-			fprintf(fp, "\\%03o", *p);
-		else if (*p == '"')
-			fprintf(fp, "\\\"");
-		else
-			putc(*p, fp);
+	out_room();
+	out_char('"');
+	for (p = (unsigned char *)str; *p && i < 20; i++, p++) {
+		if (*p < 0x20 || *p >= 0x7f) {
+			out_char('\\');
+			out_char('0' + ((*p >> 6) & 7));
+			out_char('0' + ((*p >> 3) & 7));
+			out_char('0' + (*p & 7));
+		} else if (*p == '"') {
+			out_char('\\');
+			out_char('"');
+		} else
+			out_char(*p);
 	}
-	
-	putc('"', fp);
+	out_char('"');
 }
 
 /* print layered list */
-static void print_layers(FILE *fp, SFInfo *sf, SFHeader *hdr)
+static void print_layers(SFInfo *sf, SFHeader *hdr)
 {
 	SFGenLayer *lay = hdr->layer;
 	int j, k;
 
 	for (j = 0; j < hdr->nlayers; lay++, j++) {
 		if (lay->nlists == 0) continue;
-		fprintf(fp, "  (layer\n");
+		out_str("  (layer\n");
 		for (k = 0; k < lay->nlists; k++) {
-			print_amount(fp, sf, &lay->list[k]);
+			print_amount(sf, &lay->list[k]);
 			if (k == lay->nlists-1)
-				fprintf(fp, ")\n");
+				out_str(")\n");
 			else
-				fprintf(fp, "\n");
+				out_char('\n');
 		}
 	}
 }
 
 /* print a layer item together with optional info */
-static void print_amount(FILE *fp, SFInfo *sf, SFGenRec *gen)
+static void print_amount(SFInfo *sf, SFGenRec *gen)
 {
 	LayerItem *item = &layer_items[gen->oper];
 	int amount;
 
-	fprintf(fp, "   (%s %d", sf_gen_text[gen->oper], gen->amount);
+	out_str("   (");
+	out_str(sf_gen_text[gen->oper]);
+	out_char(' ');
+	out_int(gen->amount);
 
 	if (sf->version == 1)
 		amount = sbk_to_sf2(gen->oper, gen->amount);
@@ -183,43 +475,358 @@ static void print_amount(FILE *fp, SFInfo *sf, SFGenRec *gen)
 	case T_OFFSET:
 	case T_HI_OFF:
 	case T_SCALE:
-		fprintf(fp, " ");
+		out_char(' ');
 		if (gen->oper == SF_sampleId)
-			print_name(fp, sf->sample[amount].name);
+			print_name(sf->sample[amount].name);
 		else if (gen->oper == SF_instrument)
-			print_name(fp, sf->inst[amount].hdr.name);
-		else 
-			fprintf(fp, "%d", amount);
+			print_name(sf->inst[amount].hdr.name);
+		else
+			out_int(amount);
 		break;
 	case T_RANGE:
-		fprintf(fp, " (%d %d)", LOWNUM(amount), HIGHNUM(amount));
+		out_str(" (");
+		out_int(LOWNUM(amount));
+		out_char(' ');
+		out_int(HIGHNUM(amount));
+		out_char(')');
 		break;
 	case T_FILTERQ:
 	case T_ATTEN:
 	case T_TREMOLO:
 	case T_VOLSUST:
-		fprintf(fp, " %d cB", amount);
+		out_char(' ');
+		out_int(amount);
+		out_str(" cB");
 		break;
 	case T_MODSUST:
-		fprintf(fp, " %g %%", (double)amount/10.0);
+		out_char(' ');
+		out_frac(amount, 10);
+		out_str(" %");
 		break;
 	case T_CUTOFF:
-		fprintf(fp, " %d Hz", awe_abscent_to_Hz(amount));
+		out_char(' ');
+		out_int(awe_abscent_to_Hz(amount));
+		out_str(" Hz");
 		break;
 	case T_FREQ:
-		fprintf(fp, " %d mHz", awe_abscent_to_mHz(amount));
+		out_char(' ');
+		out_int(awe_abscent_to_mHz(amount));
+		out_str(" mHz");
 		break;
 	case T_TIME:
-		fprintf(fp, " %d msec", awe_timecent_to_msec(amount));
+		out_char(' ');
+		out_int(awe_timecent_to_msec(amount));
+		out_str(" msec");
 		break;
 	case T_TENPCT:
 	case T_PANPOS:
-		fprintf(fp, " %g %%", (double)amount / 10.0);
+		out_char(' ');
+		out_frac(amount, 10);
+		out_str(" %");
 		break;
 	case T_PSHIFT:
 	case T_CSHIFT:
-		fprintf(fp, " %g semitone", (double)amount / 100);
+		out_char(' ');
+		out_frac(amount, 100);
+		out_str(" semitone");
 		break;
 	}
-	fprintf(fp, ")");
+	out_char(')');
+}
+
+
+/*----------------------------------------------------------------
+ * JSON output
+ *----------------------------------------------------------------
+ * Each item is printed as a JSON object in a line (JSON Lines):
+ * a "font" object at first, and then "preset", "inst" and "sample"
+ * objects in this order.  Each layer is an array of [name, value]
+ * pairs of the generators in the file order, like the text output,
+ * since a generator may appear twice in a layer.
+ *----------------------------------------------------------------*/
+
+/* print a JSON string; len = max length (-1 = until NUL) */
+static void json_name(char *str, int len)
+{
+	static const char digits[] = "0123456789abcdef";
+	unsigned char *p;
+
+	out_room();
+	out_char('"');
+	for (p = (unsigned char *)str; *p && len != 0; p++, len--) {
+		out_room();
+		if (*p < 0x20 || *p >= 0x7f) {
+			/* non-ASCII letters are taken as latin-1 */
+			out_str("\\u00");
+			out_char(digits[*p >> 4]);
+			out_char(digits[*p & 15]);
+		} else if (*p == '"' || *p == '\\') {
+			out_char('\\');
+			out_char(*p);
+		} else
+			out_char(*p);
+	}
+	out_char('"');
+}
+
+/* key and value pairs */
+static void json_int(const char *key, long val)
+{
+	out_str(",\"");
+	out_str(key);
+	out_str("\":");
+	out_int(val);
+}
+
+static void json_layers(SFHeader *hdr)
+{
+	SFGenLayer *lay = hdr->layer;
+	int j, k, n;
+
+	out_str(",\"layers\":[");
+	for (j = n = 0; j < hdr->nlayers; lay++, j++) {
+		if (lay->nlists == 0) continue;
+		if (n++)
+			out_char(',');
+		out_char('[');
+		for (k = 0; k < lay->nlists; k++) {
+			if (k)
+				out_char(',');
+			out_str("[\"");
+			out_str(sf_gen_text[lay->list[k].oper]);
+			out_str("\",");
+			out_int(lay->list[k].amount);
+			out_char(']');
+		}
+		out_char(']');
+	}
+	out_char(']');
+}
+
+static void print_json(FILE *fp, SFInfo *sf)
+{
+	int i;
+	SFPresetHdr *preset;
+	SFInstHdr *inst;
+	SFSampleInfo *sp;
+
+	out_fp = fp;
+	out_len = 0;
+
+	out_str("{\"type\":\"font\",\"name\":");
+	json_name(sf->sf_name ? sf->sf_name : "", -1);
+	json_int("version", sf->version);
+	json_int("minorversion", sf->minorversion);
+	json_int("samplepos", sf->samplepos);
+	json_int("samplesize", sf->samplesize);
+	json_int("infopos", sf->infopos);
+	json_int("infosize", sf->infosize);
+	json_int("presets", count_marks(preset_mark, sf->npresets));
+	json_int("insts", count_marks(inst_mark, sf->ninsts));
+	json_int("samples", count_marks(sample_mark, sf->nsamples));
+	out_str("}\n");
+
+	for (preset = sf->preset, i = 0; i < sf->npresets; preset++, i++) {
+		if (! is_marked(preset_mark, i))
+			continue;
+		out_str("{\"type\":\"preset\"");
+		json_int("index", i);
+		out_str(",\"name\":");
+		json_name(preset->hdr.name, 20);
+		json_int("preset", preset->preset);
+		json_int("bank", preset->bank);
+		json_layers(&preset->hdr);
+		out_str("}\n");
+	}
+
+	for (inst = sf->inst, i = 0; i < sf->ninsts; inst++, i++) {
+		if (! is_marked(inst_mark, i))
+			continue;
+		out_str("{\"type\":\"inst\"");
+		json_int("index", i);
+		out_str(",\"name\":");
+		json_name(inst->hdr.name, 20);
+		json_layers(&inst->hdr);
+		out_str("}\n");
+	}
+
+	for (sp = sf->sample, i = 0; i < sf->nsamples; sp++, i++) {
+		if (! is_marked(sample_mark, i))
+			continue;
+		out_str("{\"type\":\"sample\"");
+		json_int("index", i);
+		out_str(",\"name\":");
+		json_name(sp->name, 20);
+		json_int("start", sp->startsample);
+		json_int("end", sp->endsample);
+		json_int("startloop", sp->startloop);
+		json_int("endloop", sp->endloop);
+		if (sf->version == 2) {
+			json_int("samplerate", sp->samplerate);
+			json_int("originalPitch", sp->originalPitch);
+			json_int("pitchCorrection", sp->pitchCorrection);
+			json_int("samplelink", sp->samplelink);
+			json_int("sampletype", sp->sampletype);
+		}
+		out_str("}\n");
+	}
+	out_flush();
+}
+
+
+/*----------------------------------------------------------------
+ * binary output
+ *----------------------------------------------------------------
+ * The file begins with the magic "SFTB" and the format version
+ * (dword), followed by the records.  Each record consists of a
+ * type byte, the length of the following data (dword), and the
+ * data.  All numbers are in little endian.
+ *
+ *  'F' font:   version, minorversion (word), samplepos, samplesize,
+ *              infopos, infosize (dword), number of presets, insts
+ *              and samples (dword), name length (word) and name
+ *  'P' preset: index, preset, bank (word), name[20], layers
+ *  'I' inst:   index (word), name[20], layers
+ *  'S' sample: index (word), name[20], start, end, startloop,
+ *              endloop, samplerate (dword), originalPitch,
+ *              pitchCorrection (byte), samplelink, sampletype (word)
+ *
+ * The layers are the number of layers (word), and in each layer,
+ * the number of generators (word) and the pairs of generator id
+ * and raw value (word).
+ *----------------------------------------------------------------*/
+
+#define BIN_VERSION	1
+
+static void out_byte(int val)
+{
+	out_room();
+	out_char(val & 0xff);
+}
+
+static void out_word(int val)
+{
+	out_room();
+	out_char(val & 0xff);
+	out_char((val >> 8) & 0xff);
+}
+
+static void out_dword(long val)
+{
+	out_room();
+	out_char(val & 0xff);
+	out_char((val >> 8) & 0xff);
+	out_char((val >> 16) & 0xff);
+	out_char((val >> 24) & 0xff);
+}
+
+static void out_data(char *p, int len)
+{
+	while (len-- > 0)
+		out_byte(*p++);
+}
+
+static void bin_record(int type, int len)
+{
+	out_byte(type);
+	out_dword(len);
+}
+
+/* size of layers in bytes */
+static int bin_layers_size(SFHeader *hdr)
+{
+	int j, len = 2;
+	for (j = 0; j < hdr->nlayers; j++) {
+		if (hdr->layer[j].nlists > 0)
+			len += 2 + hdr->layer[j].nlists * 4;
+	}
+	return len;
+}
+
+static void bin_layers(SFHeader *hdr)
+{
+	SFGenLayer *lay;
+	int j, k, n;
+
+	for (j = n = 0; j < hdr->nlayers; j++) {
+		if (hdr->layer[j].nlists > 0)
+			n++;
+	}
+	out_word(n);
+	for (lay = hdr->layer, j = 0; j < hdr->nlayers; lay++, j++) {
+		if (lay->nlists == 0) continue;
+		out_word(lay->nlists);
+		for (k = 0; k < lay->nlists; k++) {
+			out_word(lay->list[k].oper);
+			out_word(lay->list[k].amount);
+		}
+	}
+}
+
+static void print_binary(FILE *fp, SFInfo *sf)
+{
+	int i, len;
+	SFPresetHdr *preset;
+	SFInstHdr *inst;
+	SFSampleInfo *sp;
+
+	out_fp = fp;
+	out_len = 0;
+
+	out_str("SFTB");
+	out_dword(BIN_VERSION);
+
+	len = sf->sf_name ? strlen(sf->sf_name) : 0;
+	if (len > 0xffff)
+		len = 0xffff;
+	bin_record('F', 2 * 2 + 4 * 4 + 3 * 4 + 2 + len);
+	out_word(sf->version);
+	out_word(sf->minorversion);
+	out_dword(sf->samplepos);
+	out_dword(sf->samplesize);
+	out_dword(sf->infopos);
+	out_dword(sf->infosize);
+	out_dword(count_marks(preset_mark, sf->npresets));
+	out_dword(count_marks(inst_mark, sf->ninsts));
+	out_dword(count_marks(sample_mark, sf->nsamples));
+	out_word(len);
+	out_data(sf->sf_name, len);
+
+	for (preset = sf->preset, i = 0; i < sf->npresets; preset++, i++) {
+		if (! is_marked(preset_mark, i))
+			continue;
+		bin_record('P', 3 * 2 + 20 + bin_layers_size(&preset->hdr));
+		out_word(i);
+		out_word(preset->preset);
+		out_word(preset->bank);
+		out_data(preset->hdr.name, 20);
+		bin_layers(&preset->hdr);
+	}
+
+	for (inst = sf->inst, i = 0; i < sf->ninsts; inst++, i++) {
+		if (! is_marked(inst_mark, i))
+			continue;
+		bin_record('I', 2 + 20 + bin_layers_size(&inst->hdr));
+		out_word(i);
+		out_data(inst->hdr.name, 20);
+		bin_layers(&inst->hdr);
+	}
+
+	for (sp = sf->sample, i = 0; i < sf->nsamples; sp++, i++) {
+		if (! is_marked(sample_mark, i))
+			continue;
+		bin_record('S', 2 + 20 + 5 * 4 + 2 + 2 * 2);
+		out_word(i);
+		out_data(sp->name, 20);
+		out_dword(sp->startsample);
+		out_dword(sp->endsample);
+		out_dword(sp->startloop);
+		out_dword(sp->endloop);
+		out_dword(sp->samplerate);
+		out_byte(sp->originalPitch);
+		out_byte(sp->pitchCorrection);
+		out_word(sp->samplelink);
+		out_word(sp->sampletype);
+	}
+	out_flush();
 }
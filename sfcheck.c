@@ -0,0 +1,99 @@
+/*================================================================
+ * sfcheck -- check SoundFont files
+ *
+ * Copyright (C) 1996-2003 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include "util.h"
+#include "sffile.h"
+#include "awe_version.h"
+
+int seqfd, awe_dev;
+
+static void usage(void)
+{
+	fputs("sfcheck -- check SoundFont files\n"
+	      VERSION_NOTE
+	      "usage:	sfcheck [-options] soundfont...\n"
+	      "\n"
+	      " options:\n"
+	      " -q, --quiet              print nothing; only exit status\n"
+	      " -w, --warning            print warnings, too\n",
+	      stderr);
+	exit(1);
+}
+
+static struct option long_options[] = {
+	{"quiet", 0, 0, 'q'},
+	{"warning", 0, 0, 'w'},
+	{"help", 0, 0, 'h'},
+	{0, 0, 0, 0},
+};
+
+#define OPTION_FLAGS	"qwh"
+
+int main(int argc, char **argv)
+{
+	FILE *fp;
+	int c, verbose, errors, rc;
+
+	verbose = 1;
+	while ((c = getopt_long(argc, argv, OPTION_FLAGS, long_options, NULL)) != -1) {
+		switch (c) {
+		case 'q':
+			verbose = 0;
+			break;
+		case 'w':
+			verbose = 2;
+			break;
+		default:
+			usage();
+			break;
+		}
+	}
+	if (optind >= argc)
+		usage();
+
+	rc = 0;
+	for (; optind < argc; optind++) {
+		char *name = argv[optind];
+		if (strcmp(name, "-") == 0)
+			fp = stdin;
+		else if ((fp = fopen(name, "r")) == NULL) {
+			if (verbose)
+				fprintf(stderr, "sfcheck: can't open file %s\n", name);
+			rc = 1;
+			continue;
+		}
+		if (verbose)
+			fprintf(stderr, "%s:\n", name);
+		errors = awe_check_soundfont(fp, verbose);
+		if (fp != stdin)
+			fclose(fp);
+		if (errors > 0) {
+			if (verbose)
+				fprintf(stderr, "%s: %d errors\n", name, errors);
+			rc = 1;
+		} else if (verbose)
+			fprintf(stderr, "%s: OK\n", name);
+	}
+	return rc;
+}
@@ -0,0 +1,370 @@
+/*================================================================
+ * sfedit -- edit soundfont files directly
+ *
+ * Copyright (C) 1996-2000 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *================================================================*/
+
+/*
+ * The same edit commands are applied to each given soundfont file
+ * without converting to the text via sf2text/text2sf.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <getopt.h>
+#include "util.h"
+#include "sffile.h"
+#include "sflayer.h"
+#include "awe_version.h"
+
+int seqfd, awe_dev;
+
+#define MAX_CMDS	256
+#define MAX_LINES	256
+#define MAX_ARGS	8
+
+static char *cmds[MAX_CMDS];
+static int ncmds;
+
+/* selected presets or instruments */
+enum { SEL_PRESET, SEL_INST };
+static int sel_type, sel_bank, sel_preset;
+static char *sel_name;
+
+enum { CMD_SET, CMD_REMOVE, CMD_RENAME };
+
+static void usage(void);
+static void add_cmd(char *line);
+static void read_cmd_file(char *fname);
+static int edit_file(char *file, char *outfile);
+static int do_cmd(SFInfo *sf, char *line);
+static int parse_number(char *arg, int *preset, int *bank);
+static int get_gen(char *arg);
+static int selected(SFInfo *sf, int i);
+
+
+/*----------------------------------------------------------------
+ * main routine
+ *----------------------------------------------------------------*/
+
+static void usage(void)
+{
+	fputs("sfedit -- edit soundfont files\n"
+	      VERSION_NOTE
+	      "usage:	sfedit [-options] soundfont...\n"
+	      "\n"
+	      " options:\n"
+	      " -e, --command=cmd        add an edit command\n"
+	      " -f, --file=file          read edit commands from the file\n"
+	      " -o, --output=file        write to the file instead of overwriting\n"
+	      " -v, --verbose            print the changes\n"
+	      "\n"
+	      " commands:\n"
+	      "  preset preset[/bank]    select presets ('*' matches any)\n"
+	      "  inst name               select instruments ('*' matches any)\n"
+	      "  set generator value     set the generator in all layers\n"
+	      "  remove generator        remove the generator from all layers\n"
+	      "  remap preset[/bank]     change preset and bank numbers\n"
+	      "  rename name             rename the selected presets or instruments\n"
+	      "  name name               change the soundfont name\n",
+	      stderr);
+	exit(1);
+}
+
+static struct option long_options[] = {
+	{"command", 1, 0, 'e'},
+	{"file", 1, 0, 'f'},
+	{"output", 1, 0, 'o'},
+	{"verbose", 0, 0, 'v'},
+	{"help", 0, 0, 'h'},
+	{0, 0, 0, 0},
+};
+
+#define OPTION_FLAGS	"e:f:o:vh"
+
+int main(int argc, char **argv)
+{
+	int c, rc;
+	char *outfile = NULL;
+
+	while ((c = getopt_long(argc, argv, OPTION_FLAGS, long_options, NULL)) != -1) {
+		switch (c) {
+		case 'e':
+			add_cmd(optarg);
+			break;
+		case 'f':
+			read_cmd_file(optarg);
+			break;
+		case 'o':
+			outfile = optarg;
+			break;
+		case 'v':
+			awe_verbose++;
+			break;
+		default:
+			usage();
+			break;
+		}
+	}
+	if (optind >= argc || ncmds == 0)
+		usage();
+	if (outfile && optind + 1 < argc) {
+		fprintf(stderr, "sfedit: -o is allowed only for a single file\n");
+		return 1;
+	}
+
+	rc = 0;
+	for (; optind < argc; optind++) {
+		if (edit_file(argv[optind], outfile) < 0)
+			rc = 1;
+	}
+	return rc;
+}
+
+
+/*----------------------------------------------------------------
+ * store edit commands
+ *----------------------------------------------------------------*/
+
+static void add_cmd(char *line)
+{
+	if (ncmds >= MAX_CMDS) {
+		fprintf(stderr, "sfedit: too many commands\n");
+		exit(1);
+	}
+	cmds[ncmds++] = safe_strdup(line);
+}
+
+static void read_cmd_file(char *fname)
+{
+	FILE *fp;
+	char line[MAX_LINES], *p;
+
+	if ((fp = fopen(fname, "r")) == NULL) {
+		fprintf(stderr, "sfedit: can't open file %s\n", fname);
+		exit(1);
+	}
+	while (fgets(line, sizeof(line), fp)) {
+		for (p = line; *p == ' ' || *p == '\t'; p++)
+			;
+		if (*p == '#' || *p == '\n' || *p == 0)
+			continue;
+		add_cmd(p);
+	}
+	fclose(fp);
+}
+
+
+/*----------------------------------------------------------------
+ * load, edit and save a soundfont file
+ *----------------------------------------------------------------*/
+
+static int edit_file(char *file, char *outfile)
+{
+	SFInfo sf;
+	FILE *fp;
+	int i, rc;
+
+	if ((fp = fopen(file, "r")) == NULL) {
+		fprintf(stderr, "sfedit: can't open file %s\n", file);
+		return -1;
+	}
+	memset(&sf, 0, sizeof(sf));
+	rc = awe_load_soundfont(&sf, fp, TRUE);
+	fclose(fp);
+	if (rc < 0) {
+		fprintf(stderr, "sfedit: can't load soundfont %s\n", file);
+		return -1;
+	}
+
+	/* all presets are selected as default */
+	sel_type = SEL_PRESET;
+	sel_bank = sel_preset = -1;
+	sel_name = NULL;
+	DEBUG(0,fprintf(stderr, "%s:\n", file));
+	for (i = 0; i < ncmds; i++) {
+		if ((rc = do_cmd(&sf, cmds[i])) < 0)
+			break;
+	}
+	safe_free(sel_name);
+	if (rc == 0)
+		rc = awe_sf_save_file(&sf, file, outfile);
+	awe_free_soundfont(&sf);
+	return rc;
+}
+
+
+/*----------------------------------------------------------------
+ * execute a command
+ *----------------------------------------------------------------*/
+
+static int do_cmd(SFInfo *sf, char *line)
+{
+	char buf[MAX_LINES];
+	char *argv[MAX_ARGS];
+	int argc, i, n, cmd, oper, bank, preset;
+	SFHeader *hdr;
+
+	strncpy(buf, line, sizeof(buf) - 1);
+	buf[sizeof(buf) - 1] = 0;
+	if ((argv[0] = strtoken(buf)) == NULL)
+		return 0;
+	for (argc = 1; argc < MAX_ARGS; argc++) {
+		if ((argv[argc] = strtoken(NULL)) == NULL)
+			break;
+	}
+
+	if (strcmp(argv[0], "preset") == 0 && argc == 2) {
+		if (parse_number(argv[1], &sel_preset, &sel_bank) < 0)
+			goto error;
+		sel_type = SEL_PRESET;
+		return 0;
+	} else if (strcmp(argv[0], "inst") == 0 && argc == 2) {
+		safe_free(sel_name);
+		sel_name = strcmp(argv[1], "*") ? safe_strdup(argv[1]) : NULL;
+		sel_type = SEL_INST;
+		return 0;
+	} else if (strcmp(argv[0], "name") == 0 && argc == 2) {
+		if (awe_sf_set_font_name(sf, argv[1]) < 0) {
+			fprintf(stderr, "sfedit: too long font name (max %d letters)\n",
+				SF_NAME_MAX - 1);
+			return -1;
+		}
+		DEBUG(0,fprintf(stderr, "  font name: %s\n", argv[1]));
+		return 0;
+	} else if (strcmp(argv[0], "remap") == 0 && argc == 2) {
+		if (sel_type != SEL_PRESET ||
+		    parse_number(argv[1], &preset, &bank) < 0)
+			goto error;
+		n = awe_sf_remap_preset(sf, sel_bank, sel_preset, bank, preset);
+		DEBUG(0,fprintf(stderr, "  remap: %d presets\n", n));
+		/* keep the selection on the remapped presets */
+		if (bank >= 0) sel_bank = bank;
+		if (preset >= 0) sel_preset = preset;
+		return 0;
+	}
+
+	/* commands for each selected header */
+	oper = -1;
+	if (strcmp(argv[0], "set") == 0 && argc == 3) {
+		cmd = CMD_SET;
+		if ((oper = get_gen(argv[1])) < 0)
+			goto error;
+	} else if (strcmp(argv[0], "remove") == 0 && argc == 2) {
+		cmd = CMD_REMOVE;
+		if ((oper = get_gen(argv[1])) < 0)
+			goto error;
+		/* the layer can't lose its instrument or sample */
+		if (oper == SF_instrument || oper == SF_sampleId)
+			goto error;
+	} else if (strcmp(argv[0], "rename") == 0 && argc == 2) {
+		cmd = CMD_RENAME;
+	} else
+		goto error;
+
+	/* skip the terminator */
+	n = sel_type == SEL_PRESET ? sf->npresets : sf->ninsts;
+	for (i = 0; i < n - 1; i++) {
+		if (! selected(sf, i))
+			continue;
+		hdr = sel_type == SEL_PRESET ? &sf->preset[i].hdr : &sf->inst[i].hdr;
+		DEBUG(0,fprintf(stderr, "  %s %.20s\n", argv[0], hdr->name));
+		switch (cmd) {
+		case CMD_SET:
+			awe_sf_set_hdr_gen(hdr, oper, (int)strtol(argv[2], NULL, 0));
+			break;
+		case CMD_REMOVE:
+			awe_sf_remove_hdr_gen(hdr, oper);
+			break;
+		case CMD_RENAME:
+			awe_sf_rename(hdr, argv[1]);
+			break;
+		}
+	}
+	return 0;
+
+ error:
+	fprintf(stderr, "sfedit: illegal command: %s", line);
+	if (line[strlen(line) - 1] != '\n')
+		fputc('\n', stderr);
+	return -1;
+}
+
+/* parse a number or '*' (-1) */
+static int parse_value(char *arg, int *val)
+{
+	char *end;
+
+	if (strcmp(arg, "*") == 0) {
+		*val = -1;
+		return 0;
+	}
+	if (! isdigit(*arg))
+		return -1;
+	*val = (int)strtol(arg, &end, 10);
+	return *end ? -1 : 0;
+}
+
+/* parse preset[/bank] as well as -L option of sfxload;
+ * bank 0 if omitted
+ */
+static int parse_number(char *arg, int *preset, int *bank)
+{
+	char *p;
+
+	if ((p = strchr(arg, '/')) != NULL)
+		*p++ = 0;
+	if (parse_value(arg, preset) < 0)
+		return -1;
+	*bank = 0;
+	if (p && parse_value(p, bank) < 0)
+		return -1;
+	return 0;
+}
+
+/* generator name or number */
+static int get_gen(char *arg)
+{
+	int oper;
+
+	if (*arg >= '0' && *arg <= '9')
+		oper = atoi(arg);
+	else
+		oper = sf_gen_index(arg);
+	if (oper < 0 || oper >= SF_EOF) {
+		fprintf(stderr, "sfedit: unknown generator %s\n", arg);
+		return -1;
+	}
+	return oper;
+}
+
+/* check the selection */
+static int selected(SFInfo *sf, int i)
+{
+	if (sel_type == SEL_PRESET) {
+		if (sel_bank >= 0 && sf->preset[i].bank != sel_bank)
+			return FALSE;
+		if (sel_preset >= 0 && sf->preset[i].preset != sel_preset)
+			return FALSE;
+		return TRUE;
+	}
+	if (sel_name == NULL)
+		return TRUE;
+	return strncmp(sf->inst[i].hdr.name, sel_name, 20) == 0;
+}
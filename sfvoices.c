@@ -0,0 +1,316 @@
+/*================================================================
+ * sfvoices -- print the voice records sent by the loader
+ *
+ * Copyright (C) 1996-2003 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *================================================================*/
+
+/*
+ * The fonts are loaded via awe_load_bank() as well as sfxload, but
+ * the patch records are printed instead of being written to the
+ * sequencer device.  The voice records are the values computed for
+ * the driver, so the results of different options can be compared
+ * without any sound card.
+ *
+ * The sample data is not read as default; the probe of the driver
+ * always succeeds, so that no sample is sent.  With -s option, the
+ * samples are loaded and their headers are printed, too.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <util.h>
+#include <awe_voice.h>
+#include <awebank.h>
+#include <sfopts.h>
+#include <awe_version.h>
+
+#define PROGNAME "sfvoices"
+
+int seqfd, awe_dev;
+extern int awe_verbose;
+
+static int load_samples;
+static LoadList *part_list;
+
+static int null_load_patch(void *buf, int len);
+static int null_mem_avail(void);
+static int null_reset_samples(void);
+static int null_remove_samples(void);
+static int null_zero_atten(int val);
+static void print_voice(awe_voice_rec_hdr *hdr, awe_voice_info *vp);
+static void add_part_list(char *arg);
+
+static AWEOps null_ops = {
+	null_load_patch,
+	null_mem_avail,
+	null_reset_samples,
+	null_remove_samples,
+	null_zero_atten
+};
+
+
+/*----------------------------------------------------------------
+ * print usage and exit
+ *----------------------------------------------------------------*/
+
+static void usage()
+{
+	fputs("sfvoices -- print voice records of SoundFont\n"
+	      VERSION_NOTE
+	      "usage:	" PROGNAME " [-options] soundfont[.sf2|.sbk|.bnk]...\n"
+	      "\n"
+	      " options:\n"
+	      " -s, --samples[=bool]     load samples and print their headers\n"
+	      " -L, --extract=preset/bank/note\n"
+	      "                          print only the given presets\n"
+	      " -v, --verbose[=int]      set verbosity level\n"
+	      " -q, --quiet              don't print error messages\n"
+	      " -b, --bank=number        append font to the specified bank\n"
+	      " -C, --compat[=bool]      use v0.4.2 compatible sounds\n"
+	      " -A, --sense=digit        (compat) set attenuation sensitivity\n"
+	      " -a, --atten=digit        (compat) set default attenuattion\n"
+	      " -d, --decay=scale        (compat) set decay time scale\n"
+	      " -B, --addblank[=bool]    add 12 words blank loop on each sample\n"
+	      " -c, --chorus=percent     set chorus effect (0-100)\n"
+	      " -r, --reverb=percent     set reverb effect (0-100)\n"
+	      " -V, --volume=percent     set total volume (0-100)\n"
+	      " -P, --path=dir           set SoundFont file search path\n",
+	      stderr);
+	exit(1);
+}
+
+
+/*----------------------------------------------------------------
+ * main
+ *----------------------------------------------------------------*/
+
+static struct option long_options[] = {
+	{"samples", 2, 0, 's'},
+	{"extract", 1, 0, 'L'},
+	{"verbose", 2, 0, 'v'},
+	{"quiet", 0, 0, 'q'},
+	{0, 0, 0, 0},
+};
+static int option_index;
+
+#define OPTION_FLAGS	"sL:vq"
+
+#define set_bool()	(optarg ? bool_val(optarg) : TRUE)
+
+/* parse all options; the file names are left after optind */
+static void parse_options(int argc, char **argv)
+{
+	int c;
+
+	optind = 0;
+	while ((c = awe_parse_options(argc, argv, OPTION_FLAGS, long_options, &option_index)) != -1) {
+		switch (c) {
+		case 0:
+			break;
+		case 's':
+			load_samples = set_bool();
+			break;
+		case 'L':
+			add_part_list(optarg);
+			break;
+		case 'v':
+			if (optarg)
+				awe_verbose = atoi(optarg);
+			else
+				awe_verbose++;
+			break;
+		case 'q':
+			awe_verbose = 0;
+			break;
+		default:
+			usage();
+			break;
+		}
+	}
+}
+
+int main(int argc, char **argv)
+{
+	static char outbuf[64 * 1024];
+	int i, first, rc, err;
+
+	awe_verbose = 1;
+	awe_init_option();
+	parse_options(argc, argv);
+	if (optind >= argc)
+		usage();
+	first = optind;
+
+	setvbuf(stdout, outbuf, _IOFBF, sizeof(outbuf));
+	err = 0;
+	for (i = first; i < argc; i++) {
+		/* the options are evaluated for each font as sfxload does */
+		awe_init_option();
+		awe_read_option_file(NULL);
+		awe_read_option_file(argv[i]);
+		awe_free_loadlist(part_list);
+		part_list = NULL;
+		parse_options(argc, argv);
+
+		printf("file %s\n", argv[i]);
+		rc = awe_load_bank(&null_ops, argv[i], part_list, TRUE);
+		if (rc == AWE_RET_NOT_FOUND) {
+			fprintf(stderr, PROGNAME ": can't find font file %s\n", argv[i]);
+			err = 1;
+		} else if (rc == AWE_RET_ERR) {
+			fprintf(stderr, PROGNAME ": stopped by error in %s\n", argv[i]);
+			err = 1;
+		}
+	}
+	if (fflush(stdout) != 0)
+		err = 1;
+	return err;
+}
+
+/* make a preset list from comand line options */
+static void add_part_list(char *arg)
+{
+	char tmp[100];
+	SFPatchRec pat, map;
+	if (strlen(arg) > sizeof(tmp)-1) {
+		fprintf(stderr, PROGNAME ": illegal argument %s\n", arg);
+		return;
+	}
+	strcpy(tmp, arg);
+	if (awe_parse_loadlist(tmp, &pat, &map, NULL))
+		part_list = awe_add_loadlist(part_list, &pat, &map);
+}
+
+
+/*----------------------------------------------------------------
+ * null operators; print the records instead of loading
+ *----------------------------------------------------------------*/
+
+static int null_load_patch(void *buf, int len)
+{
+	awe_patch_info *p = (awe_patch_info*)buf;
+	awe_open_parm *op;
+	awe_voice_map *map;
+	awe_sample_info *sp;
+	awe_voice_rec_patch *vrec;
+	int i, n, start;
+
+	switch (p->type) {
+	case AWE_OPEN_PATCH:
+		op = (awe_open_parm*)(p + 1);
+		printf("open type=%d locked=%d shared=%d",
+		       op->type & 0xff, (op->type & AWE_PAT_LOCKED) != 0,
+		       (op->type & AWE_PAT_SHARED) != 0);
+		/* the unique name of a font has the font name in 18 bytes
+		 * after the key and version (see parsesf.c)
+		 */
+		if (op->name[0] == 0x01) {
+			start = 6;
+			n = 6 + 18;
+		} else {
+			start = 0;
+			n = AWE_PATCH_NAME_LEN;
+		}
+		for (; n > start && op->name[n - 1] == ' '; n--)
+			;
+		printf(" name=\"");
+		for (i = start; i < n && op->name[i]; i++) {
+			if (op->name[i] >= 0x20 && op->name[i] < 0x7f)
+				putchar(op->name[i]);
+		}
+		printf("\"\n");
+		break;
+	case AWE_CLOSE_PATCH:
+		printf("close\n");
+		break;
+	case AWE_PROBE_DATA:
+		/* pretend that the sample was already loaded */
+		if (! load_samples)
+			return 0;
+		return -1;
+	case AWE_LOAD_DATA:
+		sp = (awe_sample_info*)(p + 1);
+		printf("sample %d start=%d end=%d loop=%d-%d size=%d\n",
+		       sp->sample, sp->start, sp->end,
+		       sp->loopstart, sp->loopend, sp->size);
+		break;
+	case AWE_LOAD_INFO:
+		vrec = (awe_voice_rec_patch*)buf;
+		print_voice(&vrec->hdr, &vrec->info);
+		break;
+	case AWE_MAP_PRESET:
+		map = (awe_voice_map*)(p + 1);
+		printf("map %d/%d/%d -> %d/%d/%d\n",
+		       map->src_instr, map->src_bank, map->src_key,
+		       map->map_instr, map->map_bank, map->map_key);
+		break;
+	default:
+		printf("patch type=%d len=%d\n", p->type, p->len);
+		break;
+	}
+	return len;
+}
+
+static int null_mem_avail(void)
+{
+	return 0x7fffffff;
+}
+
+static int null_reset_samples(void)
+{
+	return 0;
+}
+
+static int null_remove_samples(void)
+{
+	return 0;
+}
+
+static int null_zero_atten(int val)
+{
+	printf("zero_atten %d\n", val);
+	return 0;
+}
+
+/* print a voice record in a line */
+static void print_voice(awe_voice_rec_hdr *hdr, awe_voice_info *vp)
+{
+	awe_voice_parm *pp = &vp->parm;
+
+	printf("voice %d/%d %s sample=%d",
+	       hdr->instr, hdr->bank,
+	       hdr->write_mode == AWE_WR_REPLACE ? "replace" : "append",
+	       vp->sample);
+	printf(" key=%d-%d vel=%d-%d fix=%d/%d",
+	       vp->low, vp->high, vp->vellow, vp->velhigh,
+	       vp->fixkey, vp->fixvel);
+	printf(" ofs=%d,%d loop=%d,%d mode=0x%x rate=%d",
+	       vp->start, vp->end, vp->loopstart, vp->loopend,
+	       vp->mode, vp->rate_offset);
+	printf(" root=%d tune=%d scale=%d pan=%d/%d excl=%d amp=%d atten=%d",
+	       vp->root, vp->tune, vp->scaleTuning, vp->pan, vp->fixpan,
+	       vp->exclusiveClass, vp->amplitude, vp->attenuation);
+	printf(" modenv=%04x,%04x,%04x,%04x volenv=%04x,%04x,%04x,%04x",
+	       pp->moddelay, pp->modatkhld, pp->moddcysus, pp->modrelease,
+	       pp->voldelay, pp->volatkhld, pp->voldcysus, pp->volrelease);
+	printf(" lfo=%04x,%04x pefe=%04x fmmod=%04x tremfrq=%04x fm2frq2=%04x",
+	       pp->lfo1delay, pp->lfo2delay, pp->pefe, pp->fmmod,
+	       pp->tremfrq, pp->fm2frq2);
+	printf(" cutoff=%d filterQ=%d chorus=%d reverb=%d\n",
+	       pp->cutoff, pp->filterQ, pp->chorus, pp->reverb);
+}
@@ -74,6 +74,8 @@ static void usage()
 	      " options:\n"
 #ifdef BUILD_ASFXLOAD
 	      " -D, --hwdep=name        specify the hwdep name\n"
+	      " -O, --on-demand[=port]   load presets on program changes\n"
+	      " -R, --reserve=kbytes     keep free DRAM in on-demand mode\n"
 #else
 	      " -F, --device=file        specify the device file\n"
 	      " -D, --index=number       specify the device index (-1=autoprobe)\n"
@@ -110,6 +112,9 @@ static int sample_mode, remove_samples, dispmem, lock_sf;
 enum { CLEAR_SAMPLE, INCREMENT_SAMPLE, ADD_SAMPLE };
 #ifdef BUILD_ASFXLOAD
 static char *hwdep_name = NULL;
+static int ondemand;
+static char *ondemand_port;
+static int ondemand_reserve;
 #else
 static char *seq_devname = NULL;
 static int seq_devidx = -1;
@@ -189,6 +194,19 @@ int main(int argc, char **argv)
 			lock_sf = FALSE;
 	}
 
+#ifdef BUILD_ASFXLOAD
+	if (ondemand) {
+		/* the listed presets are locked, and the others are
+		 * loaded on demand
+		 */
+		rc = seq_ondemand_loop(&load_ops, sffile, part_list,
+				       ondemand_port,
+				       ondemand_reserve * 1024);
+		seq_alsa_end();
+		return rc == AWE_RET_OK ? 0 : 1;
+	}
+#endif
+
 	rc = awe_load_bank(&load_ops, sffile, part_list, lock_sf);
 	if (sample_mode == INCREMENT_SAMPLE && remove_samples) {
 		if (rc == AWE_RET_NOMEM) {
@@ -236,6 +254,8 @@ static struct option long_options[] = {
 	{"lock", 2, 0, 'l'},
 #ifdef BUILD_ASFXLOAD
 	{"hwdep", 1, 0, 'D'},
+	{"on-demand", 2, 0, 'O'},
+	{"reserve", 1, 0, 'R'},
 #else
 	{"device", 1, 0, 'F'},
 	{"index", 1, 0, 'D'},
@@ -245,7 +265,7 @@ static struct option long_options[] = {
 static int option_index;
 
 #ifdef BUILD_ASFXLOAD
-#define OPTION_FLAGS	"MxNivqL:lD:"
+#define OPTION_FLAGS	"MxNivqL:lD:O::R:"
 #else
 #define OPTION_FLAGS	"MxNivqL:lF:D:"
 #endif
@@ -315,6 +335,13 @@ static int parse_options(int argc, char **argv)
 		case 'D':
 			hwdep_name = optarg;
 			break;
+		case 'O':
+			ondemand = TRUE;
+			ondemand_port = optarg;
+			break;
+		case 'R':
+			ondemand_reserve = atoi(optarg);
+			break;
 #else
 		case 'F':
 			seq_devname = optarg;
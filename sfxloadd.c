@@ -0,0 +1,431 @@
+/*================================================================
+ * sfxloadd -- soundfont loader daemon for ALSA Emux WaveTable
+ *
+ * Copyright (C) 1996-2003 Takashi Iwai
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *================================================================*/
+
+/*
+ * The daemon keeps the hwdep device open, and the parsed soundfonts
+ * and virtual bank tables in memory.  The requests are sent as text
+ * lines via a unix domain socket:
+ *
+ *	load [-options] soundfont	load the font (same as asfxload)
+ *	clear				remove all samples
+ *	remove				remove additional samples
+ *	mem				report available memory
+ *	flush				drop cached fonts and file names
+ *	quit				terminate the daemon
+ *
+ * Each request is answered with a line beginning with "OK" or "ERR".
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <signal.h>
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <util.h>
+#include <alsa/asoundlib.h>
+#include <awebank.h>
+#include <sfopts.h>
+#include <awe_version.h>
+#include "seq.h"
+
+#define PROGNAME "sfxloadd"
+
+/* the socket is created in the per-user runtime directory,
+ * or in the system directory if not set
+ */
+#define SOCKET_NAME	"sfxloadd"
+#define SYSTEM_SOCKET_DIR	"/var/run"
+#define MAX_ARGS	64
+
+extern int awe_verbose;
+
+static AWEOps load_ops = {
+	seq_load_patch,
+	seq_mem_avail,
+	seq_reset_samples,
+	seq_remove_samples,
+	seq_zero_atten
+};
+
+static char *default_socket(void);
+static int open_socket(char *path);
+static void serve(int fd);
+static int do_request(FILE *out, char *line);
+static int do_load(FILE *out, int argc, char **argv);
+static void add_part_list(char *arg);
+
+
+/*----------------------------------------------------------------
+ * print usage and exit
+ *----------------------------------------------------------------*/
+
+static void usage()
+{
+	fputs("sfxloadd -- SoundFont loader daemon for ALSA Emux WaveTable\n"
+	      VERSION_NOTE
+	      "usage:	" PROGNAME " [-options]\n"
+	      "\n"
+	      " options:\n"
+	      " -D, --hwdep=name         specify the hwdep name\n"
+	      " -S, --socket=file        specify the socket file\n"
+	      "                          (default=$XDG_RUNTIME_DIR/" SOCKET_NAME " or " SYSTEM_SOCKET_DIR "/" SOCKET_NAME ")\n"
+	      " -d, --daemon             run in background\n"
+	      " -v, --verbose[=int]      set verbosity level\n"
+	      " -P, --path=dir           set SoundFont file search path\n",
+	      stderr);
+	exit(1);
+}
+
+
+/*----------------------------------------------------------------
+ * main
+ *----------------------------------------------------------------*/
+
+static struct option long_options[] = {
+	{"hwdep", 1, 0, 'D'},
+	{"socket", 1, 0, 'S'},
+	{"daemon", 0, 0, 'd'},
+	{"verbose", 2, 0, 'v'},
+	{0, 0, 0, 0},
+};
+static int option_index;
+
+#define OPTION_FLAGS	"D:S:dv"
+
+static char *hwdep_name = NULL;
+static char *socket_name = NULL;
+static int quit_request;
+
+int main(int argc, char **argv)
+{
+	int c, fd, background;
+
+	awe_init_option();
+	awe_verbose = 1;
+	background = FALSE;
+
+	awe_read_option_file(NULL);
+	while ((c = awe_parse_options(argc, argv, OPTION_FLAGS, long_options, &option_index)) != -1) {
+		switch (c) {
+		case 0:
+			break;
+		case 'D':
+			hwdep_name = optarg;
+			break;
+		case 'S':
+			socket_name = optarg;
+			break;
+		case 'd':
+			background = TRUE;
+			break;
+		case 'v':
+			if (optarg)
+				awe_verbose = atoi(optarg);
+			else
+				awe_verbose++;
+			break;
+		default:
+			usage();
+			break;
+		}
+	}
+
+	if (socket_name == NULL)
+		socket_name = default_socket();
+	seq_alsa_init(hwdep_name);
+	if ((fd = open_socket(socket_name)) < 0) {
+		seq_alsa_end();
+		return 1;
+	}
+	signal(SIGPIPE, SIG_IGN);
+	if (background && daemon(0, 1) < 0) {
+		perror(PROGNAME);
+		return 1;
+	}
+
+	awe_set_bank_cache(TRUE);
+	while (! quit_request) {
+		int cfd = accept(fd, NULL, NULL);
+		if (cfd < 0) {
+			if (errno == EINTR)
+				continue;
+			perror(PROGNAME ": accept");
+			break;
+		}
+		serve(cfd);
+	}
+
+	awe_set_bank_cache(FALSE);
+	close(fd);
+	unlink(socket_name);
+	seq_alsa_end();
+	return 0;
+}
+
+/* socket path in $XDG_RUNTIME_DIR or the system directory */
+static char *default_socket(void)
+{
+	static char path[256];
+	char *dir;
+
+	if ((dir = getenv("XDG_RUNTIME_DIR")) == NULL || *dir == 0)
+		dir = SYSTEM_SOCKET_DIR;
+	snprintf(path, sizeof(path), "%s/" SOCKET_NAME, dir);
+	return path;
+}
+
+/* create the listening socket; only the owner can connect to it */
+static int open_socket(char *path)
+{
+	struct sockaddr_un addr;
+	mode_t mask;
+	int fd, rc;
+
+	if (strlen(path) >= sizeof(addr.sun_path)) {
+		fprintf(stderr, PROGNAME ": too long socket name %s\n", path);
+		return -1;
+	}
+	if ((fd = socket(PF_UNIX, SOCK_STREAM, 0)) < 0) {
+		perror(PROGNAME ": socket");
+		return -1;
+	}
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, path);
+	unlink(path);
+	mask = umask(077);
+	rc = bind(fd, (struct sockaddr *)&addr, sizeof(addr));
+	umask(mask);
+	if (rc < 0 || chmod(path, S_IRUSR | S_IWUSR) < 0 ||
+	    listen(fd, 4) < 0) {
+		fprintf(stderr, PROGNAME ": can't open socket %s\n", path);
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+
+/*----------------------------------------------------------------
+ * handle requests from a client
+ *----------------------------------------------------------------*/
+
+static void serve(int fd)
+{
+	FILE *in, *out;
+	char line[1024];
+	int len;
+
+	if ((in = fdopen(fd, "r")) == NULL) {
+		close(fd);
+		return;
+	}
+	if ((out = fdopen(dup(fd), "w")) == NULL) {
+		fclose(in);
+		return;
+	}
+	while (! quit_request && fgets(line, sizeof(line), in)) {
+		len = strlen(line);
+		if (len > 0 && line[len-1] == '\n') line[len-1] = 0;
+		if (do_request(out, line))
+			fputs("OK\n", out);
+		fflush(out);
+	}
+	fclose(out);
+	fclose(in);
+}
+
+/* split the request line and execute it;
+ * return TRUE if the plain reply is necessary
+ */
+static int do_request(FILE *out, char *line)
+{
+	char *argv[MAX_ARGS];
+	int argc;
+
+	if ((argv[0] = strtoken(line)) == NULL)
+		return TRUE; /* empty line */
+	for (argc = 1; argc < MAX_ARGS - 1; argc++) {
+		if ((argv[argc] = strtoken(NULL)) == NULL)
+			break;
+	}
+	argv[argc] = NULL;
+
+	DEBUG(1,fprintf(stderr, PROGNAME ": request %s\n", argv[0]));
+	if (strcmp(argv[0], "load") == 0)
+		return do_load(out, argc, argv);
+	else if (strcmp(argv[0], "clear") == 0)
+		seq_reset_samples();
+	else if (strcmp(argv[0], "remove") == 0)
+		seq_remove_samples();
+	else if (strcmp(argv[0], "mem") == 0) {
+		fprintf(out, "OK %d\n", seq_mem_avail());
+		return FALSE;
+	} else if (strcmp(argv[0], "flush") == 0) {
+		awe_free_bank_cache();
+		awe_clear_path_cache();
+	} else if (strcmp(argv[0], "quit") == 0)
+		quit_request = TRUE;
+	else {
+		fprintf(out, "ERR unknown request %s\n", argv[0]);
+		return FALSE;
+	}
+	return TRUE;
+}
+
+
+/*----------------------------------------------------------------
+ * load request; the options are same as asfxload
+ *----------------------------------------------------------------*/
+
+static struct option load_options[] = {
+	{"remove", 2, 0, 'x'},
+	{"increment", 2, 0, 'N'},
+	{"clear", 2, 0, 'i'},
+	{"extract", 1, 0, 'L'},
+	{"lock", 2, 0, 'l'},
+	{0, 0, 0, 0},
+};
+
+#define LOAD_OPTION_FLAGS	"xNiL:l"
+
+#define set_bool()	(optarg ? bool_val(optarg) : TRUE)
+
+enum { CLEAR_SAMPLE, INCREMENT_SAMPLE, ADD_SAMPLE };
+
+static LoadList *part_list;
+
+static int do_load(FILE *out, int argc, char **argv)
+{
+	sf_options saved_option;
+	int c, rc, sample_mode, remove_samples, lock_sf;
+	char *sffile;
+
+	/* options are valid only in this request */
+	saved_option = awe_option;
+	if (saved_option.search_path)
+		saved_option.search_path = safe_strdup(saved_option.search_path);
+
+	sample_mode = ADD_SAMPLE;
+	remove_samples = FALSE;
+	lock_sf = -1;
+	part_list = NULL;
+
+	/* the font name is the first non-option argument */
+	opterr = 0;
+	c = awe_skip_options(argc, argv, LOAD_OPTION_FLAGS, load_options);
+	sffile = c < argc ? argv[c] : NULL;
+	if (sffile)
+		awe_read_option_file(sffile);
+
+	optind = 0;
+	rc = AWE_RET_OK;
+	while ((c = awe_parse_options(argc, argv, LOAD_OPTION_FLAGS, load_options, &option_index)) != -1) {
+		switch (c) {
+		case 0:
+			break;
+		case 'x':
+			remove_samples = set_bool();
+			break;
+		case 'N':
+			if (set_bool())
+				sample_mode = INCREMENT_SAMPLE;
+			break;
+		case 'i':
+			if (set_bool())
+				sample_mode = CLEAR_SAMPLE;
+			break;
+		case 'L':
+			add_part_list(optarg);
+			break;
+		case 'l':
+			lock_sf = set_bool();
+			break;
+		default:
+			rc = AWE_RET_ERR;
+			break;
+		}
+	}
+	opterr = 1;
+
+	if (rc != AWE_RET_OK)
+		fprintf(out, "ERR illegal option\n");
+	else if (sffile == NULL)
+		fprintf(out, "ERR no font is given\n");
+	else {
+		/* same as asfxload */
+		if (sample_mode == ADD_SAMPLE && awe_option.default_bank < 0)
+			sample_mode = CLEAR_SAMPLE;
+		if (sample_mode == CLEAR_SAMPLE)
+			seq_reset_samples();
+		else if (sample_mode != INCREMENT_SAMPLE && remove_samples)
+			seq_remove_samples();
+		if (lock_sf < 0)
+			lock_sf = awe_option.default_bank < 0;
+
+		rc = awe_load_bank(&load_ops, sffile, part_list, lock_sf);
+		if (sample_mode == INCREMENT_SAMPLE && remove_samples &&
+		    rc == AWE_RET_NOMEM) {
+			seq_remove_samples();
+			rc = awe_load_bank(&load_ops, sffile, part_list, lock_sf);
+		}
+		switch (rc) {
+		case AWE_RET_OK:
+		case AWE_RET_SKIP:
+			fputs("OK\n", out);
+			break;
+		case AWE_RET_NOMEM:
+			fputs("ERR no memory left\n", out);
+			break;
+		case AWE_RET_NOT_FOUND:
+			fprintf(out, "ERR can't find font file %s\n", sffile);
+			break;
+		default:
+			fputs("ERR stopped by error\n", out);
+			break;
+		}
+	}
+
+	awe_free_loadlist(part_list);
+	part_list = NULL;
+	if (awe_option.search_path)
+		free(awe_option.search_path);
+	awe_option = saved_option;
+	return FALSE;
+}
+
+/* make a preset list from comand line options */
+static void add_part_list(char *arg)
+{
+	char tmp[100];
+	SFPatchRec pat, map;
+	if (strlen(arg) > sizeof(tmp)-1) {
+		fprintf(stderr, PROGNAME ": illegal argument %s\n", arg);
+		return;
+	}
+	strcpy(tmp, arg);
+	if (awe_parse_loadlist(tmp, &pat, &map, NULL))
+		part_list = awe_add_loadlist(part_list, &pat, &map);
+}
@@ -24,17 +24,17 @@
 #include <stdlib.h>
 #include <sys/fcntl.h>
 #include <sys/ioctl.h>
+#include <sys/time.h>
 #ifdef __FreeBSD__
 #  include <machine/soundcard.h>
 #elif defined(linux)
 #  include <linux/soundcard.h>
 #endif
 #include <awe_voice.h>
+#include "util.h"
 #include "seq.h"
 #include "awe_version.h"
 
-SEQ_USE_EXTBUF();
-
 static int buffering = 0;
 
 /*----------------------------------------------------------------*/
@@ -172,6 +172,115 @@ static void seq_drum_channels(int channels)
 	if (!buffering) seqbuf_dump();
 }
 
+/*----------------------------------------------------------------
+ * latency benchmark
+ *
+ * Note-on/off pairs are sent in bursts.  The events are stored in
+ * the buffer, and written out at each given number of events.
+ * The time of each write() is measured.
+ *----------------------------------------------------------------*/
+
+typedef struct _BenchRec {
+	double *lat;	/* time of each write in usec */
+	int nwrites;
+	int events;
+	int bytes;
+	int pending;	/* events in the buffer */
+} BenchRec;
+
+static double time_usec(void)
+{
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return (double)tv.tv_sec * 1000000.0 + tv.tv_usec;
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+	double x = *(const double*)a, y = *(const double*)b;
+	return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+/* nearest rank of the sorted values */
+static double percentile(double *val, int n, int pct)
+{
+	int i = (n * pct + 99) / 100 - 1;
+	if (i < 0)
+		i = 0;
+	return val[i];
+}
+
+static void bench_flush(BenchRec *b)
+{
+	double t;
+
+	if (! b->pending)
+		return;
+	b->bytes += _seqbufptr;
+	t = time_usec();
+	seq_flush();
+	b->lat[b->nwrites++] = time_usec() - t;
+	b->pending = 0;
+}
+
+/* count the queued event, and write out the buffer if enough */
+static void bench_event(BenchRec *b, int batch)
+{
+	b->events++;
+	if (++b->pending >= batch)
+		bench_flush(b);
+}
+
+static void seq_benchmark(int v, int count, int batch, int gap)
+{
+	BenchRec b;
+	double start, total;
+	int i, maxevents;
+
+	if (count <= 0 || batch <= 0 || gap < 0) {
+		fprintf(stderr, "invalid benchmark parameters\n");
+		return;
+	}
+	fprintf(stderr, "benchmark %d bursts, %d events per write, gap %d\n",
+		count, batch, gap);
+
+	/* write out the former events out of measurement */
+	seq_flush();
+	maxevents = count * (gap ? 3 : 2);
+	memset(&b, 0, sizeof(b));
+	b.lat = (double*)safe_malloc(sizeof(double) * (maxevents / batch + 1));
+
+	/* the buffer grows up to the batch size */
+	seq_batch_begin();
+	start = time_usec();
+	for (i = 0; i < count; i++) {
+		SEQ_START_NOTE(awe_dev, v, 60 + i % 12, 100);
+		bench_event(&b, batch);
+		SEQ_STOP_NOTE(awe_dev, v, 60 + i % 12, 0);
+		bench_event(&b, batch);
+		if (gap) {
+			SEQ_DELTA_TIME(gap);
+			bench_event(&b, batch);
+		}
+	}
+	bench_flush(&b);
+	total = time_usec() - start;
+	seq_batch_end();
+
+	qsort(b.lat, b.nwrites, sizeof(double), cmp_double);
+	printf("%d events in %d writes (%.1f events, %.1f bytes per write)\n",
+	       b.events, b.nwrites, (double)b.events / b.nwrites,
+	       (double)b.bytes / b.nwrites);
+	printf("write latency (usec): min %.1f, 50%% %.1f, 90%% %.1f, 99%% %.1f, max %.1f\n",
+	       b.lat[0], percentile(b.lat, b.nwrites, 50),
+	       percentile(b.lat, b.nwrites, 90),
+	       percentile(b.lat, b.nwrites, 99),
+	       b.lat[b.nwrites - 1]);
+	printf("throughput: %.0f events/sec\n",
+	       total > 0 ? b.events * 1000000.0 / total : 0.0);
+	safe_free(b.lat);
+}
+
 /*----------------------------------------------------------------*/
 
 static void usage();
@@ -179,11 +288,13 @@ static void usage();
 int main(int argc, char **argv)
 {
 	int idx, chan;
-	int c;
+	int c, nwrites;
+	long nbytes;
 	char *seq_devname = NULL;
 	int seq_devidx = -1;
+	int bufsize = 0;
 
-	while ((c = getopt(argc, argv, "F:D:")) != -1) {
+	while ((c = getopt(argc, argv, "F:D:s:")) != -1) {
 		switch (c) {
 		case 'F':
 			seq_devname = optarg;
@@ -191,6 +302,9 @@ int main(int argc, char **argv)
 		case 'D':
 			seq_devidx = atoi(optarg);
 			break;
+		case 's':
+			bufsize = atoi(optarg);
+			break;
 		default:
 			usage();
 			exit(1);
@@ -202,6 +316,8 @@ int main(int argc, char **argv)
 	}
 
 	seq_init(seq_devname, seq_devidx);
+	if (bufsize > 0)
+		seq_set_buffer_size(bufsize);
 	fprintf(stderr, "init done\n");
 	SEQ_START_TIMER();
 	if (!buffering) seqbuf_dump();
@@ -295,13 +411,24 @@ int main(int argc, char **argv)
 		case 'M':
 			AWE_MISC_MODE(awe_dev, atoi(argv[idx+1]), atoi(argv[idx+2])); idx += 3;
 			break;
+		case 'S':
+			fprintf(stderr, "sync\n");
+			seq_sync(); idx++;
+			break;
+		case 'B':
+			seq_benchmark(chan, atoi(argv[idx+1]), atoi(argv[idx+2]),
+				      atoi(argv[idx+3]));
+			idx += 4;
+			break;
 		default:
 			goto loopend;
 		}
 	}
   loopend:
 	if (buffering) seqbuf_dump();
-	fprintf(stderr, "finishing..\n");
+	seq_get_stats(&nwrites, &nbytes);
+	fprintf(stderr, "finishing.. (%d writes, %.1f bytes per write)\n",
+		nwrites, nwrites ? (double)nbytes / nwrites : 0.0);
 	seq_end();
 	return 0;
 }
@@ -310,7 +437,7 @@ static void usage()
 {
 	fprintf(stderr, "sfxtest - a test program for AWE32/64 driver\n");
 	fprintf(stderr, VERSION_NOTE);
-	fprintf(stderr, "usage: sfxtest cmd pars..\n");
+	fprintf(stderr, "usage: sfxtest [-F file] [-D index] [-s bufsize] cmd pars..\n");
 	fprintf(stderr, "commands =\n");
 	fprintf(stderr, "X: use channel control mode\n");
 	fprintf(stderr, "x channel: change channel\n");
@@ -330,4 +457,7 @@ static void usage()
 	fprintf(stderr, "F parm val: send effect\n");
 	fprintf(stderr, "m parm val: send control value\n");
 	fprintf(stderr, "I: initialize emu chip\n");
+	fprintf(stderr, "u: toggle buffering mode\n");
+	fprintf(stderr, "S: write out events and wait until played\n");
+	fprintf(stderr, "B count batch gap: benchmark note bursts\n");
 }	
@@ -65,10 +65,18 @@ int main(int argc, char **argv)
 		return 1;
 	}
 
-	awe_save_soundfont(&sfinfo, fp, fout);
+	if (awe_save_soundfont(&sfinfo, fp, fout) < 0) {
+		fprintf(stderr, "can't save soundfont %s\n", argv[3]);
+		fclose(fp);
+		fclose(fout);
+		return 1;
+	}
 
 	fclose(fp);
-	fclose(fout);
+	if (fclose(fout) != 0) {
+		fprintf(stderr, "can't write output file %s\n", argv[3]);
+		return 1;
+	}
 
 	/*awe_free_soundfont(&sfinfo);*/
 	return 0;